@@ -91,6 +91,7 @@ use constant CFGCMD_REPO_LS                                         => 'repo-ls'
 use constant CFGCMD_REPO_PUT                                        => 'repo-put';
 use constant CFGCMD_REPO_RM                                         => 'repo-rm';
 use constant CFGCMD_RESTORE                                         => 'restore';
+use constant CFGCMD_SERVER                                          => 'server';
 use constant CFGCMD_STANZA_CREATE                                   => 'stanza-create';
 use constant CFGCMD_STANZA_DELETE                                   => 'stanza-delete';
 use constant CFGCMD_STANZA_UPGRADE                                  => 'stanza-upgrade';
@@ -146,18 +147,31 @@ use constant CFGOPT_COMPRESS                                        => 'compress
 use constant CFGOPT_COMPRESS_TYPE                                   => 'compress-type';
 use constant CFGOPT_COMPRESS_LEVEL                                  => 'compress-level';
 use constant CFGOPT_COMPRESS_LEVEL_NETWORK                          => 'compress-level-network';
+use constant CFGOPT_COMPRESS_TYPE_NETWORK                           => 'compress-type-network';
 use constant CFGOPT_IO_TIMEOUT                                      => 'io-timeout';
 use constant CFGOPT_NEUTRAL_UMASK                                   => 'neutral-umask';
 use constant CFGOPT_PROTOCOL_TIMEOUT                                => 'protocol-timeout';
 use constant CFGOPT_PROCESS_MAX                                     => 'process-max';
+use constant CFGOPT_PROCESS_QUEUE_MAX                               => 'process-queue-max';
 use constant CFGOPT_SCK_BLOCK                                       => 'sck-block';
 use constant CFGOPT_SCK_KEEP_ALIVE                                  => 'sck-keep-alive';
 use constant CFGOPT_TCP_KEEP_ALIVE_COUNT                            => 'tcp-keep-alive-count';
 use constant CFGOPT_TCP_KEEP_ALIVE_IDLE                             => 'tcp-keep-alive-idle';
 use constant CFGOPT_TCP_KEEP_ALIVE_INTERVAL                         => 'tcp-keep-alive-interval';
 
+# Server
+use constant CFGOPT_TLS_SERVER_ADDRESS                              => 'tls-server-address';
+use constant CFGOPT_TLS_SERVER_AUTH                                 => 'tls-server-auth';
+use constant CFGOPT_TLS_SERVER_CA_FILE                              => 'tls-server-ca-file';
+use constant CFGOPT_TLS_SERVER_CERT_FILE                            => 'tls-server-cert-file';
+use constant CFGOPT_TLS_SERVER_KEY_FILE                             => 'tls-server-key-file';
+use constant CFGOPT_TLS_SERVER_PORT                                 => 'tls-server-port';
+use constant CFGOPT_TLS_SERVER_PROCESS_MAX                          => 'tls-server-process-max';
+
 # Commands
 use constant CFGOPT_CMD_SSH                                         => 'cmd-ssh';
+use constant CFGOPT_CMD_SSH_CONTROL_PATH                            => 'cmd-ssh-control-path';
+use constant CFGOPT_CMD_SSH_CONTROL_PERSIST                         => 'cmd-ssh-control-persist';
 
 # Paths
 use constant CFGOPT_LOCK_PATH                                       => 'lock-path';
@@ -203,12 +217,16 @@ use constant CFGOPT_REPO_RETENTION_FULL_TYPE                        => CFGDEF_PR
 use constant CFGOPT_REPO_LOCAL                                      => CFGDEF_PREFIX_REPO . '-local';
 
 use constant CFGOPT_REPO_HOST                                       => CFGDEF_PREFIX_REPO . '-host';
+use constant CFGOPT_REPO_HOST_CA_FILE                               => CFGOPT_REPO_HOST . '-ca-file';
+use constant CFGOPT_REPO_HOST_CERT_FILE                             => CFGOPT_REPO_HOST . '-cert-file';
 use constant CFGOPT_REPO_HOST_CMD                                   => CFGOPT_REPO_HOST . '-cmd';
     push @EXPORT, qw(CFGOPT_REPO_HOST_CMD);
 use constant CFGOPT_REPO_HOST_CONFIG                                => CFGOPT_REPO_HOST . '-config';
 use constant CFGOPT_REPO_HOST_CONFIG_INCLUDE_PATH                   => CFGOPT_REPO_HOST_CONFIG . '-include-path';
 use constant CFGOPT_REPO_HOST_CONFIG_PATH                           => CFGOPT_REPO_HOST_CONFIG . '-path';
+use constant CFGOPT_REPO_HOST_KEY_FILE                              => CFGOPT_REPO_HOST . '-key-file';
 use constant CFGOPT_REPO_HOST_PORT                                  => CFGOPT_REPO_HOST . '-port';
+use constant CFGOPT_REPO_HOST_TYPE                                  => CFGOPT_REPO_HOST . '-type';
 use constant CFGOPT_REPO_HOST_USER                                  => CFGOPT_REPO_HOST . '-user';
 
 # Repository S3
@@ -218,17 +236,22 @@ use constant CFGOPT_REPO_S3_KEY_SECRET                              => CFGDEF_RE
 use constant CFGOPT_REPO_S3_BUCKET                                  => CFGDEF_REPO_S3 . '-bucket';
 use constant CFGOPT_REPO_S3_CA_FILE                                 => CFGDEF_REPO_S3 . '-ca-file';
 use constant CFGOPT_REPO_S3_CA_PATH                                 => CFGDEF_REPO_S3 . '-ca-path';
+use constant CFGOPT_REPO_S3_DOWNLOAD_MAX                            => CFGDEF_REPO_S3 . '-download-max';
 use constant CFGOPT_REPO_S3_ENDPOINT                                => CFGDEF_REPO_S3 . '-endpoint';
 use constant CFGOPT_REPO_S3_HOST                                    => CFGDEF_REPO_S3 . '-host';
+use constant CFGOPT_REPO_S3_LIST_MAX                                => CFGDEF_REPO_S3 . '-list-max';
 use constant CFGOPT_REPO_S3_PORT                                    => CFGDEF_REPO_S3 . '-port';
 use constant CFGOPT_REPO_S3_REGION                                  => CFGDEF_REPO_S3 . '-region';
+use constant CFGOPT_REPO_S3_TLS                                     => CFGDEF_REPO_S3 . '-tls';
 use constant CFGOPT_REPO_S3_TOKEN                                   => CFGDEF_REPO_S3 . '-token';
+use constant CFGOPT_REPO_S3_UPLOAD_MAX                              => CFGDEF_REPO_S3 . '-upload-max';
 use constant CFGOPT_REPO_S3_URI_STYLE                               => CFGDEF_REPO_S3 . '-uri-style';
 use constant CFGOPT_REPO_S3_VERIFY_TLS                              => CFGDEF_REPO_S3 . '-verify-tls';
 
 # Archive options
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPT_ARCHIVE_ASYNC                                   => 'archive-async';
+use constant CFGOPT_ARCHIVE_COMPRESS_DICT                           => 'archive-compress-dict';
 use constant CFGOPT_ARCHIVE_GET_QUEUE_MAX                           => 'archive-get-queue-max';
 use constant CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                          => 'archive-push-queue-max';
 
@@ -266,12 +289,16 @@ use constant CFGDEF_PREFIX_PG                                       => 'pg';
 use constant CFGOPT_PG_LOCAL                                        => CFGDEF_PREFIX_PG . '-local';
 
 use constant CFGOPT_PG_HOST                                         => CFGDEF_PREFIX_PG . '-host';
+use constant CFGOPT_PG_HOST_CA_FILE                                 => CFGOPT_PG_HOST . '-ca-file';
+use constant CFGOPT_PG_HOST_CERT_FILE                               => CFGOPT_PG_HOST . '-cert-file';
 use constant CFGOPT_PG_HOST_CMD                                     => CFGOPT_PG_HOST . '-cmd';
     push @EXPORT, qw(CFGOPT_PG_HOST_CMD);
 use constant CFGOPT_PG_HOST_CONFIG                                  => CFGOPT_PG_HOST . '-config';
 use constant CFGOPT_PG_HOST_CONFIG_INCLUDE_PATH                     => CFGOPT_PG_HOST_CONFIG . '-include-path';
 use constant CFGOPT_PG_HOST_CONFIG_PATH                             => CFGOPT_PG_HOST_CONFIG . '-path';
+use constant CFGOPT_PG_HOST_KEY_FILE                                => CFGOPT_PG_HOST . '-key-file';
 use constant CFGOPT_PG_HOST_PORT                                    => CFGOPT_PG_HOST . '-port';
+use constant CFGOPT_PG_HOST_TYPE                                    => CFGOPT_PG_HOST . '-type';
 use constant CFGOPT_PG_HOST_USER                                    => CFGOPT_PG_HOST . '-user';
 
 use constant CFGOPT_PG_PATH                                         => CFGDEF_PREFIX_PG . '-path';
@@ -300,6 +327,11 @@ use constant CFGOPTVAL_REPO_TYPE_CIFS                               => 'cifs';
 use constant CFGOPTVAL_REPO_TYPE_POSIX                              => 'posix';
 use constant CFGOPTVAL_REPO_TYPE_S3                                 => 's3';
 
+# Host types
+#-----------------------------------------------------------------------------------------------------------------------------------
+use constant CFGOPTVAL_HOST_TYPE_SSH                                => 'ssh';
+use constant CFGOPTVAL_HOST_TYPE_TLS                                => 'tls';
+
 # Repo encryption type
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPTVAL_REPO_CIPHER_TYPE_NONE                        => 'none';
@@ -388,6 +420,8 @@ use constant CFGDEF_LOCK_TYPE_ARCHIVE                               => 'archive'
     push @EXPORT, qw(CFGDEF_LOCK_TYPE_ARCHIVE);
 use constant CFGDEF_LOCK_TYPE_BACKUP                                => 'backup';
     push @EXPORT, qw(CFGDEF_LOCK_TYPE_BACKUP);
+use constant CFGDEF_LOCK_TYPE_ARCHIVE_GET                           => 'archive-get';
+    push @EXPORT, qw(CFGDEF_LOCK_TYPE_ARCHIVE_GET);
 use constant CFGDEF_LOCK_TYPE_ALL                                   => 'all';
     push @EXPORT, qw(CFGDEF_LOCK_TYPE_ALL);
 use constant CFGDEF_LOCK_TYPE_NONE                                  => 'none';
@@ -473,7 +507,7 @@ my $rhCommandDefine =
     &CFGCMD_ARCHIVE_GET =>
     {
         &CFGDEF_LOG_FILE => false,
-        &CFGDEF_LOCK_TYPE => CFGDEF_LOCK_TYPE_ARCHIVE,
+        &CFGDEF_LOCK_TYPE => CFGDEF_LOCK_TYPE_ARCHIVE_GET,
         &CFGDEF_PARAMETER_ALLOWED => true,
     },
 
@@ -558,6 +592,10 @@ my $rhCommandDefine =
     {
     },
 
+    &CFGCMD_SERVER =>
+    {
+    },
+
     &CFGCMD_STANZA_CREATE =>
     {
         &CFGDEF_LOCK_REQUIRED => true,
@@ -617,6 +655,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -1126,6 +1165,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -1183,6 +1223,59 @@ my %hConfigDefine =
         &CFGDEF_DEPEND => CFGOPT_TCP_KEEP_ALIVE_COUNT,
     },
 
+    &CFGOPT_TLS_SERVER_ADDRESS =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => 'localhost',
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_SERVER => {},
+        },
+    },
+
+    &CFGOPT_TLS_SERVER_AUTH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_HASH,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_CA_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_CERT_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_TLS_SERVER_CA_FILE,
+    },
+
+    &CFGOPT_TLS_SERVER_KEY_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_TLS_SERVER_CA_FILE,
+    },
+
+    &CFGOPT_TLS_SERVER_PORT =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 8432,
+        &CFGDEF_ALLOW_RANGE => [1, 65535],
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_PROCESS_MAX =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 64,
+        &CFGDEF_ALLOW_RANGE => [1, 999],
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
     &CFGOPT_DB_TIMEOUT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1279,6 +1372,34 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_COMPRESS_TYPE_NETWORK =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => 'gz',
+        &CFGDEF_ALLOW_LIST =>
+        [
+            'gz',
+            'lz4',
+            'zst',
+        ],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_GET => {},
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_CHECK => {},
+            &CFGCMD_INFO => {},
+            &CFGCMD_REPO_GET => {},
+            &CFGCMD_REPO_LS => {},
+            &CFGCMD_REPO_PUT => {},
+            &CFGCMD_RESTORE => {},
+            &CFGCMD_STANZA_CREATE => {},
+            &CFGCMD_STANZA_DELETE => {},
+            &CFGCMD_STANZA_UPGRADE => {},
+        }
+    },
+
     &CFGOPT_NEUTRAL_UMASK =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1297,6 +1418,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -1332,6 +1454,42 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_CMD_SSH_CONTROL_PATH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_GET => {},
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_CHECK => {},
+            &CFGCMD_EXPIRE => {},
+            &CFGCMD_INFO => {},
+            &CFGCMD_REPO_CREATE => {},
+            &CFGCMD_REPO_GET => {},
+            &CFGCMD_REPO_LS => {},
+            &CFGCMD_REPO_PUT => {},
+            &CFGCMD_REPO_RM => {},
+            &CFGCMD_RESTORE => {},
+            &CFGCMD_STANZA_CREATE => {},
+            &CFGCMD_STANZA_DELETE => {},
+            &CFGCMD_STANZA_UPGRADE => {},
+            &CFGCMD_START => {},
+            &CFGCMD_STOP => {},
+        },
+    },
+
+    &CFGOPT_CMD_SSH_CONTROL_PERSIST =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 30,
+        &CFGDEF_ALLOW_RANGE => [1, 86400],
+        &CFGDEF_COMMAND => CFGOPT_CMD_SSH_CONTROL_PATH,
+    },
+
     &CFGOPT_IO_TIMEOUT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1381,6 +1539,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -1408,6 +1567,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -1536,6 +1696,27 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_REPO_HOST_CA_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
+    &CFGOPT_REPO_HOST_CERT_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_REPO_HOST_CA_FILE,
+        &CFGDEF_REQUIRED => true,
+    },
+
     &CFGOPT_REPO_HOST_CMD =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1600,6 +1781,12 @@ my %hConfigDefine =
         &CFGDEF_DEFAULT => CFGDEF_DEFAULT_CONFIG_INCLUDE_PATH,
     },
 
+    &CFGOPT_REPO_HOST_KEY_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_REPO_HOST_CA_FILE,
+        &CFGDEF_REQUIRED => true,
+    },
+
     &CFGOPT_REPO_HOST_PORT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1619,6 +1806,25 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_REPO_HOST_TYPE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => CFGOPTVAL_HOST_TYPE_SSH,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_HOST_TYPE_SSH,
+            &CFGOPTVAL_HOST_TYPE_TLS,
+        ],
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST
+        },
+    },
+
     &CFGOPT_REPO_HOST_USER =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1833,6 +2039,18 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_REPO_S3_DOWNLOAD_MAX =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => 4,
+        &CFGDEF_ALLOW_RANGE => [1, 64],
+        &CFGDEF_DEPEND => CFGOPT_REPO_S3_BUCKET,
+        &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
+    },
+
     &CFGOPT_REPO_S3_ENDPOINT =>
     {
         &CFGDEF_INHERIT => CFGOPT_REPO_S3_BUCKET,
@@ -1857,6 +2075,18 @@ my %hConfigDefine =
         &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
     },
 
+    &CFGOPT_REPO_S3_LIST_MAX =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => 4,
+        &CFGDEF_ALLOW_RANGE => [1, 64],
+        &CFGDEF_DEPEND => CFGOPT_REPO_S3_BUCKET,
+        &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
+    },
+
     &CFGOPT_REPO_S3_PORT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1878,6 +2108,17 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_REPO_S3_TLS =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => true,
+        &CFGDEF_DEPEND => CFGOPT_REPO_S3_BUCKET,
+        &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
+    },
+
     &CFGOPT_REPO_S3_TOKEN =>
     {
         &CFGDEF_INHERIT => CFGOPT_REPO_S3_KEY,
@@ -1885,6 +2126,18 @@ my %hConfigDefine =
         &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
     },
 
+    &CFGOPT_REPO_S3_UPLOAD_MAX =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => 4,
+        &CFGDEF_ALLOW_RANGE => [1, 64],
+        &CFGDEF_DEPEND => CFGOPT_REPO_S3_BUCKET,
+        &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
+    },
+
     &CFGOPT_REPO_S3_URI_STYLE =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1997,6 +2250,21 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_PROCESS_QUEUE_MAX =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 1,
+        &CFGDEF_ALLOW_RANGE => [1, 32],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_GET => {},
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_RESTORE => {},
+        }
+    },
+
     # Logging options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_LOG_LEVEL_CONSOLE =>
@@ -2028,6 +2296,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -2056,6 +2325,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -2084,6 +2354,7 @@ my %hConfigDefine =
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -2141,6 +2412,17 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_ARCHIVE_COMPRESS_DICT =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH => {},
+        }
+    },
+
     &CFGOPT_ARCHIVE_PUSH_QUEUE_MAX =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2425,6 +2707,22 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_PG_HOST_CA_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_PG_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
+    &CFGOPT_PG_HOST_CERT_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CA_FILE,
+        &CFGDEF_REQUIRED => true,
+    },
+
     &CFGOPT_PG_HOST_CMD =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_STANZA,
@@ -2480,6 +2778,12 @@ my %hConfigDefine =
         &CFGDEF_DEFAULT => CFGDEF_DEFAULT_CONFIG_INCLUDE_PATH,
     },
 
+    &CFGOPT_PG_HOST_KEY_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CA_FILE,
+        &CFGDEF_REQUIRED => true,
+    },
+
     &CFGOPT_PG_HOST_PORT =>
     {
         &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
@@ -2493,6 +2797,18 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_PG_HOST_TYPE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
+        &CFGDEF_REQUIRED => true,
+        &CFGDEF_DEFAULT => CFGOPTVAL_HOST_TYPE_SSH,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_HOST_TYPE_SSH,
+            &CFGOPTVAL_HOST_TYPE_TLS,
+        ],
+    },
+
     &CFGOPT_PG_HOST_USER =>
     {
         &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
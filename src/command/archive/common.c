@@ -10,13 +10,17 @@ Archive Common
 #include <unistd.h>
 
 #include "command/archive/common.h"
+#include "common/compress/zst/common.h"
+#include "common/crypto/cipherBlock.h"
 #include "common/debug.h"
 #include "common/fork.h"
+#include "common/io/io.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
 #include "common/wait.h"
 #include "config/config.h"
+#include "info/infoArchive.h"
 #include "postgres/version.h"
 #include "storage/helper.h"
 #include "storage/helper.h"
@@ -29,6 +33,30 @@ STRING_EXTERN(WAL_SEGMENT_PARTIAL_REGEXP_STR,                       WAL_SEGMENT_
 STRING_EXTERN(WAL_SEGMENT_DIR_REGEXP_STR,                           WAL_SEGMENT_DIR_REGEXP);
 STRING_EXTERN(WAL_SEGMENT_FILE_REGEXP_STR,                          WAL_SEGMENT_FILE_REGEXP);
 
+/***********************************************************************************************************************************
+Compression dictionary constants
+***********************************************************************************************************************************/
+STRING_EXTERN(ARCHIVE_DICT_FILE_REGEXP_STR,                         ARCHIVE_DICT_FILE_REGEXP);
+
+/***********************************************************************************************************************************
+Local variables
+***********************************************************************************************************************************/
+typedef struct ArchiveDictCache
+{
+    unsigned int dictId;                                            // Dictionary id
+    Buffer *dictionary;                                             // Dictionary
+} ArchiveDictCache;
+
+static struct ArchiveDictLocal
+{
+    MemContext *memContext;                                         // Mem context for dictionaries
+    CipherType cipherType;                                          // Repository cipher type
+    String *cipherPass;                                             // Archive cipher pass (NULL until loaded when encrypted)
+    List *cache;                                                    // Dictionaries loaded by id
+    bool loaded;                                                    // Has the compression dictionary been loaded (or found)?
+    const Buffer *dictionary;                                       // Compression dictionary or NULL when missing
+} archiveDictLocal;
+
 /***********************************************************************************************************************************
 Global error file constant
 ***********************************************************************************************************************************/
@@ -280,6 +308,226 @@ archiveAsyncExec(ArchiveMode archiveMode, const StringList *commandExec)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Load a dictionary from the repository by id. Loaded dictionaries are cached for the life of the process.
+***********************************************************************************************************************************/
+static const Buffer *
+archiveDictLoad(unsigned int dictId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, dictId);
+    FUNCTION_LOG_END();
+
+    ASSERT(archiveDictLocal.memContext != NULL);
+
+    const Buffer *result = NULL;
+
+    // Check the cache first
+    for (unsigned int cacheIdx = 0; cacheIdx < lstSize(archiveDictLocal.cache); cacheIdx++)
+    {
+        const ArchiveDictCache *cache = lstGet(archiveDictLocal.cache, cacheIdx);
+
+        if (cache->dictId == dictId)
+        {
+            result = cache->dictionary;
+            break;
+        }
+    }
+
+    if (result == NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Load the archive cipher pass from archive.info when it was not provided
+            if (archiveDictLocal.cipherType != cipherTypeNone && archiveDictLocal.cipherPass == NULL)
+            {
+                const String *cipherPass = infoArchiveCipherPass(
+                    infoArchiveLoadFile(
+                        storageRepo(), INFO_ARCHIVE_PATH_FILE_STR, archiveDictLocal.cipherType,
+                        cfgOptionStrNull(cfgOptRepoCipherPass)));
+
+                MEM_CONTEXT_BEGIN(archiveDictLocal.memContext)
+                {
+                    archiveDictLocal.cipherPass = strDup(cipherPass);
+                }
+                MEM_CONTEXT_END();
+            }
+
+            StorageRead *read = storageNewReadP(
+                storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/" ARCHIVE_DICT_FILE_PREFIX "%u", dictId), .ignoreMissing = true);
+            cipherBlockFilterGroupAdd(
+                ioReadFilterGroup(storageReadIo(read)), archiveDictLocal.cipherType, cipherModeDecrypt,
+                archiveDictLocal.cipherPass);
+
+            Buffer *dictionary = storageGetP(read);
+
+            if (dictionary != NULL)
+            {
+                ArchiveDictCache cache = {.dictId = dictId, .dictionary = bufMove(dictionary, archiveDictLocal.memContext)};
+                lstAdd(archiveDictLocal.cache, &cache);
+
+                result = cache.dictionary;
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+void
+archiveDictInit(CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    if (archiveDictLocal.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("ArchiveDict")
+            {
+                archiveDictLocal.memContext = MEM_CONTEXT_NEW();
+                archiveDictLocal.cache = lstNewP(sizeof(ArchiveDictCache));
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    archiveDictLocal.cipherType = cipherType;
+
+    if (cipherPass != NULL && archiveDictLocal.cipherPass == NULL)
+    {
+        MEM_CONTEXT_BEGIN(archiveDictLocal.memContext)
+        {
+            archiveDictLocal.cipherPass = strDup(cipherPass);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    compressDictLoadSet(archiveDictLoad);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Find the compression dictionary in the repository. If there is more than one (because they were trained concurrently) then use the
+lowest id so all processes agree.
+***********************************************************************************************************************************/
+static const Buffer *
+archiveDictFind(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    const Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StringList *dictList = storageListP(storageRepo(), STORAGE_REPO_ARCHIVE_STR, .expression = ARCHIVE_DICT_FILE_REGEXP_STR);
+        unsigned int dictIdMin = 0;
+
+        for (unsigned int dictIdx = 0; dictIdx < (dictList == NULL ? 0 : strLstSize(dictList)); dictIdx++)
+        {
+            unsigned int dictId = cvtZToUInt(strPtr(strLstGet(dictList, dictIdx)) + sizeof(ARCHIVE_DICT_FILE_PREFIX) - 1);
+
+            if (dictIdMin == 0 || dictId < dictIdMin)
+                dictIdMin = dictId;
+        }
+
+        if (dictIdMin != 0)
+            result = archiveDictLoad(dictIdMin);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+const Buffer *
+archiveDict(CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    archiveDictInit(cipherType, cipherPass);
+
+    if (!archiveDictLocal.loaded)
+    {
+        archiveDictLocal.dictionary = archiveDictFind();
+        archiveDictLocal.loaded = true;
+    }
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, archiveDictLocal.dictionary);
+}
+
+/**********************************************************************************************************************************/
+const Buffer *
+archiveDictTrain(const StringList *walSourceList, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, walSourceList);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(walSourceList != NULL);
+    ASSERT(strLstSize(walSourceList) > 0);
+
+    // Train the dictionary only when the repository does not have one. Dictionaries are never replaced since WAL segments already
+    // compressed with them could not be decompressed without them.
+    if (archiveDict(cipherType, cipherPass) == NULL)
+    {
+#ifdef HAVE_LIBZST
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Read samples from the most recent WAL segments since they best represent the WAL that will be compressed
+            unsigned int walSourceTotal =
+                strLstSize(walSourceList) < ARCHIVE_DICT_TRAIN_SEGMENT_MAX ?
+                    strLstSize(walSourceList) : ARCHIVE_DICT_TRAIN_SEGMENT_MAX;
+            const Variant *walSourceLimit = VARUINT64(ARCHIVE_DICT_TRAIN_SIZE / walSourceTotal);
+            Buffer *sample = bufNew(0);
+
+            for (unsigned int walSourceIdx = strLstSize(walSourceList) - walSourceTotal; walSourceIdx < strLstSize(walSourceList);
+                 walSourceIdx++)
+            {
+                bufCat(
+                    sample,
+                    storageGetP(
+                        storageNewReadP(storageLocal(), strLstGet(walSourceList, walSourceIdx), .limit = walSourceLimit)));
+            }
+
+            // Each WAL page is a sample
+            Buffer *dictionary = zstDictTrain(sample, ARCHIVE_DICT_SAMPLE_SIZE, ARCHIVE_DICT_SIZE);
+
+            if (dictionary != NULL)
+            {
+                // Store the dictionary by id. The write is atomic so other processes never see a partial dictionary.
+                StorageWrite *write = storageNewWriteP(
+                    storageRepoWrite(),
+                    strNewFmt(STORAGE_REPO_ARCHIVE "/" ARCHIVE_DICT_FILE_PREFIX "%u", zstDictId(dictionary)));
+                cipherBlockFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), cipherType, cipherModeEncrypt, cipherPass);
+                storagePutP(write, dictionary);
+
+                LOG_DETAIL_FMT(
+                    "trained WAL compression dictionary %u from %u WAL segment(s)", zstDictId(dictionary), walSourceTotal);
+
+                // Find the dictionary again in case another process stored a dictionary concurrently
+                archiveDictLocal.dictionary = archiveDictFind();
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+#endif // HAVE_LIBZST
+    }
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, archiveDictLocal.dictionary);
+}
+
 /**********************************************************************************************************************************/
 bool
 walIsPartial(const String *walSegment)
@@ -443,6 +691,109 @@ walSegmentFind(const Storage *storage, const String *archiveId, const String *wa
     FUNCTION_LOG_RETURN(STRING, result);
 }
 
+/**********************************************************************************************************************************/
+StringList *
+walSegmentFindList(const Storage *storage, const String *archiveId, const StringList *walSegmentList, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING_LIST, walSegmentList);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archiveId != NULL);
+    ASSERT(walSegmentList != NULL);
+
+    StringList *result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Wait *wait = waitNew(timeout);
+        unsigned int walSegmentIdx = 0;
+
+        while (walSegmentIdx < strLstSize(walSegmentList))
+        {
+            const String *walPath = strSubN(strLstGet(walSegmentList, walSegmentIdx), 0, 16);
+            unsigned int walSegmentBeginIdx = walSegmentIdx;
+
+            // Get a list of all WAL segments in the path
+            StringList *list = storageListP(
+                storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(walPath)),
+                .expression = STRDEF("^[0-F]{24}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$"), .nullOnMissing = true);
+
+            if (list != NULL)
+            {
+                strLstSort(list, sortOrderAsc);
+                unsigned int listIdx = 0;
+
+                // Match segments in the path until one is missing
+                for (; walSegmentIdx < strLstSize(walSegmentList); walSegmentIdx++)
+                {
+                    const String *walSegment = strLstGet(walSegmentList, walSegmentIdx);
+                    ASSERT(walIsSegment(walSegment) && !walIsPartial(walSegment));
+
+                    if (!strBeginsWith(walSegment, walPath))
+                        break;
+
+                    // Skip segments that sort before this one, then collect matches
+                    while (listIdx < strLstSize(list) && strCmp(strSubN(strLstGet(list, listIdx), 0, 24), walSegment) < 0)
+                        listIdx++;
+
+                    StringList *match = strLstNew();
+
+                    while (listIdx < strLstSize(list) && strBeginsWith(strLstGet(list, listIdx), walSegment))
+                    {
+                        strLstAdd(match, strLstGet(list, listIdx));
+                        listIdx++;
+                    }
+
+                    if (strLstSize(match) == 0)
+                        break;
+
+                    // Error if there is more than one match
+                    if (strLstSize(match) > 1)
+                    {
+                        THROW_FMT(
+                            ArchiveDuplicateError,
+                            "duplicates found in archive for WAL segment %s: %s\n"
+                                "HINT: are multiple primaries archiving to this stanza?",
+                            strPtr(walSegment), strPtr(strLstJoin(match, ", ")));
+                    }
+
+                    strLstAdd(result, strLstGet(match, 0));
+                }
+            }
+
+            // Restart the timeout when segments were found so each segment gets the full timeout, like walSegmentFind()
+            if (walSegmentIdx != walSegmentBeginIdx)
+                wait = waitNew(timeout);
+
+            // Wait for missing segments in the path. When all the segments in the path were found then move on to the next path
+            // without waiting.
+            if (walSegmentIdx < strLstSize(walSegmentList) && strBeginsWith(strLstGet(walSegmentList, walSegmentIdx), walPath) &&
+                !waitMore(wait))
+            {
+                break;
+            }
+        }
+
+        if (walSegmentIdx < strLstSize(walSegmentList) && timeout != 0)
+        {
+            THROW_FMT(
+                ArchiveTimeoutError,
+                "WAL segment %s was not archived before the %" PRIu64 "ms timeout\n"
+                    "HINT: check the archive_command to ensure that all options are correct (especially --stanza).\n"
+                    "HINT: check the PostgreSQL server log for errors.",
+                strPtr(strLstGet(walSegmentList, walSegmentIdx)), timeout);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
 /**********************************************************************************************************************************/
 String *
 walSegmentNext(const String *walSegment, size_t walSegmentSize, unsigned int pgVersion)
@@ -18,6 +18,7 @@ typedef enum
 } ArchiveMode;
 
 #include "common/compress/helper.h"
+#include "common/crypto/common.h"
 #include "common/type/stringList.h"
 #include "storage/storage.h"
 
@@ -30,6 +31,27 @@ Status file extension constants
 #define STATUS_EXT_OK                                               ".ok"
 #define STATUS_EXT_OK_SIZE                                          (sizeof(STATUS_EXT_OK) - 1)
 
+// Written by archive-get when it is waiting on a WAL segment that a running async process may not be fetching
+#define STATUS_EXT_PENDING                                          ".pending"
+#define STATUS_EXT_PENDING_SIZE                                     (sizeof(STATUS_EXT_PENDING) - 1)
+
+/***********************************************************************************************************************************
+Compression dictionary constants
+***********************************************************************************************************************************/
+// Dictionaries are stored next to archive.info and named with the dictionary id, so a dictionary trained concurrently by another
+// process never overwrites one that WAL segments may already be compressed with
+#define ARCHIVE_DICT_FILE_PREFIX                                    "archive.dict."
+#define ARCHIVE_DICT_FILE_REGEXP                                    "^archive\\.dict\\.[0-9]+$"
+    STRING_DECLARE(ARCHIVE_DICT_FILE_REGEXP_STR);
+
+// Size of the samples (one WAL page) and the size of the dictionary trained from them
+#define ARCHIVE_DICT_SAMPLE_SIZE                                    ((size_t)8192)
+#define ARCHIVE_DICT_SIZE                                           ((size_t)64 * 1024)
+
+// Maximum number of (most recent) WAL segments and total bytes read from them to train the dictionary
+#define ARCHIVE_DICT_TRAIN_SEGMENT_MAX                              4
+#define ARCHIVE_DICT_TRAIN_SIZE                                     ((size_t)16 * 1024 * 1024)
+
 /***********************************************************************************************************************************
 WAL segment constants
 ***********************************************************************************************************************************/
@@ -75,6 +97,18 @@ void archiveAsyncStatusErrorWrite(ArchiveMode archiveMode, const String *walSegm
 // Execute the async process.  This function will only return in the calling process and the implementation is platform depedent.
 void archiveAsyncExec(ArchiveMode archiveMode, const StringList *commandExec);
 
+// Load dictionaries from the repository by id when required to decompress WAL segments. When cipherPass is NULL and the repository
+// is encrypted then the archive cipher pass is loaded from archive.info the first time a dictionary is loaded.
+void archiveDictInit(CipherType cipherType, const String *cipherPass);
+
+// Get the dictionary used to compress WAL segments. When the repository has more than one dictionary the one with the lowest id is
+// used so all processes agree. NULL is returned when the repository does not have a dictionary.
+const Buffer *archiveDict(CipherType cipherType, const String *cipherPass);
+
+// Get the dictionary used to compress WAL segments, training it from the most recent WAL segments in the list and storing it in the
+// repository when the repository does not have a dictionary. NULL is returned when the WAL segments are not suitable for training.
+const Buffer *archiveDictTrain(const StringList *walSourceList, CipherType cipherType, const String *cipherPass);
+
 // Is the segment partial?
 bool walIsPartial(const String *walSegment);
 
@@ -89,6 +123,12 @@ String *walPath(const String *walFile, const String *pgPath, const String *comma
 // thing.
 String *walSegmentFind(const Storage *storage, const String *archiveId, const String *walSegment, TimeMSec timeout);
 
+// Find a list of WAL segments in the repository. Each path is listed once for all the segments it contains rather than once per
+// segment. The archive file names are returned in segment order. If timeout is zero then only the archive files for the leading
+// segments that have already been archived are returned, otherwise an error is thrown when a segment is not found in time.
+StringList *walSegmentFindList(
+    const Storage *storage, const String *archiveId, const StringList *walSegmentList, TimeMSec timeout);
+
 // Get the next WAL segment given a WAL segment and WAL segment size
 String *walSegmentNext(const String *walSegment, size_t walSegmentSize, unsigned int pgVersion);
 
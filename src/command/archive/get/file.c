@@ -161,6 +161,10 @@ archiveGetFile(
 
             if (compressType != compressTypeNone)
             {
+                // Dictionaries required by the compressed WAL segment are loaded from the repository
+                if (compressTypeDict(compressType))
+                    archiveDictInit(cipherType, archiveGetCheckResult.cipherPass);
+
                 ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), decompressFilter(compressType));
                 compressible = false;
             }
@@ -141,6 +141,7 @@ cmdArchiveGet(void)
             bool queueFull = false;                                     // Is the queue half or more full?
             bool forked = false;                                        // Has the async process been forked yet?
             bool throwOnError = false;                                  // Should we throw errors?
+            bool pending = false;                                       // Has a pending file been written?
 
             // Loop and wait for the WAL segment to be pushed
             Wait *wait = waitNew((TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC));
@@ -163,6 +164,14 @@ cmdArchiveGet(void)
                 // If found then move the WAL segment to the destination directory
                 if (found)
                 {
+                    // Remove the pending file first so the async process never sees it after the WAL segment has been consumed
+                    if (pending)
+                    {
+                        storageRemoveP(
+                            storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s" STATUS_EXT_PENDING, strPtr(walSegment)));
+                        pending = false;
+                    }
+
                     // Source is the WAL segment in the spool queue
                     StorageRead *source = storageNewReadP(
                         storageSpool(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s", strPtr(walSegment)));
@@ -199,8 +208,8 @@ cmdArchiveGet(void)
                 }
 
                 // If the WAL segment has not already been found then start the async process to get it.  There's no point in
-                // forking the async process off more than once so track that as well.  Use an archive lock to prevent forking if
-                // the async process was launched by another process.
+                // forking the async process off more than once so track that as well.  Use an archive-get lock to prevent forking
+                // if the async process was launched by another process.
                 if (!forked && (!found || !queueFull)  &&
                     lockAcquire(cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgLockType(), 0, false))
                 {
@@ -242,6 +251,17 @@ cmdArchiveGet(void)
                     // enough to do the job, running it again won't help anything.
                     forked = true;
                 }
+                // Else an async process is already running so let it know which WAL segment is needed. If the WAL segment is not in
+                // its queue it will exit so a new async process can be launched.
+                else if (!found && !forked && !pending)
+                {
+                    storagePutP(
+                        storageNewWriteP(
+                            storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s" STATUS_EXT_PENDING, strPtr(walSegment))),
+                        NULL);
+
+                    pending = true;
+                }
 
                 // Exit loop if WAL was found
                 if (found)
@@ -251,6 +271,13 @@ cmdArchiveGet(void)
                 throwOnError = true;
             }
             while (waitMore(wait));
+
+            // Remove the pending file if the WAL segment was not found before the timeout
+            if (pending)
+            {
+                storageRemoveP(
+                    storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s" STATUS_EXT_PENDING, strPtr(walSegment)));
+            }
         }
         // Else perform synchronous get
         else
@@ -275,6 +302,64 @@ cmdArchiveGet(void)
     FUNCTION_LOG_RETURN(INT, result);
 }
 
+/***********************************************************************************************************************************
+Prefetch constants
+
+After the WAL segments requested by archive-get have been fetched the async process keeps running and refills the queue as
+PostgreSQL consumes WAL. The queue is checked at this interval to see what has been consumed.
+***********************************************************************************************************************************/
+#define ARCHIVE_GET_PREFETCH_POLL_MSEC                              100
+
+/***********************************************************************************************************************************
+Determine how many WAL segments should be in the queue based on how fast they are being consumed and fetched
+
+The queue needs to hold enough WAL to cover consumption by PostgreSQL while the next WAL segment is being fetched. This is doubled
+to allow for variance in both rates. Until WAL has been consumed there is no rate to go on so nothing more is fetched -- the queue
+was already filled by the WAL segments requested when the async process was launched.
+***********************************************************************************************************************************/
+static unsigned int
+queuePrefetchTotal(TimeMSec consumeTime, TimeMSec fetchTime, unsigned int queueTotalMax)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, consumeTime);
+        FUNCTION_TEST_PARAM(UINT64, fetchTime);
+        FUNCTION_TEST_PARAM(UINT, queueTotalMax);
+    FUNCTION_TEST_END();
+
+    unsigned int result = 0;
+
+    if (consumeTime != 0)
+    {
+        uint64_t total = (fetchTime + ARCHIVE_GET_PREFETCH_POLL_MSEC) * 2 / consumeTime + 1;
+
+        if (total < 2)
+            result = 2;
+        else if (total > queueTotalMax)
+            result = queueTotalMax;
+        else
+            result = (unsigned int)total;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Update a running average of consume/fetch times
+***********************************************************************************************************************************/
+static TimeMSec
+queuePrefetchTimeAvg(TimeMSec timeAvg, TimeMSec timeSample)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, timeAvg);
+        FUNCTION_TEST_PARAM(UINT64, timeSample);
+    FUNCTION_TEST_END();
+
+    if (timeAvg == 0)
+        FUNCTION_TEST_RETURN(timeSample);
+
+    FUNCTION_TEST_RETURN((timeAvg + timeSample) / 2);
+}
+
 /**********************************************************************************************************************************/
 typedef struct ArchiveGetAsyncData
 {
@@ -309,81 +394,285 @@ static ProtocolParallelJob *archiveGetAsyncCallback(void *data, unsigned int cli
     FUNCTION_TEST_RETURN(NULL);
 }
 
-void
-cmdArchiveGetAsync(void)
+/***********************************************************************************************************************************
+Get a list of WAL segments in parallel and write status files for any that are missing or errored. Returns true if all WAL segments
+were found. The local processes are cached by the protocol helper so they are reused for each list processed by the async process.
+***********************************************************************************************************************************/
+static bool
+archiveGetAsyncList(const StringList *walSegmentList)
 {
-    FUNCTION_LOG_VOID(logLevelDebug);
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, walSegmentList);
+    FUNCTION_LOG_END();
 
-    // PostgreSQL must be local
-    pgIsLocalVerify();
+    ASSERT(walSegmentList != NULL);
+
+    bool result = true;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        TRY_BEGIN()
+        ArchiveGetAsyncData jobData = {.walSegmentList = walSegmentList};
+
+        LOG_INFO_FMT(
+            "get %u WAL file(s) from archive: %s%s",
+            strLstSize(jobData.walSegmentList), strPtr(strLstGet(jobData.walSegmentList, 0)),
+            strLstSize(jobData.walSegmentList) == 1 ?
+                "" :
+                strPtr(strNewFmt("...%s", strPtr(strLstGet(jobData.walSegmentList, strLstSize(jobData.walSegmentList) - 1)))));
+
+        // Create the parallel executor.  There is no point in using more processes than there are WAL segments to get.
+        ProtocolParallel *parallelExec = protocolParallelNew(
+            (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2, cfgOptionUInt(cfgOptProcessQueueMax),
+            archiveGetAsyncCallback, &jobData);
+
+        unsigned int processMax = cfgOptionUInt(cfgOptProcessMax);
+
+        if (processMax > strLstSize(jobData.walSegmentList))
+            processMax = strLstSize(jobData.walSegmentList);
+
+        // Start all local processes before adding them so they initialize concurrently
+        for (unsigned int processIdx = 1; processIdx <= processMax; processIdx++)
+            protocolLocalStart(protocolStorageTypeRepo, 1, processIdx);
+
+        for (unsigned int processIdx = 1; processIdx <= processMax; processIdx++)
+            protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 1, processIdx));
+
+        // Process jobs
+        do
         {
-            // Check the parameters
-            ArchiveGetAsyncData jobData = {.walSegmentList = cfgCommandParam()};
+            unsigned int completed = protocolParallelProcess(parallelExec);
 
-            if (strLstSize(jobData.walSegmentList) < 1)
-                THROW(ParamInvalidError, "at least one wal segment is required");
+            for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+            {
+                // Get the job and job key
+                ProtocolParallelJob *job = protocolParallelResult(parallelExec);
+                unsigned int processId = protocolParallelJobProcessId(job);
+                const String *walSegment = varStr(protocolParallelJobKey(job));
+
+                // The job was successful
+                if (protocolParallelJobErrorCode(job) == 0)
+                {
+                    // Get the archive file
+                    if (varIntForce(protocolParallelJobResult(job)) == 0)
+                    {
+                        LOG_DETAIL_PID_FMT(processId, "found %s in the archive", strPtr(walSegment));
+                    }
+                    // If it does not exist write an ok file to indicate that it was checked
+                    else
+                    {
+                        LOG_DETAIL_PID_FMT(processId, "unable to find %s in the archive", strPtr(walSegment));
+                        archiveAsyncStatusOkWrite(archiveModeGet, walSegment, NULL);
+                        result = false;
+                    }
+                }
+                // Else the job errored
+                else
+                {
+                    LOG_WARN_PID_FMT(
+                        processId,
+                        "could not get %s from the archive (will be retried): [%d] %s", strPtr(walSegment),
+                        protocolParallelJobErrorCode(job), strPtr(protocolParallelJobErrorMessage(job)));
+
+                    archiveAsyncStatusErrorWrite(
+                        archiveModeGet, walSegment, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
+                    result = false;
+                }
 
-            LOG_INFO_FMT(
-                "get %u WAL file(s) from archive: %s%s",
-                strLstSize(jobData.walSegmentList), strPtr(strLstGet(jobData.walSegmentList, 0)),
-                strLstSize(jobData.walSegmentList) == 1 ?
-                    "" :
-                    strPtr(strNewFmt("...%s", strPtr(strLstGet(jobData.walSegmentList, strLstSize(jobData.walSegmentList) - 1)))));
+                protocolParallelJobFree(job);
+            }
+        }
+        while (!protocolParallelDone(parallelExec));
+    }
+    MEM_CONTEXT_TEMP_END();
 
-            // Create the parallel executor
-            ProtocolParallel *parallelExec = protocolParallelNew(
-                (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2, archiveGetAsyncCallback, &jobData);
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
 
-            for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
-                protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 1, processIdx));
+/***********************************************************************************************************************************
+Keep the queue filled as PostgreSQL consumes WAL
 
-            // Process jobs
-            do
+The depth of the queue is sized by the observed rate of consumption and the time it takes to fetch a WAL segment, up to
+archive-get-queue-max. Prefetching stops when a WAL segment cannot be found (or errors), when nothing has been consumed for
+archive-timeout, or when archive-get is waiting on a WAL segment that is not in the queue (e.g. after a timeline switch). In the
+last case the lock is released on exit so archive-get can launch a new async process with the correct queue. The lock held is the
+archive-get lock rather than the archive lock so archive-push can launch its own async process while prefetch is running.
+***********************************************************************************************************************************/
+static void
+archiveGetAsyncPrefetch(const StringList *walSegmentList, TimeMSec fetchTime)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, walSegmentList);
+        FUNCTION_LOG_PARAM(UINT64, fetchTime);
+    FUNCTION_LOG_END();
+
+    ASSERT(walSegmentList != NULL);
+    ASSERT(strLstSize(walSegmentList) > 0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        PgControl pgControl = pgControlFromFile(storagePg());
+
+        unsigned int queueTotalMax = (unsigned int)(cfgOptionUInt64(cfgOptArchiveGetQueueMax) / pgControl.walSegmentSize);
+
+        if (queueTotalMax < 2)
+            queueTotalMax = 2;
+
+        // WAL segments that have been fetched but not consumed yet, in the order that PostgreSQL will request them. WAL segments
+        // kept in the spool by archive-get were not requested so they are added here in order to be counted when consumed.
+        StringList *queue = strLstDup(walSegmentList);
+        StringList *spoolList = storageListP(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR, .expression = WAL_SEGMENT_REGEXP_STR, .errorOnMissing = true);
+
+        for (unsigned int spoolIdx = 0; spoolIdx < strLstSize(spoolList); spoolIdx++)
+        {
+            if (!strLstExists(queue, strLstGet(spoolList, spoolIdx)))
+                strLstAdd(queue, strLstGet(spoolList, spoolIdx));
+        }
+
+        strLstSort(queue, sortOrderAsc);
+
+        String *walSegmentNextGet = walSegmentNext(
+            strLstGet(queue, strLstSize(queue) - 1), pgControl.walSegmentSize, pgControl.version);
+
+        TimeMSec idleTimeout = (TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC);
+        TimeMSec consumeTime = 0;
+        TimeMSec consumeLast = timeMSec();
+        bool done = false;
+
+        do
+        {
+            sleepMSec(ARCHIVE_GET_PREFETCH_POLL_MSEC);
+
+            MEM_CONTEXT_TEMP_BEGIN()
             {
-                unsigned int completed = protocolParallelProcess(parallelExec);
+                StringList *spoolList = storageListP(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR, .errorOnMissing = true);
 
-                for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                // Check if archive-get is waiting on a WAL segment that will not be fetched
+                for (unsigned int spoolIdx = 0; spoolIdx < strLstSize(spoolList); spoolIdx++)
                 {
-                    // Get the job and job key
-                    ProtocolParallelJob *job = protocolParallelResult(parallelExec);
-                    unsigned int processId = protocolParallelJobProcessId(job);
-                    const String *walSegment = varStr(protocolParallelJobKey(job));
+                    const String *file = strLstGet(spoolList, spoolIdx);
 
-                    // The job was successful
-                    if (protocolParallelJobErrorCode(job) == 0)
+                    if (strEndsWithZ(file, STATUS_EXT_PENDING))
                     {
-                        // Get the archive file
-                        if (varIntForce(protocolParallelJobResult(job)) == 0)
+                        const String *walSegment = strSubN(file, 0, strSize(file) - STATUS_EXT_PENDING_SIZE);
+
+                        if (!strEq(walSegment, walSegmentNextGet) && !strLstExists(queue, walSegment))
                         {
-                            LOG_DETAIL_PID_FMT(processId, "found %s in the archive", strPtr(walSegment));
+                            LOG_DETAIL_FMT("%s is not in the prefetch queue", strPtr(walSegment));
+                            done = true;
+                            break;
                         }
-                        // If it does not exist write an ok file to indicate that it was checked
-                        else
+                    }
+                }
+
+                if (!done)
+                {
+                    // Count WAL segments that have been consumed from the head of the queue
+                    unsigned int consumed = 0;
+
+                    while (consumed < strLstSize(queue) && !strLstExists(spoolList, strLstGet(queue, consumed)))
+                        consumed++;
+
+                    TimeMSec timeNow = timeMSec();
+
+                    if (consumed > 0)
+                    {
+                        TimeMSec consumeSample = (timeNow - consumeLast) / consumed;
+
+                        consumeTime = queuePrefetchTimeAvg(consumeTime, consumeSample == 0 ? 1 : consumeSample);
+                        consumeLast = timeNow;
+
+                        // Rebuild the queue without the consumed WAL segments
+                        MEM_CONTEXT_PRIOR_BEGIN()
                         {
-                            LOG_DETAIL_PID_FMT(processId, "unable to find %s in the archive", strPtr(walSegment));
-                            archiveAsyncStatusOkWrite(archiveModeGet, walSegment, NULL);
+                            StringList *queueNew = strLstNew();
+
+                            for (unsigned int queueIdx = consumed; queueIdx < strLstSize(queue); queueIdx++)
+                                strLstAdd(queueNew, strLstGet(queue, queueIdx));
+
+                            strLstFree(queue);
+                            queue = queueNew;
                         }
+                        MEM_CONTEXT_PRIOR_END();
                     }
-                    // Else the job errored
-                    else
+                    // Else stop if nothing has been consumed for a while
+                    else if (timeNow - consumeLast >= idleTimeout)
                     {
-                        LOG_WARN_PID_FMT(
-                            processId,
-                            "could not get %s from the archive (will be retried): [%d] %s", strPtr(walSegment),
-                            protocolParallelJobErrorCode(job), strPtr(protocolParallelJobErrorMessage(job)));
-
-                        archiveAsyncStatusErrorWrite(
-                            archiveModeGet, walSegment, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
+                        LOG_DETAIL("no WAL consumed from the queue, stop prefetch");
+                        done = true;
                     }
+                }
+
+                // Get more WAL segments if the queue is below the current target
+                unsigned int queueTotal = queuePrefetchTotal(consumeTime, fetchTime, queueTotalMax);
 
-                    protocolParallelJobFree(job);
+                if (!done && strLstSize(queue) < queueTotal)
+                {
+                    StringList *getList = walSegmentRange(
+                        walSegmentNextGet, pgControl.walSegmentSize, pgControl.version, queueTotal - strLstSize(queue));
+
+                    TimeMSec timeBegin = timeMSec();
+                    done = !archiveGetAsyncList(getList);
+
+                    // Average time to fetch one WAL segment on one process
+                    unsigned int processTotal = cfgOptionUInt(cfgOptProcessMax);
+
+                    if (processTotal > strLstSize(getList))
+                        processTotal = strLstSize(getList);
+
+                    fetchTime = queuePrefetchTimeAvg(fetchTime, (timeMSec() - timeBegin) * processTotal / strLstSize(getList));
+
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        for (unsigned int getIdx = 0; getIdx < strLstSize(getList); getIdx++)
+                            strLstAdd(queue, strLstGet(getList, getIdx));
+
+                        strFree(walSegmentNextGet);
+                        walSegmentNextGet = walSegmentNext(
+                            strLstGet(getList, strLstSize(getList) - 1), pgControl.walSegmentSize, pgControl.version);
+                    }
+                    MEM_CONTEXT_PRIOR_END();
                 }
             }
-            while (!protocolParallelDone(parallelExec));
+            MEM_CONTEXT_TEMP_END();
+        }
+        while (!done);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+void
+cmdArchiveGetAsync(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    // PostgreSQL must be local
+    pgIsLocalVerify();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TRY_BEGIN()
+        {
+            // Check the parameters
+            const StringList *walSegmentList = cfgCommandParam();
+
+            if (strLstSize(walSegmentList) < 1)
+                THROW(ParamInvalidError, "at least one wal segment is required");
+
+            // Get the WAL segments requested and if they were all found continue to prefetch as they are consumed
+            TimeMSec timeBegin = timeMSec();
+
+            if (archiveGetAsyncList(walSegmentList))
+            {
+                unsigned int processTotal = cfgOptionUInt(cfgOptProcessMax);
+
+                if (processTotal > strLstSize(walSegmentList))
+                    processTotal = strLstSize(walSegmentList);
+
+                archiveGetAsyncPrefetch(walSegmentList, (timeMSec() - timeBegin) * processTotal / strLstSize(walSegmentList));
+            }
         }
         // On any global error write a single error file to cover all unprocessed files
         CATCH_ANY()
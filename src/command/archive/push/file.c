@@ -20,7 +20,7 @@ Archive Push File
 String *
 archivePushFile(
     const String *walSource, const String *archiveId, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile,
-    CipherType cipherType, const String *cipherPass, CompressType compressType, int compressLevel)
+    CipherType cipherType, const String *cipherPass, CompressType compressType, int compressLevel, bool compressDict)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, walSource);
@@ -32,6 +32,7 @@ archivePushFile(
         FUNCTION_TEST_PARAM(STRING, cipherPass);
         FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(INT, compressLevel);
+        FUNCTION_LOG_PARAM(BOOL, compressDict);
     FUNCTION_LOG_END();
 
     ASSERT(walSource != NULL);
@@ -109,11 +110,15 @@ archivePushFile(
             // Is the file compressible during the copy?
             bool compressible = true;
 
-            // If the file will be compressed then add compression filter
+            // If the file will be compressed then add compression filter. Use the dictionary when requested and it exists.
             if (isSegment && compressType != compressTypeNone)
             {
                 compressExtCat(archiveDestination, compressType);
-                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), compressFilter(compressType, compressLevel));
+                ioFilterGroupAdd(
+                    ioReadFilterGroup(storageReadIo(source)),
+                    compressFilterDict(
+                        compressType, compressLevel,
+                        compressDict && compressTypeDict(compressType) ? archiveDict(cipherType, cipherPass) : NULL));
                 compressible = false;
             }
 
@@ -3,9 +3,15 @@ Archive Push Command
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <errno.h>
+#include <poll.h>
 #include <string.h>
 #include <unistd.h>
 
+#ifdef __linux__
+    #include <sys/inotify.h>
+#endif
+
 #include "command/archive/common.h"
 #include "command/archive/push/file.h"
 #include "command/archive/push/protocol.h"
@@ -15,6 +21,7 @@ Archive Push Command
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/time.h"
 #include "common/wait.h"
 #include "config/config.h"
 #include "config/exec.h"
@@ -30,6 +37,11 @@ Ready file extension constants
 #define STATUS_EXT_READY                                            ".ready"
 #define STATUS_EXT_READY_SIZE                                       (sizeof(STATUS_EXT_READY) - 1)
 
+/***********************************************************************************************************************************
+How long to wait for ready files on each pass while watching archive_status
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_WATCH_POLL_MSEC                                100
+
 /***********************************************************************************************************************************
 Format the warning when a file is dropped
 ***********************************************************************************************************************************/
@@ -180,6 +192,153 @@ archivePushProcessList(const String *walPath)
     FUNCTION_LOG_RETURN(STRING_LIST, result);
 }
 
+/***********************************************************************************************************************************
+Watch archive_status for WAL files that become ready while the async process is running
+
+On Linux inotify is used to get ready files as soon as PostgreSQL creates them, without listing archive_status (which can be
+expensive when it is large). When inotify is not available (or the event queue overflows) archive_status is listed instead.
+***********************************************************************************************************************************/
+static int
+archivePushWatchNew(const String *walPath)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+    FUNCTION_LOG_END();
+
+    ASSERT(walPath != NULL);
+
+    int result = -1;
+
+#ifdef __linux__
+    result = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    // Watch for ready files being created (or renamed into place) and removed (or renamed to done) by PostgreSQL
+    if (result != -1)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            if (inotify_add_watch(
+                    result, strPtr(storagePathP(storagePg(), strNewFmt("%s/" PG_PATH_ARCHIVE_STATUS, strPtr(walPath)))),
+                    IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM) == -1)
+            {
+                close(result);
+                result = -1;
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+#endif
+
+    if (result == -1)
+        LOG_DEBUG("unable to watch " PG_PATH_ARCHIVE_STATUS ", list it instead");
+
+    FUNCTION_LOG_RETURN(INT, result);
+}
+
+// Wait up to timeout for WAL files to become ready and return the ones that have not been pushed yet
+static StringList *
+archivePushWatchReady(int handle, const String *walPath, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, handle);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(walPath != NULL);
+
+    StringList *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        bool list = true;
+
+#ifdef __linux__
+        if (handle != -1)
+        {
+            list = false;
+            result = strLstNew();
+
+            struct pollfd inputFd = {.fd = handle, .events = POLLIN};
+            THROW_ON_SYS_ERROR(poll(&inputFd, 1, (int)timeout) == -1, FileReadError, "unable to poll " PG_PATH_ARCHIVE_STATUS);
+
+            // Read all available events
+            union
+            {
+                struct inotify_event event;                         // Ensure the buffer is aligned for events
+                char buffer[4096];
+            } eventBuffer;
+
+            ssize_t eventSize;
+
+            while ((eventSize = read(handle, eventBuffer.buffer, sizeof(eventBuffer.buffer))) > 0)
+            {
+                for (char *eventPtr = eventBuffer.buffer; eventPtr < eventBuffer.buffer + eventSize;)
+                {
+                    const struct inotify_event *event = (const struct inotify_event *)eventPtr;
+                    eventPtr += sizeof(struct inotify_event) + event->len;
+
+                    // If events were lost then list archive_status to be sure nothing is missed
+                    if (event->mask & IN_Q_OVERFLOW)
+                    {
+                        list = true;
+                        continue;
+                    }
+
+                    if (event->len == 0 || !strEndsWithZ(STR(event->name), STATUS_EXT_READY))
+                        continue;
+
+                    String *walFile = strNewN(event->name, strlen(event->name) - STATUS_EXT_READY_SIZE);
+
+                    // Add new ready files to the list
+                    if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                    {
+                        if (!strLstExists(result, walFile))
+                            strLstAdd(result, walFile);
+                    }
+                    // Else PostgreSQL has acknowledged the WAL file so the ok file is no longer needed
+                    else
+                    {
+                        strLstRemove(result, walFile);
+                        storageRemoveP(
+                            storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_OUT "/%s" STATUS_EXT_OK, strPtr(walFile)));
+                    }
+                }
+            }
+
+            THROW_ON_SYS_ERROR(
+                eventSize == -1 && errno != EAGAIN, FileReadError, "unable to read " PG_PATH_ARCHIVE_STATUS " events");
+
+            // Skip ready files that have already been pushed, e.g. created while the async process was starting
+            if (!list)
+            {
+                StringList *readyList = strLstNew();
+
+                for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(result); walFileIdx++)
+                {
+                    const String *walFile = strLstGet(result, walFileIdx);
+
+                    if (!storageExistsP(storageSpool(), strNewFmt(STORAGE_SPOOL_ARCHIVE_OUT "/%s" STATUS_EXT_OK, strPtr(walFile))))
+                        strLstAdd(readyList, walFile);
+                }
+
+                result = strLstSort(readyList, sortOrderAsc);
+            }
+        }
+        else
+#endif
+            sleepMSec(timeout);
+
+        if (list)
+            result = archivePushProcessList(walPath);
+
+        strLstMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
 /***********************************************************************************************************************************
 Check that pg_control and archive.info match and get the archive id and archive cipher passphrase (if present)
 
@@ -361,11 +520,23 @@ cmdArchivePush(void)
             // Else push the file
             else
             {
+                CompressType compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType));
+                bool compressDict = cfgOptionBool(cfgOptArchiveCompressDict) && compressTypeDict(compressType);
+
+                // Train the compression dictionary if it does not exist
+                if (compressDict && walIsSegment(archiveFile))
+                {
+                    StringList *walSourceList = strLstNew();
+                    strLstAdd(walSourceList, walFile);
+
+                    archiveDictTrain(walSourceList, cipherType(cfgOptionStr(cfgOptRepoCipherType)), archiveInfo.archiveCipherPass);
+                }
+
                 // Push the file to the archive
                 String *warning = archivePushFile(
                     walFile, archiveInfo.archiveId, archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
-                    cipherType(cfgOptionStr(cfgOptRepoCipherType)), archiveInfo.archiveCipherPass,
-                    compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel));
+                    cipherType(cfgOptionStr(cfgOptRepoCipherType)), archiveInfo.archiveCipherPass, compressType,
+                    cfgOptionInt(cfgOptCompressLevel), compressDict);
 
                 // If a warning was returned then log it
                 if (warning != NULL)
@@ -390,6 +561,8 @@ typedef struct ArchivePushAsyncData
     CipherType cipherType;                                          // Cipher type
     CompressType compressType;                                      // Type of compression for WAL segments
     int compressLevel;                                              // Compression level for wal files
+    bool compressDict;                                              // Compress wal files with a dictionary?
+    bool archiveInfoLoaded;                                         // Has archive info been loaded?
     ArchivePushCheckResult archiveInfo;                             // Archive info
 } ArchivePushAsyncData;
 
@@ -421,6 +594,7 @@ static ProtocolParallelJob *archivePushAsyncCallback(void *data, unsigned int cl
         protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.archiveCipherPass));
         protocolCommandParamAdd(command, VARUINT(jobData->compressType));
         protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+        protocolCommandParamAdd(command, VARBOOL(jobData->compressDict));
 
         FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(walFile), command));
     }
@@ -428,6 +602,188 @@ static ProtocolParallelJob *archivePushAsyncCallback(void *data, unsigned int cl
     FUNCTION_TEST_RETURN(NULL);
 }
 
+/***********************************************************************************************************************************
+Push a list of WAL files to the archive in parallel. Returns false if any WAL file could not be pushed.
+***********************************************************************************************************************************/
+static bool
+archivePushAsyncList(ArchivePushAsyncData *jobData, const StringList *walFileList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+        FUNCTION_LOG_PARAM(STRING_LIST, walFileList);
+    FUNCTION_LOG_END();
+
+    ASSERT(jobData != NULL);
+    ASSERT(walFileList != NULL && strLstSize(walFileList) > 0);
+
+    bool result = true;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        jobData->walFileList = walFileList;
+        jobData->walFileIdx = 0;
+
+        LOG_INFO_FMT(
+            "push %u WAL file(s) to archive: %s%s", strLstSize(jobData->walFileList), strPtr(strLstGet(jobData->walFileList, 0)),
+            strLstSize(jobData->walFileList) == 1 ?
+                "" : strPtr(strNewFmt("...%s", strPtr(strLstGet(jobData->walFileList, strLstSize(jobData->walFileList) - 1)))));
+
+        // Drop files if queue max has been exceeded
+        if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData->walPath, jobData->walFileList))
+        {
+            for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData->walFileList); walFileIdx++)
+            {
+                const String *walFile = strLstGet(jobData->walFileList, walFileIdx);
+                const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
+
+                archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
+                LOG_WARN(strPtr(warning));
+            }
+        }
+        // Else continue processing
+        else
+        {
+            // Archive info only needs to be loaded once no matter how many lists are pushed
+            if (!jobData->archiveInfoLoaded)
+            {
+                MEM_CONTEXT_PRIOR_BEGIN()
+                {
+                    // Get the repo storage in case it is remote and encryption settings need to be pulled down
+                    storageRepo();
+
+                    // Get cipher type
+                    jobData->cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType));
+
+                    // Get archive info
+                    jobData->archiveInfo = archivePushCheck(
+                        true, cipherType(cfgOptionStr(cfgOptRepoCipherType)), cfgOptionStrNull(cfgOptRepoCipherPass));
+                    jobData->archiveInfoLoaded = true;
+                }
+                MEM_CONTEXT_PRIOR_END();
+            }
+
+            // Train the compression dictionary from the WAL segments if it does not exist. This is done before the jobs start so
+            // all the local processes load the same dictionary.
+            if (jobData->compressDict)
+            {
+                StringList *walSourceList = strLstNew();
+
+                for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData->walFileList); walFileIdx++)
+                {
+                    const String *walFile = strLstGet(jobData->walFileList, walFileIdx);
+
+                    if (walIsSegment(walFile))
+                        strLstAdd(walSourceList, strNewFmt("%s/%s", strPtr(jobData->walPath), strPtr(walFile)));
+                }
+
+                if (strLstSize(walSourceList) > 0)
+                    archiveDictTrain(walSourceList, jobData->cipherType, jobData->archiveInfo.archiveCipherPass);
+            }
+
+            // Create the parallel executor
+            ProtocolParallel *parallelExec = protocolParallelNew(
+                (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2, cfgOptionUInt(cfgOptProcessQueueMax),
+                archivePushAsyncCallback, jobData);
+
+            // Start all local processes before adding them so they initialize concurrently
+            for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+                protocolLocalStart(protocolStorageTypeRepo, 1, processIdx);
+
+            for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+                protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 1, processIdx));
+
+            // Process jobs
+            do
+            {
+                unsigned int completed = protocolParallelProcess(parallelExec);
+
+                for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                {
+                    protocolKeepAlive();
+
+                    // Get the job and job key
+                    ProtocolParallelJob *job = protocolParallelResult(parallelExec);
+                    unsigned int processId = protocolParallelJobProcessId(job);
+                    const String *walFile = varStr(protocolParallelJobKey(job));
+
+                    // The job was successful
+                    if (protocolParallelJobErrorCode(job) == 0)
+                    {
+                        LOG_DETAIL_PID_FMT(processId, "pushed WAL file '%s' to the archive", strPtr(walFile));
+                        archiveAsyncStatusOkWrite(archiveModePush, walFile, varStr(protocolParallelJobResult(job)));
+                    }
+                    // Else the job errored
+                    else
+                    {
+                        LOG_WARN_PID_FMT(
+                            processId,
+                            "could not push WAL file '%s' to the archive (will be retried): [%d] %s", strPtr(walFile),
+                            protocolParallelJobErrorCode(job), strPtr(protocolParallelJobErrorMessage(job)));
+
+                        archiveAsyncStatusErrorWrite(
+                            archiveModePush, walFile, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
+
+                        result = false;
+                    }
+
+                    protocolParallelJobFree(job);
+                }
+            }
+            while (!protocolParallelDone(parallelExec));
+        }
+
+        jobData->walFileList = NULL;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/***********************************************************************************************************************************
+Keep pushing WAL files as they become ready until none have been ready for archive-timeout. This saves starting a new async process
+(and the local processes) for every WAL file when archiving is steady. Watching stops when a WAL file cannot be pushed so the next
+archive_command can report the error and start a new async process to retry. The archive lock is held while watching so
+archive-push does not launch another async process, but archive-get takes a separate lock so it is not blocked.
+***********************************************************************************************************************************/
+static void
+archivePushAsyncWatch(ArchivePushAsyncData *jobData, int watchHandle)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+        FUNCTION_LOG_PARAM(INT, watchHandle);
+    FUNCTION_LOG_END();
+
+    ASSERT(jobData != NULL);
+
+    TimeMSec timeout = (TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC);
+    TimeMSec timeBegin = timeMSec();
+
+    do
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Test for stop file
+            lockStopTest();
+
+            StringList *walFileList = archivePushWatchReady(watchHandle, jobData->walPath, ARCHIVE_PUSH_WATCH_POLL_MSEC);
+
+            if (strLstSize(walFileList) > 0)
+            {
+                if (!archivePushAsyncList(jobData, walFileList))
+                    timeout = 0;
+
+                timeBegin = timeMSec();
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+    while (timeMSec() - timeBegin < timeout);
+
+    LOG_DETAIL("stop watching " PG_PATH_ARCHIVE_STATUS " for WAL files to push");
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 void
 cmdArchivePushAsync(void)
 {
@@ -453,92 +809,28 @@ cmdArchivePushAsync(void)
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
         };
 
+        jobData.compressDict = cfgOptionBool(cfgOptArchiveCompressDict) && compressTypeDict(jobData.compressType);
+
+        int watchHandle = -1;
+
         TRY_BEGIN()
         {
             // Test for stop file
             lockStopTest();
 
+            // Start watching archive_status before it is listed so no ready files are missed in between
+            watchHandle = archivePushWatchNew(jobData.walPath);
+
             // Get a list of WAL files that are ready for processing
-            jobData.walFileList = archivePushProcessList(jobData.walPath);
+            const StringList *walFileList = archivePushProcessList(jobData.walPath);
 
             // The archive-push:async command should not have been called unless there are WAL files to process
-            if (strLstSize(jobData.walFileList) == 0)
+            if (strLstSize(walFileList) == 0)
                 THROW(AssertError, "no WAL files to process");
 
-            LOG_INFO_FMT(
-                "push %u WAL file(s) to archive: %s%s", strLstSize(jobData.walFileList), strPtr(strLstGet(jobData.walFileList, 0)),
-                strLstSize(jobData.walFileList) == 1 ?
-                    "" : strPtr(strNewFmt("...%s", strPtr(strLstGet(jobData.walFileList, strLstSize(jobData.walFileList) - 1)))));
-
-            // Drop files if queue max has been exceeded
-            if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData.walPath, jobData.walFileList))
-            {
-                for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData.walFileList); walFileIdx++)
-                {
-                    const String *walFile = strLstGet(jobData.walFileList, walFileIdx);
-                    const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
-
-                    archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
-                    LOG_WARN(strPtr(warning));
-                }
-            }
-            // Else continue processing
-            else
-            {
-                // Get the repo storage in case it is remote and encryption settings need to be pulled down
-                storageRepo();
-
-                // Get cipher type
-                jobData.cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType));
-
-                // Get archive info
-                jobData.archiveInfo = archivePushCheck(
-                    true, cipherType(cfgOptionStr(cfgOptRepoCipherType)), cfgOptionStrNull(cfgOptRepoCipherPass));
-
-                // Create the parallel executor
-                ProtocolParallel *parallelExec = protocolParallelNew(
-                    (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2, archivePushAsyncCallback, &jobData);
-
-                for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
-                    protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 1, processIdx));
-
-                // Process jobs
-                do
-                {
-                    unsigned int completed = protocolParallelProcess(parallelExec);
-
-                    for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
-                    {
-                        protocolKeepAlive();
-
-                        // Get the job and job key
-                        ProtocolParallelJob *job = protocolParallelResult(parallelExec);
-                        unsigned int processId = protocolParallelJobProcessId(job);
-                        const String *walFile = varStr(protocolParallelJobKey(job));
-
-                        // The job was successful
-                        if (protocolParallelJobErrorCode(job) == 0)
-                        {
-                            LOG_DETAIL_PID_FMT(processId, "pushed WAL file '%s' to the archive", strPtr(walFile));
-                            archiveAsyncStatusOkWrite(archiveModePush, walFile, varStr(protocolParallelJobResult(job)));
-                        }
-                        // Else the job errored
-                        else
-                        {
-                            LOG_WARN_PID_FMT(
-                                processId,
-                                "could not push WAL file '%s' to the archive (will be retried): [%d] %s", strPtr(walFile),
-                                protocolParallelJobErrorCode(job), strPtr(protocolParallelJobErrorMessage(job)));
-
-                            archiveAsyncStatusErrorWrite(
-                                archiveModePush, walFile, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
-                        }
-
-                        protocolParallelJobFree(job);
-                    }
-                }
-                while (!protocolParallelDone(parallelExec));
-            }
+            // Push the WAL files and then keep pushing new ones as they become ready
+            if (archivePushAsyncList(&jobData, walFileList))
+                archivePushAsyncWatch(&jobData, watchHandle);
         }
         // On any global error write a single error file to cover all unprocessed files
         CATCH_ANY()
@@ -546,6 +838,11 @@ cmdArchivePushAsync(void)
             archiveAsyncStatusErrorWrite(archiveModePush, NULL, errorCode(), STR(errorMessage()));
             RETHROW();
         }
+        FINALLY()
+        {
+            if (watchHandle != -1)
+                close(watchHandle);
+        }
         TRY_END();
     }
     MEM_CONTEXT_TEMP_END();
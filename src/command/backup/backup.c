@@ -1050,6 +1050,92 @@ backupStop(BackupData *backupData, Manifest *manifest)
     FUNCTION_LOG_RETURN(BACKUP_STOP_RESULT, result);
 }
 
+/***********************************************************************************************************************************
+Find WAL segments required to make the backup consistent while files are being copied. Segments found here do not need to be found
+again after the backup stops, so only the segments archived near the end of the backup are left to check.
+***********************************************************************************************************************************/
+#define BACKUP_ARCHIVE_FIND_MSEC                                    5000
+
+typedef struct BackupArchiveFind
+{
+    const String *archiveId;                                        // Archive id (NULL when the archive is not checked)
+    unsigned int pgVersion;                                         // PostgreSQL version
+    unsigned int timeline;                                          // Timeline of the backup
+    unsigned int walSegmentSize;                                    // WAL segment size
+    uint64_t lsnNext;                                               // Lsn of the next segment to find
+    StringList *archiveFileList;                                    // Archive files found so far in segment order
+    TimeMSec timeLast;                                              // Time of the last search
+} BackupArchiveFind;
+
+#define FUNCTION_LOG_BACKUP_ARCHIVE_FIND_TYPE                                                                                      \
+    BackupArchiveFind
+#define FUNCTION_LOG_BACKUP_ARCHIVE_FIND_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(&value, "BackupArchiveFind", buffer, bufferSize)
+
+static BackupArchiveFind
+backupArchiveFindInit(const BackupData *backupData, const BackupStartResult *backupStartResult)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
+        FUNCTION_LOG_PARAM_P(VOID, backupStartResult);
+    FUNCTION_LOG_END();
+
+    ASSERT(backupData != NULL);
+    ASSERT(backupStartResult != NULL);
+
+    BackupArchiveFind result = {.archiveId = NULL};
+
+    if (cfgOptionBool(cfgOptOnline) && cfgOptionBool(cfgOptArchiveCheck))
+    {
+        result.archiveId = infoArchiveId(
+            infoArchiveLoadFile(
+                storageRepo(), INFO_ARCHIVE_PATH_FILE_STR, cipherType(cfgOptionStr(cfgOptRepoCipherType)),
+                cfgOptionStrNull(cfgOptRepoCipherPass)));
+        result.pgVersion = backupData->version;
+        result.timeline = cvtZToUIntBase(strPtr(strSubN(backupStartResult->walSegmentName, 0, 8)), 16);
+        result.walSegmentSize = backupData->walSegmentSize;
+        result.lsnNext = pgLsnFromStr(backupStartResult->lsn);
+        result.lsnNext -= result.lsnNext % result.walSegmentSize;
+        result.archiveFileList = strLstNew();
+    }
+
+    FUNCTION_LOG_RETURN(BACKUP_ARCHIVE_FIND, result);
+}
+
+// Find segments that have already been archived, starting from the next segment and continuing to the end of its path
+static void
+backupArchiveFindNext(BackupArchiveFind *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    if (this->archiveId != NULL && timeMSec() - this->timeLast >= BACKUP_ARCHIVE_FIND_MSEC)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            uint64_t lsnPathEnd = this->lsnNext | 0xFFFFFFFF;
+            const StringList *walSegmentList = pgLsnRangeToWalSegmentList(
+                this->pgVersion, this->timeline, this->lsnNext, lsnPathEnd, this->walSegmentSize);
+            const StringList *archiveFileList = walSegmentFindList(storageRepo(), this->archiveId, walSegmentList, 0);
+
+            for (unsigned int archiveFileIdx = 0; archiveFileIdx < strLstSize(archiveFileList); archiveFileIdx++)
+                strLstAdd(this->archiveFileList, strLstGet(archiveFileList, archiveFileIdx));
+
+            // Move to the next path when all the segments in this path have been found
+            this->lsnNext = strLstSize(archiveFileList) == strLstSize(walSegmentList) ?
+                lsnPathEnd + 1 : this->lsnNext + strLstSize(archiveFileList) * this->walSegmentSize;
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        this->timeLast = timeMSec();
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Log the results of a job and throw errors
 ***********************************************************************************************************************************/
@@ -1185,16 +1271,15 @@ backupJobResult(
                                     ASSERT(varLstSize(errorItemList) == 2);
 
                                     strCatFmt(
-                                        error, "%" PRIu64 "-%" PRIu64, varUInt64(varLstGet(errorItemList, 0)),
-                                        varUInt64(varLstGet(errorItemList, 1)));
+                                        error, "%u-%u", varUInt(varLstGet(errorItemList, 0)), varUInt(varLstGet(errorItemList, 1)));
                                     errorTotalMin += 2;
                                 }
                                 // Else a single error
                                 else
                                 {
-                                    ASSERT(varType(errorItem) == varTypeUInt64);
+                                    ASSERT(varType(errorItem) == varTypeUInt);
 
-                                    strCatFmt(error, "%" PRIu64, varUInt64(errorItem));
+                                    strCatFmt(error, "%u", varUInt(errorItem));
                                     errorTotalMin++;
                                 }
                             }
@@ -1516,16 +1601,20 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
 }
 
 static void
-backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart, const String *cipherPassBackup)
+backupProcess(
+    BackupData *backupData, Manifest *manifest, const String *lsnStart, const String *cipherPassBackup,
+    BackupArchiveFind *archiveFind)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM(STRING, lsnStart);
         FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+        FUNCTION_LOG_PARAM_P(VOID, archiveFind);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
+    ASSERT(archiveFind != NULL);
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
@@ -1591,16 +1680,22 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
 
         // Create the parallel executor
         ProtocolParallel *parallelExec = protocolParallelNew(
-            (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2, backupJobCallback, &jobData);
+            (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2, cfgOptionUInt(cfgOptProcessQueueMax),
+            backupJobCallback, &jobData);
 
-        // First client is always on the primary
-        protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, backupData->pgIdPrimary, 1));
-
-        // Create the rest of the clients on the primary or standby depending on the value of backup-standby.  Note that standby
-        // backups don't count the primary client in process-max.
+        // First client is always on the primary. Create the rest of the clients on the primary or standby depending on the value
+        // of backup-standby.  Note that standby backups don't count the primary client in process-max.
         unsigned int processMax = cfgOptionUInt(cfgOptProcessMax) + (backupStandby ? 1 : 0);
         unsigned int pgId = backupStandby ? backupData->pgIdStandby : backupData->pgIdPrimary;
 
+        // Start all local processes before adding them so they initialize concurrently
+        protocolLocalStart(protocolStorageTypePg, backupData->pgIdPrimary, 1);
+
+        for (unsigned int processIdx = 2; processIdx <= processMax; processIdx++)
+            protocolLocalStart(protocolStorageTypePg, pgId, processIdx);
+
+        protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, backupData->pgIdPrimary, 1));
+
         for (unsigned int processIdx = 2; processIdx <= processMax; processIdx++)
             protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, pgId, processIdx));
 
@@ -1639,6 +1734,9 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
                 // A keep-alive is required here for the remote holding open the backup connection
                 protocolKeepAlive();
 
+                // Find WAL segments that have already been archived while the copy is running
+                backupArchiveFindNext(archiveFind);
+
                 // Save the manifest periodically to preserve checksums for resume
                 if (sizeCopied - manifestSaveLast >= manifestSaveSize)
                 {
@@ -1719,16 +1817,70 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
 /***********************************************************************************************************************************
 Check and copy WAL segments required to make the backup consistent
 ***********************************************************************************************************************************/
+typedef struct BackupArchiveJobData
+{
+    const String *archiveId;                                        // Archive id where WAL segments are stored
+    const String *archiveCipherPass;                                // Passphrase of WAL segments in the archive
+    const String *backupLabel;                                      // Backup label (defines the backup path)
+    const String *walPath;                                          // WAL path in the backup
+    CompressType compressType;                                      // Backup compression type
+    int compressLevel;                                              // Compress level if backup is compressed
+    const String *cipherSubPass;                                    // Passphrase used to encrypt files in the backup
+    const StringList *archiveFileList;                              // Archive files to copy
+    unsigned int archiveFileIdx;                                    // Current index in the list to be processed
+} BackupArchiveJobData;
+
+static ProtocolParallelJob *backupArchiveJobCallback(void *data, unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+
+    // No special logic based on the client, we'll just get the next job
+    (void)clientIdx;
+
+    // Get a new job if there are any left
+    BackupArchiveJobData *jobData = data;
+
+    if (jobData->archiveFileIdx < strLstSize(jobData->archiveFileList))
+    {
+        const String *archiveFile = strLstGet(jobData->archiveFileList, jobData->archiveFileIdx);
+        jobData->archiveFileIdx++;
+
+        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_BACKUP_ARCHIVE_FILE_STR);
+        protocolCommandParamAdd(command, VARSTR(jobData->archiveId));
+        protocolCommandParamAdd(command, VARSTR(archiveFile));
+        protocolCommandParamAdd(command, VARSTR(jobData->archiveCipherPass));
+        protocolCommandParamAdd(
+            command, VARSTR(strNewFmt("%s/%s", strPtr(jobData->walPath), strPtr(strSubN(archiveFile, 0, 24)))));
+        protocolCommandParamAdd(command, VARUINT(jobData->compressType));
+        protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+        protocolCommandParamAdd(command, VARSTR(jobData->backupLabel));
+        protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
+
+        FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(archiveFile), command));
+    }
+
+    FUNCTION_TEST_RETURN(NULL);
+}
+
 static void
-backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const String *cipherPassBackup)
+backupArchiveCheckCopy(
+    Manifest *manifest, const BackupData *backupData, const BackupArchiveFind *archiveFind, const String *cipherPassBackup)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
-        FUNCTION_LOG_PARAM(UINT, walSegmentSize);
+        FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
+        FUNCTION_LOG_PARAM_P(VOID, archiveFind);
         FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
+    ASSERT(backupData != NULL);
+    ASSERT(archiveFind != NULL);
 
     // If archive logs are required to complete the backup, then check them.  This is the default, but can be overridden if the
     // archive logs are going to a different server.  Be careful of disabling this option because there is no way to verify that the
@@ -1740,6 +1892,7 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
             unsigned int timeline = cvtZToUIntBase(strPtr(strSubN(manifestData(manifest)->archiveStart, 0, 8)), 16);
             uint64_t lsnStart = pgLsnFromStr(manifestData(manifest)->lsnStart);
             uint64_t lsnStop = pgLsnFromStr(manifestData(manifest)->lsnStop);
+            unsigned int walSegmentSize = backupData->walSegmentSize;
 
             LOG_INFO_FMT(
                 "check archive for segment(s) %s:%s", strPtr(pgLsnToWalSegment(timeline, lsnStart, walSegmentSize)),
@@ -1751,7 +1904,7 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
             // Use base path to set ownership and mode
             const ManifestPath *basePath = manifestPathFind(manifest, MANIFEST_TARGET_PGDATA_STR);
 
-            // Loop through all the segments in the lsn range
+            // Get archive info
             InfoArchive *infoArchive = infoArchiveLoadFile(
                 storageRepo(), INFO_ARCHIVE_PATH_FILE_STR, cipherType(cfgOptionStr(cfgOptRepoCipherType)),
                 cfgOptionStrNull(cfgOptRepoCipherPass));
@@ -1760,77 +1913,99 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
             StringList *walSegmentList = pgLsnRangeToWalSegmentList(
                 manifestData(manifest)->pgVersion, timeline, lsnStart, lsnStop, walSegmentSize);
 
+            // Segments found while the backup was running do not need to be found again (unless the archive id has changed)
+            StringList *archiveFileList = strLstNew();
+            StringList *walSegmentRemainList = strLstNew();
+
             for (unsigned int walSegmentIdx = 0; walSegmentIdx < strLstSize(walSegmentList); walSegmentIdx++)
             {
-                const String *walSegment = strLstGet(walSegmentList, walSegmentIdx);
+                if (archiveFind->archiveId != NULL && strEq(archiveFind->archiveId, archiveId) &&
+                    walSegmentIdx < strLstSize(archiveFind->archiveFileList))
+                {
+                    strLstAdd(archiveFileList, strLstGet(archiveFind->archiveFileList, walSegmentIdx));
+                }
+                else
+                    strLstAdd(walSegmentRemainList, strLstGet(walSegmentList, walSegmentIdx));
+            }
+
+            // Find the rest of the segments in the archive, listing each archive path once
+            const StringList *archiveFileFoundList = walSegmentFindList(
+                storageRepo(), archiveId, walSegmentRemainList, (TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC));
 
-                // Find the actual wal segment file in the archive
-                const String *archiveFile = walSegmentFind(
-                    storageRepo(), archiveId, walSegment,  (TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC));
+            for (unsigned int archiveFileIdx = 0; archiveFileIdx < strLstSize(archiveFileFoundList); archiveFileIdx++)
+                strLstAdd(archiveFileList, strLstGet(archiveFileFoundList, archiveFileIdx));
 
-                if (cfgOptionBool(cfgOptArchiveCopy))
+            // Copy the segments into the backup in parallel
+            if (cfgOptionBool(cfgOptArchiveCopy))
+            {
+                BackupArchiveJobData jobData =
                 {
-                    // Get compression type of the WAL segment and backup
-                    CompressType archiveCompressType = compressTypeFromName(archiveFile);
-                    CompressType backupCompressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType));
-
-                    // Open the archive file
-                    StorageRead *read = storageNewReadP(
-                        storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(archiveFile)));
-                    IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(read));
-
-                    // Decrypt with archive key if encrypted
-                    cipherBlockFilterGroupAdd(
-                        filterGroup, cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherModeDecrypt,
-                        infoArchiveCipherPass(infoArchive));
-
-                    // Compress/decompress if archive and backup do not have the same compression settings
-                    if (archiveCompressType != backupCompressType)
-                    {
-                        if (archiveCompressType != compressTypeNone)
-                            ioFilterGroupAdd(filterGroup, decompressFilter(archiveCompressType));
+                    .archiveId = archiveId,
+                    .archiveCipherPass = infoArchiveCipherPass(infoArchive),
+                    .backupLabel = manifestData(manifest)->backupLabel,
+                    .walPath = strNewFmt(
+                        MANIFEST_TARGET_PGDATA "/%s", strPtr(pgWalPath(manifestData(manifest)->pgVersion))),
+                    .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
+                    .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+                    .cipherSubPass = manifestCipherSubPass(manifest),
+                    .archiveFileList = archiveFileList,
+                };
+
+                // Create the parallel executor using the same local processes that copied the backup files
+                ProtocolParallel *parallelExec = protocolParallelNew(
+                    (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2, cfgOptionUInt(cfgOptProcessQueueMax),
+                    backupArchiveJobCallback, &jobData);
+
+                bool backupStandby = cfgOptionBool(cfgOptBackupStandby);
+                unsigned int processMax = cfgOptionUInt(cfgOptProcessMax) + (backupStandby ? 1 : 0);
+
+                protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, backupData->pgIdPrimary, 1));
+
+                for (unsigned int processIdx = 2; processIdx <= processMax; processIdx++)
+                {
+                    protocolParallelClientAdd(
+                        parallelExec,
+                        protocolLocalGet(
+                            protocolStorageTypePg, backupStandby ? backupData->pgIdStandby : backupData->pgIdPrimary, processIdx));
+                }
 
-                        if (backupCompressType != compressTypeNone)
-                            ioFilterGroupAdd(filterGroup, compressFilter(backupCompressType, cfgOptionInt(cfgOptCompressLevel)));
-                    }
+                // Process jobs
+                do
+                {
+                    unsigned int completed = protocolParallelProcess(parallelExec);
 
-                    // Encrypt with backup key if encrypted
-                    cipherBlockFilterGroupAdd(
-                        filterGroup, cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherModeEncrypt,
-                        manifestCipherSubPass(manifest));
+                    for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                    {
+                        ProtocolParallelJob *job = protocolParallelResult(parallelExec);
 
-                    // Add size filter last to calculate repo size
-                    ioFilterGroupAdd(filterGroup, ioSizeNew());
+                        if (protocolParallelJobErrorCode(job) != 0)
+                            THROW_CODE(protocolParallelJobErrorCode(job), strPtr(protocolParallelJobErrorMessage(job)));
 
-                    // Copy the file
-                    const String *manifestName = strNewFmt(
-                        MANIFEST_TARGET_PGDATA "/%s/%s", strPtr(pgWalPath(manifestData(manifest)->pgVersion)), strPtr(walSegment));
+                        const String *archiveFile = varStr(protocolParallelJobKey(job));
 
-                    storageCopyP(
-                        read,
-                        storageNewWriteP(
-                            storageRepoWrite(),
-                            strNewFmt(
-                                STORAGE_REPO_BACKUP "/%s/%s%s", strPtr(manifestData(manifest)->backupLabel), strPtr(manifestName),
-                                strPtr(compressExtStr(compressTypeEnum(cfgOptionStr(cfgOptCompressType)))))));
+                        // Add to manifest
+                        ManifestFile file =
+                        {
+                            .name = strNewFmt("%s/%s", strPtr(jobData.walPath), strPtr(strSubN(archiveFile, 0, 24))),
+                            .primary = true,
+                            .mode = basePath->mode & (S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH),
+                            .user = basePath->user,
+                            .group = basePath->group,
+                            .size = walSegmentSize,
+                            .sizeRepo = varUInt64(protocolParallelJobResult(job)),
+                            .timestamp = manifestData(manifest)->backupTimestampStop,
+                        };
+
+                        memcpy(file.checksumSha1, strPtr(strSubN(archiveFile, 25, 40)), HASH_TYPE_SHA1_SIZE_HEX + 1);
+
+                        manifestFileAdd(manifest, &file);
+                        protocolParallelJobFree(job);
+                    }
 
-                    // Add to manifest
-                    ManifestFile file =
-                    {
-                        .name = manifestName,
-                        .primary = true,
-                        .mode = basePath->mode & (S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH),
-                        .user = basePath->user,
-                        .group = basePath->group,
-                        .size = walSegmentSize,
-                        .sizeRepo = varUInt64Force(ioFilterGroupResult(filterGroup, SIZE_FILTER_TYPE_STR)),
-                        .timestamp = manifestData(manifest)->backupTimestampStop,
-                    };
-
-                    memcpy(file.checksumSha1, strPtr(strSubN(archiveFile, 25, 40)), HASH_TYPE_SHA1_SIZE_HEX + 1);
-
-                    manifestFileAdd(manifest, &file);
+                    // A keep-alive is required here for the remote holding open the backup connection
+                    protocolKeepAlive();
                 }
+                while (!protocolParallelDone(parallelExec));
             }
         }
         MEM_CONTEXT_TEMP_END();
@@ -1976,8 +2151,11 @@ cmdBackup(void)
         // Save the manifest before processing starts
         backupManifestSaveCopy(manifest, cipherPassBackup);
 
+        // Start finding WAL segments required to make the backup consistent
+        BackupArchiveFind archiveFind = backupArchiveFindInit(backupData, &backupStartResult);
+
         // Process the backup manifest
-        backupProcess(backupData, manifest, backupStartResult.lsn, cipherPassBackup);
+        backupProcess(backupData, manifest, backupStartResult.lsn, cipherPassBackup, &archiveFind);
 
         // Stop the backup
         BackupStopResult backupStopResult = backupStop(backupData, manifest);
@@ -1999,7 +2177,7 @@ cmdBackup(void)
         protocolRemoteFree(backupData->pgIdPrimary);
 
         // Check and copy WAL segments required to make the backup consistent
-        backupArchiveCheckCopy(manifest, backupData->walSegmentSize, cipherPassBackup);
+        backupArchiveCheckCopy(manifest, backupData, &archiveFind, cipherPassBackup);
 
         // Complete the backup
         LOG_INFO_FMT("new backup label = %s", strPtr(manifestData(manifest)->backupLabel));
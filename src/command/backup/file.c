@@ -5,8 +5,10 @@ Backup File
 
 #include <string.h>
 
+#include "command/archive/common.h"
 #include "command/backup/file.h"
 #include "command/backup/pageChecksum.h"
+#include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
 #include "common/debug.h"
@@ -33,6 +35,44 @@ segmentNumber(const String *pgFile)
     FUNCTION_TEST_RETURN(regExpMatchOne(STRDEF("\\.[0-9]+$"), pgFile) ? cvtZToUInt(strrchr(strPtr(pgFile), '.') + 1) : 0);
 }
 
+/***********************************************************************************************************************************
+Get the id of the dictionary that a WAL segment in the archive was compressed with, or zero when it was compressed without one. Only
+the beginning of the WAL segment is read. The read cannot be limited when the WAL segment is encrypted since the size of the
+encrypted header is not known here.
+***********************************************************************************************************************************/
+static unsigned int
+backupArchiveDictId(const String *archivePath, CompressType compressType, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(archivePath != NULL);
+    ASSERT(compressTypeDict(compressType));
+
+    unsigned int result = 0;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StorageRead *read = storageNewReadP(
+            storageRepo(), archivePath, .limit = cipherType == cipherTypeNone ? VARUINT64(COMPRESS_DICT_ID_FRAME_SIZE) : NULL);
+        cipherBlockFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cipherType, cipherModeDecrypt, cipherPass);
+
+        Buffer *frame = bufNew(COMPRESS_DICT_ID_FRAME_SIZE);
+
+        ioReadOpen(storageReadIo(read));
+        ioRead(storageReadIo(read), frame);
+
+        result = compressDictIdFromFrame(compressType, frame);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(UINT, result);
+}
+
 /**********************************************************************************************************************************/
 BackupFileResult
 backupFile(
@@ -274,3 +314,94 @@ backupFile(
 
     FUNCTION_LOG_RETURN(BACKUP_FILE_RESULT, result);
 }
+
+/**********************************************************************************************************************************/
+uint64_t
+backupArchiveFile(
+    const String *archiveId, const String *archiveFile, const String *archiveCipherPass, const String *repoFile,
+    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, CipherType cipherType,
+    const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, archiveId);                      // Archive id where the WAL segment is stored
+        FUNCTION_LOG_PARAM(STRING, archiveFile);                    // WAL segment file in the archive
+        FUNCTION_TEST_PARAM(STRING, archiveCipherPass);             // Password to access the WAL segment if encrypted
+        FUNCTION_LOG_PARAM(STRING, repoFile);                       // Destination in the backup to copy the WAL segment
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);             // Compress type for repo file
+        FUNCTION_LOG_PARAM(INT, repoFileCompressLevel);             // Compression level for repo file
+        FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of current backup
+        FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
+        FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
+    FUNCTION_LOG_END();
+
+    ASSERT(archiveId != NULL);
+    ASSERT(archiveFile != NULL);
+    ASSERT(repoFile != NULL);
+    ASSERT(backupLabel != NULL);
+
+    uint64_t result = 0;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Get compression type of the WAL segment
+        CompressType archiveCompressType = compressTypeFromName(archiveFile);
+
+        // Open the archive file and create the backup file
+        const String *archivePath = strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(archiveFile));
+        StorageRead *read = storageNewReadP(storageRepo(), archivePath);
+        StorageWrite *write = storageNewWriteP(
+            storageRepoWrite(),
+            strNewFmt(
+                STORAGE_REPO_BACKUP "/%s/%s%s", strPtr(backupLabel), strPtr(repoFile),
+                strPtr(compressExtStr(repoFileCompressType))));
+
+        // Get the id of the dictionary the WAL segment was compressed with when the archive compression type supports dictionaries.
+        // The dictionary is then loaded from the repository to decompress the WAL segment.
+        unsigned int archiveDictId =
+            archiveCompressType != compressTypeNone && compressTypeDict(archiveCompressType) ?
+                backupArchiveDictId(archivePath, archiveCompressType, cipherType, archiveCipherPass) : 0;
+
+        if (archiveDictId != 0)
+            archiveDictInit(cipherType, archiveCipherPass);
+
+        // If the WAL segment can be stored in the backup exactly as it is in the archive then copy it on the storage so the data
+        // does not need to be transferred. This is not possible when encrypted since the archive and backup keys are different.
+        if (archiveCompressType == repoFileCompressType && archiveDictId == 0 && cipherType == cipherTypeNone)
+        {
+            storageCopyServerP(storageRepoWrite(), read, write);
+            result = storageInfoP(storageRepo(), archivePath).size;
+        }
+        else
+        {
+            IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(read));
+
+            // Decrypt with archive key if encrypted
+            cipherBlockFilterGroupAdd(filterGroup, cipherType, cipherModeDecrypt, archiveCipherPass);
+
+            // Compress/decompress if archive and backup do not have the same compression settings. Also recompress when the WAL
+            // segment was compressed with a dictionary since the backup must be restorable without it.
+            if (archiveCompressType != repoFileCompressType || archiveDictId != 0)
+            {
+                if (archiveCompressType != compressTypeNone)
+                    ioFilterGroupAdd(filterGroup, decompressFilter(archiveCompressType));
+
+                if (repoFileCompressType != compressTypeNone)
+                    ioFilterGroupAdd(filterGroup, compressFilter(repoFileCompressType, repoFileCompressLevel));
+            }
+
+            // Encrypt with backup key if encrypted
+            cipherBlockFilterGroupAdd(filterGroup, cipherType, cipherModeEncrypt, cipherPass);
+
+            // Add size filter last to calculate repo size
+            ioFilterGroupAdd(filterGroup, ioSizeNew());
+
+            // Copy the file
+            storageCopyP(read, write);
+
+            result = varUInt64Force(ioFilterGroupResult(filterGroup, SIZE_FILTER_TYPE_STR));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(UINT64, result);
+}
@@ -39,6 +39,12 @@ BackupFileResult backupFile(
     CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
     const String *cipherPass);
 
+// Copy a WAL segment from the archive into the backup and return the size stored in the repository
+uint64_t backupArchiveFile(
+    const String *archiveId, const String *archiveFile, const String *archiveCipherPass, const String *repoFile,
+    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, CipherType cipherType,
+    const String *cipherPass);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
@@ -16,6 +16,7 @@ Backup Protocol Handler
 Constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(PROTOCOL_COMMAND_BACKUP_FILE_STR,                     PROTOCOL_COMMAND_BACKUP_FILE);
+STRING_EXTERN(PROTOCOL_COMMAND_BACKUP_ARCHIVE_FILE_STR,             PROTOCOL_COMMAND_BACKUP_ARCHIVE_FILE);
 
 /**********************************************************************************************************************************/
 bool
@@ -55,6 +56,19 @@ backupProtocol(const String *command, const VariantList *paramList, ProtocolServ
 
             protocolServerResponse(server, varNewVarLst(resultList));
         }
+        else if (strEq(command, PROTOCOL_COMMAND_BACKUP_ARCHIVE_FILE_STR))
+        {
+            // Copy the WAL segment into the backup and return the repo size
+            protocolServerResponse(
+                server,
+                VARUINT64(
+                    backupArchiveFile(
+                        varStr(varLstGet(paramList, 0)), varStr(varLstGet(paramList, 1)), varStr(varLstGet(paramList, 2)),
+                        varStr(varLstGet(paramList, 3)), (CompressType)varUIntForce(varLstGet(paramList, 4)),
+                        varIntForce(varLstGet(paramList, 5)), varStr(varLstGet(paramList, 6)),
+                        varStr(varLstGet(paramList, 7)) == NULL ? cipherTypeNone : cipherTypeAes256Cbc,
+                        varStr(varLstGet(paramList, 7)))));
+        }
         else
             found = false;
     }
@@ -13,6 +13,8 @@ Constants
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_BACKUP_FILE                               "backupFile"
     STRING_DECLARE(PROTOCOL_COMMAND_BACKUP_FILE_STR);
+#define PROTOCOL_COMMAND_BACKUP_ARCHIVE_FILE                       "backupArchiveFile"
+    STRING_DECLARE(PROTOCOL_COMMAND_BACKUP_ARCHIVE_FILE_STR);
 
 /***********************************************************************************************************************************
 Functions
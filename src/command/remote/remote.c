@@ -5,6 +5,7 @@ Remote Command
 
 #include <string.h>
 
+#include "command/archive/common.h"
 #include "command/control/common.h"
 #include "common/debug.h"
 #include "common/io/handleRead.h"
@@ -13,29 +14,35 @@ Remote Command
 #include "config/config.h"
 #include "config/protocol.h"
 #include "db/protocol.h"
+#include "protocol/frame.h"
 #include "protocol/helper.h"
 #include "protocol/server.h"
 #include "storage/remote/protocol.h"
 
 /**********************************************************************************************************************************/
 void
-cmdRemote(int handleRead, int handleWrite)
+cmdRemoteIo(IoRead *read, IoWrite *write)
 {
-    FUNCTION_LOG_VOID(logLevelDebug);
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+    ASSERT(write != NULL);
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
         String *name = strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u", cfgOptionUInt(cfgOptProcess));
-        IoRead *read = ioHandleReadNew(name, handleRead, (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
-        ioReadOpen(read);
-        IoWrite *write = ioHandleWriteNew(name, handleWrite);
-        ioWriteOpen(write);
-
         ProtocolServer *server = protocolServerNew(name, PROTOCOL_SERVICE_REMOTE_STR, read, write);
         protocolServerHandlerAdd(server, storageRemoteProtocol);
         protocolServerHandlerAdd(server, dbProtocol);
         protocolServerHandlerAdd(server, configProtocol);
 
+        // Load WAL compression dictionaries from the repository when filters that require them are created
+        if (strEqZ(cfgOptionStr(cfgOptRemoteType), PROTOCOL_REMOTE_TYPE_REPO) && cfgOptionTest(cfgOptStanza))
+            archiveDictInit(cipherType(cfgOptionStr(cfgOptRepoCipherType)), NULL);
+
         // Acquire a lock if this command needs one.  We'll use the noop that is always sent from the client right after the
         // handshake to return an error.  We can't take a lock earlier than this because we want the error to go back through the
         // protocol layer.
@@ -43,8 +50,8 @@ cmdRemote(int handleRead, int handleWrite)
 
         TRY_BEGIN()
         {
-            // Read the command.  No need to parse it since we know this is the first noop.
-            ioReadLine(read);
+            // Read the command frame.  No need to parse it since we know this is the first noop.
+            protocolFrameRead(read);
 
             // Only try the lock if this is process 0, i.e. the remote started from the main process
             if (cfgOptionUInt(cfgOptProcess) == 0)
@@ -78,3 +85,24 @@ cmdRemote(int handleRead, int handleWrite)
 
     FUNCTION_LOG_RETURN_VOID();
 }
+
+/**********************************************************************************************************************************/
+void
+cmdRemote(int handleRead, int handleWrite)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        String *name = strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u", cfgOptionUInt(cfgOptProcess));
+        IoRead *read = ioHandleReadNew(name, handleRead, (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
+        ioReadOpen(read);
+        IoWrite *write = ioHandleWriteNew(name, handleWrite);
+        ioWriteOpen(write);
+
+        cmdRemoteIo(read, write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
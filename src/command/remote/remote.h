@@ -4,10 +4,16 @@ Remote Command
 #ifndef COMMAND_REMOTE_REMOTE_H
 #define COMMAND_REMOTE_REMOTE_H
 
+#include "common/io/read.h"
+#include "common/io/write.h"
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
 // Remote command
 void cmdRemote(int handleRead, int handleWrite);
 
+// Remote command on an already open connection, e.g. a TLS session accepted by the server command
+void cmdRemoteIo(IoRead *read, IoWrite *write);
+
 #endif
@@ -0,0 +1,279 @@
+/***********************************************************************************************************************************
+Server Command
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+
+#include "command/remote/remote.h"
+#include "command/server/server.h"
+#include "common/debug.h"
+#include "common/exit.h"
+#include "common/fork.h"
+#include "common/io/socket/server.h"
+#include "common/io/socket/session.h"
+#include "common/io/tls/server.h"
+#include "common/log.h"
+#include "common/type/json.h"
+#include "config/config.h"
+#include "config/exec.h"
+#include "config/load.h"
+#include "protocol/frame.h"
+#include "protocol/helper.h"
+#include "protocol/server.h"
+
+/***********************************************************************************************************************************
+Maximum time to wait for a connection before reaping forked processes that have exited
+***********************************************************************************************************************************/
+#define SERVER_ACCEPT_TIMEOUT_MSEC                                  1000
+
+/***********************************************************************************************************************************
+Build the remote parameters from the parameters sent by the client
+
+The remote runs with the configuration of the server, so the client may only send the options that select the remote. Any other
+option is rejected rather than ignored so a misconfigured client fails clearly. The client must also be authorized for the stanza in
+tls-server-auth. A client may only omit the stanza (or run a command that does not accept one) when it is authorized for all stanzas.
+***********************************************************************************************************************************/
+static StringList *
+cmdServerParam(const StringList *clientParamList, const String *clientName)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, clientParamList);
+        FUNCTION_LOG_PARAM(STRING, clientName);
+    FUNCTION_LOG_END();
+
+    ASSERT(clientParamList != NULL);
+
+    StringList *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        KeyValue *optionReplace = kvNew();
+        const String *command = NULL;
+
+        for (unsigned int paramIdx = 0; paramIdx < strLstSize(clientParamList); paramIdx++)
+        {
+            const String *param = strLstGet(clientParamList, paramIdx);
+
+            // Options must be in --option=value form
+            if (strBeginsWithZ(param, "--"))
+            {
+                const String *option = strSub(param, 2);
+                int valueIdx = strChr(option, '=');
+                const String *optionName = valueIdx == -1 ? option : strSubN(option, 0, (size_t)valueIdx);
+
+                if (valueIdx == -1 ||
+                    !(strEq(optionName, CFGOPT_STANZA_STR) || strEq(optionName, CFGOPT_PROCESS_STR) ||
+                      strEq(optionName, CFGOPT_REMOTE_TYPE_STR) || strEq(optionName, CFGOPT_HOST_ID_STR)))
+                {
+                    THROW_FMT(OptionInvalidError, "option '%s' is not allowed from the client", strPtr(optionName));
+                }
+
+                kvPut(optionReplace, VARSTR(optionName), VARSTR(strSub(option, (size_t)valueIdx + 1)));
+            }
+            // Else the command
+            else if (command == NULL)
+                command = param;
+            else
+                THROW_FMT(ParamInvalidError, "unexpected parameter '%s' from the client", strPtr(param));
+        }
+
+        if (command == NULL)
+            THROW(CommandRequiredError, "no command from the client");
+
+        // Only the remote role is accepted
+        StringList *commandPart = strLstNewSplitZ(command, ":");
+        ConfigCommand commandId = cfgCommandId(strPtr(strLstGet(commandPart, 0)), false);
+
+        if (commandId == cfgCmdNone)
+            THROW_FMT(CommandInvalidError, "invalid command '%s'", strPtr(strLstGet(commandPart, 0)));
+
+        if (strLstSize(commandPart) != 2 || cfgCommandRoleEnum(strLstGet(commandPart, 1)) != cfgCmdRoleRemote)
+            THROW_FMT(CommandInvalidError, "server only accepts the '%s' role", strPtr(cfgCommandRoleStr(cfgCmdRoleRemote)));
+
+        // Check that the client is authorized for the stanza. The stanza is ignored when the command does not accept it.
+        const Variant *stanza = cfgDefOptionValid(cfgCommandDefIdFromId(commandId), cfgDefOptStanza) ?
+            kvGet(optionReplace, VARSTR(CFGOPT_STANZA_STR)) : NULL;
+        const Variant *clientAuth = clientName == NULL ? NULL : kvGet(cfgOptionKv(cfgOptTlsServerAuth), VARSTR(clientName));
+
+        if (clientAuth == NULL)
+            THROW_FMT(HostInvalidError, "client '%s' is not authorized", clientName == NULL ? "" : strPtr(clientName));
+
+        StringList *clientStanzaList = strLstNew();
+        StringList *clientAuthList = strLstNewSplitZ(varStr(clientAuth), ",");
+
+        for (unsigned int clientAuthIdx = 0; clientAuthIdx < strLstSize(clientAuthList); clientAuthIdx++)
+            strLstAdd(clientStanzaList, strTrim(strLstGet(clientAuthList, clientAuthIdx)));
+
+        if (!strLstExistsZ(clientStanzaList, "*") && (stanza == NULL || !strLstExists(clientStanzaList, varStr(stanza))))
+        {
+            if (stanza == NULL)
+                THROW_FMT(HostInvalidError, "client '%s' is not authorized for all stanzas", strPtr(clientName));
+
+            THROW_FMT(
+                HostInvalidError, "client '%s' is not authorized for stanza '%s'", strPtr(clientName), strPtr(varStr(stanza)));
+        }
+
+        // Set local so host settings in the server configuration will not accidentally be picked up
+        const Variant *remoteType = kvGet(optionReplace, VARSTR(CFGOPT_REMOTE_TYPE_STR));
+
+        kvPut(
+            optionReplace,
+            remoteType != NULL && strEqZ(varStr(remoteType), PROTOCOL_REMOTE_TYPE_PG) ?
+                VARSTR(CFGOPT_PG1_LOCAL_STR) : VARSTR(CFGOPT_REPO1_LOCAL_STR),
+            BOOL_TRUE_VAR);
+
+        // Log as a remote started via ssh does by default. Console output would be mixed with the output of the server.
+        kvPut(optionReplace, VARSTR(CFGOPT_LOG_LEVEL_CONSOLE_STR), VARSTRDEF("off"));
+        kvPut(optionReplace, VARSTR(CFGOPT_LOG_LEVEL_STDERR_STR), VARSTRDEF("error"));
+        kvPut(optionReplace, VARSTR(CFGOPT_LOG_LEVEL_FILE_STR), VARSTRDEF("off"));
+
+        // Add the options of the server, e.g. config, with the client options
+        result = cfgExecParam(commandId, cfgCmdRoleRemote, optionReplace, false, false);
+        strLstInsert(result, 0, cfgExe());
+
+        strLstMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/***********************************************************************************************************************************
+Run a remote on an accepted connection in the forked process and return the exit code
+
+The client sends the remote parameters as a JSON array on the first line. These are checked and combined with the configuration of
+the server and then the remote protocol runs over the TLS session. The socket session is accepted with io-timeout so a client that
+does not complete the handshake and send the parameters promptly does not hold a process for long. The timeout is raised to
+protocolTimeout once the client is authorized.
+***********************************************************************************************************************************/
+static int
+cmdServerSession(TlsServer *tlsServer, SocketSession *socketSession, TimeMSec protocolTimeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(TLS_SERVER, tlsServer);
+        FUNCTION_LOG_PARAM(SOCKET_SESSION, socketSession);
+        FUNCTION_LOG_PARAM(TIME_MSEC, protocolTimeout);
+    FUNCTION_LOG_END();
+
+    volatile bool error = false;
+
+    TRY_BEGIN()
+    {
+        // Negotiate the TLS session. The client must present a certificate signed by the CA.
+        TlsSession *tlsSession = tlsServerAccept(tlsServer, socketSession);
+        IoRead *read = tlsSessionIoRead(tlsSession);
+        IoWrite *write = tlsSessionIoWrite(tlsSession);
+
+        // Get the remote parameters
+        StringList *clientParamList = strLstNewVarLst(jsonToVarLst(ioReadLine(read)));
+
+        TRY_BEGIN()
+        {
+            // Load the configuration for the remote
+            StringList *paramList = cmdServerParam(clientParamList, tlsSessionPeerName(tlsSession));
+            cfgLoad(strLstSize(paramList), strLstPtr(paramList));
+
+            // The socket session is owned by the TLS session now but is still valid
+            sckSessionTimeoutSet(socketSession, protocolTimeout);
+        }
+        CATCH_ANY()
+        {
+            // Return the error through the protocol so the client can report it. Use the noop that is always sent from the client
+            // right after the handshake, as the remote command does.
+            ProtocolServer *server = protocolServerNew(STRDEF(CFGCMD_SERVER), PROTOCOL_SERVICE_REMOTE_STR, read, write);
+
+            protocolFrameRead(read);
+            protocolServerError(server, errorCode(), STR(errorMessage()), STR(errorStackTrace()));
+
+            RETHROW();
+        }
+        TRY_END();
+
+        cmdRemoteIo(read, write);
+    }
+    CATCH_ANY()
+    {
+        error = true;
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(INT, exitSafe(0, error, 0));
+}
+
+/**********************************************************************************************************************************/
+void
+cmdServer(unsigned int connectionMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, connectionMax);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TimeMSec protocolTimeout = (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC);
+        TimeMSec ioTimeout = (TimeMSec)(cfgOptionDbl(cfgOptIoTimeout) * MSEC_PER_SEC);
+        unsigned int processMax = cfgOptionUInt(cfgOptTlsServerProcessMax);
+
+        // Create the TLS context before listening so configuration errors are reported immediately. The context is shared by all
+        // forked processes so session tickets issued by one can be used to resume a session with another.
+        TlsServer *tlsServer = tlsServerNew(
+            cfgOptionStr(cfgOptTlsServerCaFile), cfgOptionStr(cfgOptTlsServerCertFile), cfgOptionStr(cfgOptTlsServerKeyFile),
+            ioTimeout);
+        SocketServer *socketServer = sckServerNew(
+            cfgOptionStr(cfgOptTlsServerAddress), cfgOptionUInt(cfgOptTlsServerPort), ioTimeout);
+
+        LOG_INFO_FMT(
+            "listening on '%s:%u'", strPtr(cfgOptionStr(cfgOptTlsServerAddress)), cfgOptionUInt(cfgOptTlsServerPort));
+
+        unsigned int connectionTotal = 0;
+        unsigned int processTotal = 0;
+
+        do
+        {
+            // Reap any forked processes that have exited. This is done on each wait for a connection so processes do not remain
+            // zombies while the server is idle.
+            while (waitpid(-1, NULL, WNOHANG) > 0)
+                processTotal--;
+
+            // Stop accepting connections while the maximum number of processes are running. Connections wait in the listen
+            // backlog until a process exits.
+            if (processTotal >= processMax)
+            {
+                LOG_DETAIL_FMT("%u processes are running, wait for a process to exit", processTotal);
+
+                if (waitpid(-1, NULL, 0) > 0)
+                    processTotal--;
+
+                continue;
+            }
+
+            SocketSession *socketSession = sckServerAccept(socketServer, SERVER_ACCEPT_TIMEOUT_MSEC);
+
+            // No connection arrived before the timeout or the connection could not be accepted
+            if (socketSession == NULL)
+                continue;
+
+            // Run the remote in a forked process so a failed or long-running connection does not affect the server
+            if (forkSafe() == 0)
+            {
+                sckServerFree(socketServer);
+                exit(cmdServerSession(tlsServer, socketSession, protocolTimeout));
+            }
+
+            // The session belongs to the forked process now
+            sckSessionFree(socketSession);
+            connectionTotal++;
+            processTotal++;
+        }
+        while (connectionMax == 0 || connectionTotal < connectionMax);
+
+        // Wait for the remaining forked processes to exit
+        while (wait(NULL) > 0);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
@@ -0,0 +1,14 @@
+/***********************************************************************************************************************************
+Server Command
+***********************************************************************************************************************************/
+#ifndef COMMAND_SERVER_SERVER_H
+#define COMMAND_SERVER_SERVER_H
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Accept TLS connections and run a remote for each in a forked process. Exit after connectionMax connections or run until
+// terminated when connectionMax is 0.
+void cmdServer(unsigned int connectionMax);
+
+#endif
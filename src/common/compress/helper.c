@@ -41,6 +41,8 @@ static const struct CompressHelperLocal
     IoFilter *(*compressNew)(int);                                  // Function to create new compression filter
     const char *decompressType;                                     // Type of the decompression filter
     IoFilter *(*decompressNew)(void);                               // Function to create new decompression filter
+    IoFilter *(*compressDictNew)(int, const Buffer *);              // Function to create new compression filter with dictionary
+    unsigned int (*dictIdFromFrame)(const Buffer *);                // Function to get the dictionary id from compressed data
     int levelDefault;                                               // Default compression level
 } compressHelperLocal[] =
 {
@@ -85,6 +87,8 @@ static const struct CompressHelperLocal
         .compressNew = zstCompressNew,
         .decompressType = ZST_DECOMPRESS_FILTER_TYPE,
         .decompressNew = zstDecompressNew,
+        .compressDictNew = zstCompressDictNew,
+        .dictIdFromFrame = zstDictIdFromFrame,
         .levelDefault = 3,
 #endif
     },
@@ -210,6 +214,95 @@ compressFilter(CompressType type, int level)
     FUNCTION_TEST_RETURN(compressHelperLocal[type].compressNew(level));
 }
 
+/**********************************************************************************************************************************/
+bool
+compressTypeDict(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+
+    FUNCTION_TEST_RETURN(compressHelperLocal[type].compressDictNew != NULL);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+compressDictIdFromFrame(CompressType type, const Buffer *frame)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(BUFFER, frame);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+    ASSERT(compressTypeDict(type));
+    ASSERT(frame != NULL);
+
+    FUNCTION_TEST_RETURN(compressHelperLocal[type].dictIdFromFrame(frame));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+compressFilterDict(CompressType type, int level, const Buffer *dictionary)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(INT, level);
+        FUNCTION_TEST_PARAM(BUFFER, dictionary);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+    ASSERT(type != compressTypeNone);
+    compressTypePresent(type);
+
+    ASSERT(dictionary == NULL || compressTypeDict(type));
+
+    FUNCTION_TEST_RETURN(
+        dictionary == NULL ?
+            compressHelperLocal[type].compressNew(level) : compressHelperLocal[type].compressDictNew(level, dictionary));
+}
+
+/***********************************************************************************************************************************
+Function used to load dictionaries by id
+***********************************************************************************************************************************/
+static struct CompressDictLocal
+{
+    CompressDictLoad *load;                                         // Dictionary load function
+} compressDictLocal;
+
+/**********************************************************************************************************************************/
+void
+compressDictLoadSet(CompressDictLoad *load)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, load);
+    FUNCTION_TEST_END();
+
+    compressDictLocal.load = load;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+const Buffer *
+compressDictLoad(unsigned int dictId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, dictId);
+    FUNCTION_TEST_END();
+
+    ASSERT(dictId != 0);
+
+    const Buffer *result = compressDictLocal.load == NULL ? NULL : compressDictLocal.load(dictId);
+
+    if (result == NULL)
+        THROW_FMT(FormatError, "compression dictionary %u is not available", dictId);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 IoFilter *
 compressFilterVar(const String *filterType, const VariantList *filterParamList)
@@ -229,7 +322,15 @@ compressFilterVar(const String *filterType, const VariantList *filterParamList)
 
         if (compress->compressType != NULL && strEqZ(filterType, compress->compressType))
         {
-            result = compress->compressNew(varIntForce(varLstGet(filterParamList, 0)));
+            // A second parameter is the dictionary id
+            if (varLstSize(filterParamList) > 1)
+            {
+                result = compress->compressDictNew(
+                    varIntForce(varLstGet(filterParamList, 0)), compressDictLoad(varUIntForce(varLstGet(filterParamList, 1))));
+            }
+            else
+                result = compress->compressNew(varIntForce(varLstGet(filterParamList, 0)));
+
             break;
         }
         else if (compress->decompressType != NULL && strEqZ(filterType, compress->decompressType))
@@ -242,6 +343,49 @@ compressFilterVar(const String *filterType, const VariantList *filterParamList)
     FUNCTION_LOG_RETURN(IO_FILTER, result);
 }
 
+/***********************************************************************************************************************************
+Check if a filter type matches the compression (or decompression) filter type of any compression type
+***********************************************************************************************************************************/
+static bool
+compressFilterTypeIs(const String *filterType, bool decompress)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, filterType);
+        FUNCTION_TEST_PARAM(BOOL, decompress);
+    FUNCTION_TEST_END();
+
+    ASSERT(filterType != NULL);
+
+    bool result = false;
+
+    for (CompressType compressIdx = compressTypeNone + 1; compressIdx < COMPRESS_LIST_SIZE; compressIdx++)
+    {
+        const char *compressFilterType =
+            decompress ? compressHelperLocal[compressIdx].decompressType : compressHelperLocal[compressIdx].compressType;
+
+        if (compressFilterType != NULL && strEqZ(filterType, compressFilterType))
+        {
+            result = true;
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+bool
+compressFilterIs(const IoFilter *filter)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER, filter);
+    FUNCTION_TEST_END();
+
+    ASSERT(filter != NULL);
+
+    FUNCTION_TEST_RETURN(compressFilterTypeIs(ioFilterType(filter), false));
+}
+
 /**********************************************************************************************************************************/
 IoFilter *
 decompressFilter(CompressType type)
@@ -257,6 +401,19 @@ decompressFilter(CompressType type)
     FUNCTION_TEST_RETURN(compressHelperLocal[type].decompressNew());
 }
 
+/**********************************************************************************************************************************/
+bool
+decompressFilterIs(const IoFilter *filter)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER, filter);
+    FUNCTION_TEST_END();
+
+    ASSERT(filter != NULL);
+
+    FUNCTION_TEST_RETURN(compressFilterTypeIs(ioFilterType(filter), true));
+}
+
 /**********************************************************************************************************************************/
 const String *
 compressExtStr(CompressType type)
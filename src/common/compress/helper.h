@@ -36,6 +36,11 @@ supported type is not in this list then it should cause an integration test to f
 ***********************************************************************************************************************************/
 #define COMPRESS_TYPE_REGEXP                                        "(\\.gz|\\.lz4|\\.zst|\\.xz|\\.bz2)"
 
+/***********************************************************************************************************************************
+Bytes at the beginning of compressed data that are enough to get the dictionary id with compressDictIdFromFrame()
+***********************************************************************************************************************************/
+#define COMPRESS_DICT_ID_FRAME_SIZE                                 18
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -52,16 +57,41 @@ const String *compressTypeStr(CompressType type);
 // compressType none is returned, even if the file is compressed with some unknown type.
 CompressType compressTypeFromName(const String *name);
 
+// Does the compression type support dictionaries?
+bool compressTypeDict(CompressType type);
+
 // Compression filter for the specified type.  Error when compress type is none or invalid.
 IoFilter *compressFilter(CompressType type, int level);
 
+// Get the id of the dictionary required to decompress data from the first COMPRESS_DICT_ID_FRAME_SIZE bytes of the data (or all the
+// data when smaller). Zero is returned when the data was not compressed with a dictionary. The type must support dictionaries.
+unsigned int compressDictIdFromFrame(CompressType type, const Buffer *frame);
+
+// Compression filter using a dictionary. If the dictionary is NULL then this is the same as compressFilter().
+IoFilter *compressFilterDict(CompressType type, int level, const Buffer *dictionary);
+
+// Set the function used to load dictionaries by id. Dictionaries are loaded to decompress data compressed with a dictionary and
+// when a compression filter with a dictionary is recreated on a remote system.
+typedef const Buffer *CompressDictLoad(unsigned int dictId);
+
+void compressDictLoadSet(CompressDictLoad *load);
+
+// Load a dictionary by id. Error when the dictionary is not available.
+const Buffer *compressDictLoad(unsigned int dictId);
+
 // Compression/decompression filter based on string type and a parameter list.  This is useful when a filter must be created on a
 // remote system since the filter type and parameters can be passed through a protocol.
 IoFilter *compressFilterVar(const String *filterType, const VariantList *filterParamList);
 
+// Is the filter a compression filter for any supported type?
+bool compressFilterIs(const IoFilter *filter);
+
 // Decompression filter for the specified type.  Error when compress type is none or invalid.
 IoFilter *decompressFilter(CompressType type);
 
+// Is the filter a decompression filter for any supported type?
+bool decompressFilterIs(const IoFilter *filter);
+
 // Get extension for the current compression type
 const String *compressExtStr(CompressType type);
 
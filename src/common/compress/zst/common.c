@@ -5,6 +5,7 @@ ZST Common
 
 #ifdef HAVE_LIBZST
 
+#include <zdict.h>
 #include <zstd.h>
 
 // Check the version -- this is done in configure but it makes sense to be sure
@@ -14,6 +15,8 @@ ZST Common
 
 #include "common/compress/zst/common.h"
 #include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
 
 /**********************************************************************************************************************************/
 size_t
@@ -29,4 +32,75 @@ zstError(size_t error)
     FUNCTION_TEST_RETURN(error);
 }
 
+/**********************************************************************************************************************************/
+Buffer *
+zstDictTrain(const Buffer *buffer, size_t sampleSize, size_t dictSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+        FUNCTION_LOG_PARAM(SIZE, sampleSize);
+        FUNCTION_LOG_PARAM(SIZE, dictSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(buffer != NULL);
+    ASSERT(sampleSize > 0);
+    ASSERT(dictSize > 0);
+
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Split the buffer into samples
+        unsigned int sampleTotal = (unsigned int)((bufUsed(buffer) + sampleSize - 1) / sampleSize);
+        size_t *sampleSizeList = memNew(sizeof(size_t) * (sampleTotal == 0 ? 1 : sampleTotal));
+
+        for (unsigned int sampleIdx = 0; sampleIdx < sampleTotal; sampleIdx++)
+        {
+            sampleSizeList[sampleIdx] =
+                sampleIdx == sampleTotal - 1 ? bufUsed(buffer) - sampleSize * sampleIdx : sampleSize;
+        }
+
+        // Train the dictionary. Failure is not an error since some data is just not suitable for training.
+        Buffer *dictionary = bufNew(dictSize);
+        size_t dictSizeActual = ZDICT_trainFromBuffer(
+            bufPtr(dictionary), bufSize(dictionary), bufPtrConst(buffer), sampleSizeList, sampleTotal);
+
+        if (!ZDICT_isError(dictSizeActual))
+        {
+            bufUsedSet(dictionary, dictSizeActual);
+            bufMove(dictionary, memContextPrior());
+            result = dictionary;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+zstDictId(const Buffer *dictionary)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, dictionary);
+    FUNCTION_TEST_END();
+
+    ASSERT(dictionary != NULL);
+
+    FUNCTION_TEST_RETURN(ZDICT_getDictID(bufPtrConst(dictionary), bufUsed(dictionary)));
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+zstDictIdFromFrame(const Buffer *frame)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, frame);
+    FUNCTION_TEST_END();
+
+    ASSERT(frame != NULL);
+
+    FUNCTION_TEST_RETURN(ZSTD_getDictID_fromFrame(bufPtrConst(frame), bufUsed(frame)));
+}
+
 #endif // HAVE_LIBZST
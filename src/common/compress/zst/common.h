@@ -8,6 +8,8 @@ Developed using the documentation in https://github.com/facebook/zstd/blob/v1.0.
 
 #include <stddef.h>
 
+#include "common/type/buffer.h"
+
 /***********************************************************************************************************************************
 ZST extension
 ***********************************************************************************************************************************/
@@ -20,6 +22,18 @@ Functions
 ***********************************************************************************************************************************/
 size_t zstError(size_t error);
 
+// Train a dictionary from a buffer split into samples of sampleSize bytes (the last sample may be smaller). NULL is returned when
+// training fails, e.g. the buffer is too small or does not contain enough repeated content to build a useful dictionary.
+Buffer *zstDictTrain(const Buffer *buffer, size_t sampleSize, size_t dictSize);
+
+// Get the id of a dictionary. The id is stored in each frame compressed with the dictionary so the decompressor can verify that the
+// correct dictionary is being used.
+unsigned int zstDictId(const Buffer *dictionary);
+
+// Get the id of the dictionary required to decompress a frame from the beginning of the frame. Zero is returned when the frame was
+// not compressed with a dictionary or the frame header is incomplete.
+unsigned int zstDictIdFromFrame(const Buffer *frame);
+
 #endif // HAVE_LIBZST
 
 #endif
@@ -31,6 +31,7 @@ typedef struct ZstCompress
     MemContext *memContext;                                         // Context to store data
     ZSTD_CStream *context;                                          // Compression context
     int level;                                                      // Compression level
+    unsigned int dictId;                                            // Id of the dictionary (0 when there is no dictionary)
     IoFilter *filter;                                               // Filter interface
 
     bool inputSame;                                                 // Is the same input required on the next process call?
@@ -45,8 +46,8 @@ static String *
 zstCompressToLog(const ZstCompress *this)
 {
     return strNewFmt(
-        "{level: %d, inputSame: %s, inputOffset: %zu, flushing: %s}", this->level, cvtBoolToConstZ(this->inputSame),
-        this->inputOffset, cvtBoolToConstZ(this->flushing));
+        "{level: %d, dictId: %u, inputSame: %s, inputOffset: %zu, flushing: %s}", this->level, this->dictId,
+        cvtBoolToConstZ(this->inputSame), this->inputOffset, cvtBoolToConstZ(this->flushing));
 }
 
 #define FUNCTION_LOG_ZST_COMPRESS_TYPE                                                                                             \
@@ -169,6 +170,18 @@ zstCompressNew(int level)
         FUNCTION_LOG_PARAM(INT, level);
     FUNCTION_LOG_END();
 
+    FUNCTION_LOG_RETURN(IO_FILTER, zstCompressDictNew(level, NULL));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+zstCompressDictNew(int level, const Buffer *dictionary)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(BUFFER, dictionary);
+    FUNCTION_LOG_END();
+
     ASSERT(level >= 0);
 
     IoFilter *this = NULL;
@@ -194,6 +207,19 @@ zstCompressNew(int level)
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewInt(level));
 
+        // Load the dictionary. The dictionary id will be stored in the frame header so the decompressor can load the correct
+        // dictionary. Also add the dictionary id to the param list so the filter can be recreated remotely.
+        if (dictionary != NULL)
+        {
+#if ZSTD_VERSION_NUMBER >= 10400
+            driver->dictId = zstDictId(dictionary);
+            zstError(ZSTD_CCtx_loadDictionary(driver->context, bufPtrConst(dictionary), bufUsed(dictionary)));
+            varLstAdd(paramList, varNewUInt(driver->dictId));
+#else
+            THROW(FormatError, "zst dictionary requires zstd >= 1.4.0");
+#endif
+        }
+
         // Create filter interface
         this = ioFilterNewP(
             ZST_COMPRESS_FILTER_TYPE_STR, driver, paramList, .done = zstCompressDone, .inOut = zstCompressProcess,
@@ -21,6 +21,9 @@ Constructors
 ***********************************************************************************************************************************/
 IoFilter *zstCompressNew(int level);
 
+// Compress using a dictionary created by zstDictTrain(). Decompression loads the dictionary with compressDictLoad().
+IoFilter *zstCompressDictNew(int level, const Buffer *dictionary);
+
 #endif
 
 #endif // HAVE_LIBZST
@@ -7,6 +7,7 @@ ZST Decompress
 
 #include <zstd.h>
 
+#include "common/compress/helper.h"
 #include "common/compress/zst/common.h"
 #include "common/compress/zst/decompress.h"
 #include "common/debug.h"
@@ -20,6 +21,11 @@ Filter type constant
 ***********************************************************************************************************************************/
 STRING_EXTERN(ZST_DECOMPRESS_FILTER_TYPE_STR,                       ZST_DECOMPRESS_FILTER_TYPE);
 
+/***********************************************************************************************************************************
+Maximum size of a frame header. ZSTD_FRAMEHEADERSIZE_MAX is only defined when ZSTD_STATIC_LINKING_ONLY is set.
+***********************************************************************************************************************************/
+#define ZST_DECOMPRESS_HEADER_SIZE_MAX                              18
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -30,6 +36,9 @@ typedef struct ZstDecompress
 {
     MemContext *memContext;                                         // Context to store data
     ZSTD_DStream *context;                                          // Decompression context
+    Buffer *header;                                                 // Input buffered until the frame header is complete
+    size_t headerOffset;                                            // Current offset in header buffer
+    bool dictionaryChecked;                                         // Has the frame been checked for a dictionary?
     IoFilter *filter;                                               // Filter interface
 
     bool inputSame;                                                 // Is the same input required on the next process call?
@@ -81,33 +90,99 @@ zstDecompressProcess(THIS_VOID, const Buffer *compressed, Buffer *decompressed)
     ASSERT(this->context != NULL);
     ASSERT(decompressed != NULL);
 
-    // When there is no more input then decompression is done
-    if (compressed == NULL)
+    // Buffer input until the frame header is complete (or there is no more input) so the dictionary id can be read from it. The
+    // dictionary is only loaded when required since loading it would cause frames compressed without a dictionary to be
+    // decompressed incorrectly.
+    if (!this->dictionaryChecked)
     {
-        // If the current frame being decompressed was not completed then error
-        if (!this->frameDone)
-            THROW(FormatError, "unexpected eof in compressed data");
+        if (compressed != NULL)
+        {
+            size_t catSize = bufRemains(this->header) < bufUsed(compressed) ? bufRemains(this->header) : bufUsed(compressed);
+
+            bufCatSub(this->header, compressed, 0, catSize);
+            this->inputOffset = catSize;
+        }
 
-        this->done = true;
+        if (compressed == NULL || bufFull(this->header))
+        {
+            unsigned int dictId = ZSTD_getDictID_fromFrame(bufPtrConst(this->header), bufUsed(this->header));
+
+            if (dictId != 0)
+            {
+                const Buffer *dictionary = compressDictLoad(dictId);
+
+                if (zstDictId(dictionary) != dictId)
+                {
+                    THROW_FMT(
+                        FormatError, "zst dictionary %u does not match dictionary %u required by frame", zstDictId(dictionary),
+                        dictId);
+                }
+
+#if ZSTD_VERSION_NUMBER >= 10400
+                zstError(ZSTD_DCtx_loadDictionary(this->context, bufPtrConst(dictionary), bufUsed(dictionary)));
+#else
+                THROW(FormatError, "zst dictionary requires zstd >= 1.4.0");
+#endif
+            }
+
+            this->dictionaryChecked = true;
+        }
     }
-    else
+
+    // Decompress the buffered frame header before any new input
+    if (this->dictionaryChecked && this->headerOffset < bufUsed(this->header))
     {
-        // Initialize input/output buffer
-        ZSTD_inBuffer in = {.src = bufPtrConst(compressed) + this->inputOffset, .size = bufUsed(compressed) - this->inputOffset};
+        ZSTD_inBuffer in =
+        {
+            .src = bufPtrConst(this->header) + this->headerOffset,
+            .size = bufUsed(this->header) - this->headerOffset,
+        };
         ZSTD_outBuffer out = {.dst = bufRemainsPtr(decompressed), .size = bufRemains(decompressed)};
 
-        // Perform decompression. Track frame done so we can detect unexpected EOF.
         this->frameDone = zstError(ZSTD_decompressStream(this->context, &out, &in)) == 0;
         bufUsedInc(decompressed, out.pos);
+        this->headerOffset += in.pos;
+    }
 
-        // If the input buffer was not entirely consumed then set inputSame and store the offset where processing will restart
-        if (in.pos < in.size)
+    // When there is no more input then decompression is done once the buffered frame header has been decompressed
+    if (compressed == NULL)
+    {
+        if (this->headerOffset == bufUsed(this->header))
+        {
+            // If the current frame being decompressed was not completed then error
+            if (!this->frameDone)
+                THROW(FormatError, "unexpected eof in compressed data");
+
+            this->done = true;
+        }
+    }
+    else
+    {
+        // Decompress input once the buffered frame header has been decompressed
+        if (this->dictionaryChecked && this->headerOffset == bufUsed(this->header) && this->inputOffset < bufUsed(compressed))
+        {
+            // Initialize input/output buffer
+            ZSTD_inBuffer in =
+            {
+                .src = bufPtrConst(compressed) + this->inputOffset,
+                .size = bufUsed(compressed) - this->inputOffset,
+            };
+            ZSTD_outBuffer out = {.dst = bufRemainsPtr(decompressed), .size = bufRemains(decompressed)};
+
+            // Perform decompression. Track frame done so we can detect unexpected EOF.
+            this->frameDone = zstError(ZSTD_decompressStream(this->context, &out, &in)) == 0;
+            bufUsedInc(decompressed, out.pos);
+            this->inputOffset += in.pos;
+        }
+
+        // If the buffered frame header or the input buffer was not entirely consumed then set inputSame so processing will restart
+        // at the current offsets
+        if ((this->dictionaryChecked && this->headerOffset < bufUsed(this->header)) || this->inputOffset < bufUsed(compressed))
         {
             // Output buffer should be completely full
-            ASSERT(out.pos == out.size);
+            ASSERT(bufFull(decompressed));
 
             this->inputSame = true;
-            this->inputOffset += in.pos;
         }
         // Else ready for more input
         else
@@ -170,6 +245,7 @@ zstDecompressNew(void)
         {
             .memContext = MEM_CONTEXT_NEW(),
             .context = ZSTD_createDStream(),
+            .header = bufNew(ZST_DECOMPRESS_HEADER_SIZE_MAX),
         };
 
         // Set callback to ensure zst context is freed
@@ -19,6 +19,8 @@ Filter type constant
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
+// Frames compressed with a dictionary are decompressed with the dictionary returned by compressDictLoad() for the dictionary id
+// stored in the frame header
 IoFilter *zstDecompressNew(void);
 
 #endif
@@ -224,6 +224,20 @@ cryptoHashNewVar(const VariantList *paramList)
     return cryptoHashNew(varStr(varLstGet(paramList, 0)));
 }
 
+/**********************************************************************************************************************************/
+const Buffer *
+cryptoHashBuf(IoFilter *filter)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_FILTER, filter);
+    FUNCTION_LOG_END();
+
+    ASSERT(filter != NULL);
+    ASSERT(strEq(ioFilterType(filter), CRYPTO_HASH_FILTER_TYPE_STR));
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, cryptoHash((CryptoHash *)ioFilterDriver(filter)));
+}
+
 /**********************************************************************************************************************************/
 Buffer *
 cryptoHashOne(const String *type, const Buffer *message)
@@ -56,6 +56,9 @@ IoFilter *cryptoHashNewVar(const VariantList *paramList);
 /***********************************************************************************************************************************
 Helper functions
 ***********************************************************************************************************************************/
+// Get binary hash from a hash filter. The hash is finalized so no more input may be processed after this call.
+const Buffer *cryptoHashBuf(IoFilter *filter);
+
 // Get hash for one buffer
 Buffer *cryptoHashOne(const String *type, const Buffer *message);
 
@@ -0,0 +1,37 @@
+/***********************************************************************************************************************************
+IO Client Interface
+
+A client opens sessions (see IoSession) to a server. Users of a client do not need to know which driver (e.g. TLS or a plain socket)
+implements it. The client may be used to open multiple sessions.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_CLIENT_H
+#define COMMON_IO_CLIENT_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define IO_CLIENT_TYPE                                              IoClient
+#define IO_CLIENT_PREFIX                                            ioClient
+
+typedef struct IoClient IoClient;
+
+#include "common/io/session.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Move to a new parent mem context. The driver is moved along with the client.
+IoClient *ioClientMove(IoClient *this, MemContext *parentNew);
+
+// Open a session. The session is created in the current mem context.
+IoSession *ioClientOpen(IoClient *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_IO_CLIENT_TYPE                                                                                                \
+    IoClient *
+#define FUNCTION_LOG_IO_CLIENT_FORMAT(value, buffer, bufferSize)                                                                   \
+    objToLog(value, "IoClient", buffer, bufferSize)
+
+#endif
@@ -0,0 +1,20 @@
+/***********************************************************************************************************************************
+IO Client Interface Internal
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_CLIENT_INTERN_H
+#define COMMON_IO_CLIENT_INTERN_H
+
+#include "common/io/client.h"
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+typedef struct IoClientInterface
+{
+    IoSession *(*open)(void *driver);
+} IoClientInterface;
+
+// The client must be created in the mem context of the driver since moving the client moves the driver
+IoClient *ioClientNew(void *driver, const IoClientInterface *interface);
+
+#endif
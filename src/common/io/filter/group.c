@@ -141,6 +141,25 @@ ioFilterGroupGet(const IoFilterGroup *this, unsigned int filterIdx)
     FUNCTION_TEST_RETURN((IoFilterData *)lstGet(this->filterList, filterIdx));
 }
 
+/**********************************************************************************************************************************/
+IoFilter *
+ioFilterGroupRemove(IoFilterGroup *this, unsigned int listIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_LOG_PARAM(UINT, listIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->opened && !this->closed);
+
+    // Move the filter to the calling context and remove it from the list
+    IoFilter *result = ioFilterMove(ioFilterGroupGet(this, listIdx)->filter, memContextCurrent());
+    lstRemoveIdx(this->filterList, listIdx);
+
+    FUNCTION_LOG_RETURN(IO_FILTER, result);
+}
+
 /**********************************************************************************************************************************/
 IoFilterGroup *
 ioFilterGroupClear(IoFilterGroup *this)
@@ -504,6 +523,20 @@ ioFilterGroupResultAllSet(IoFilterGroup *this, const Variant *filterResult)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+const IoFilter *
+ioFilterGroupFilter(const IoFilterGroup *this, unsigned int listIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_TEST_PARAM(UINT, listIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(ioFilterGroupGet(this, listIdx)->filter);
+}
+
 /**********************************************************************************************************************************/
 unsigned int
 ioFilterGroupSize(const IoFilterGroup *this)
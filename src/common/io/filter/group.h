@@ -35,6 +35,9 @@ IoFilterGroup *ioFilterGroupAdd(IoFilterGroup *this, IoFilter *filter);
 // Insert a filter before an index
 IoFilterGroup *ioFilterGroupInsert(IoFilterGroup *this, unsigned int listIdx, IoFilter *filter);
 
+// Remove a filter at an index and return it. The filter is moved to the current mem context.
+IoFilter *ioFilterGroupRemove(IoFilterGroup *this, unsigned int listIdx);
+
 // Clear filters
 IoFilterGroup *ioFilterGroupClear(IoFilterGroup *this);
 
@@ -53,6 +56,9 @@ Getters/Setters
 // Is the filter group done processing?
 bool ioFilterGroupDone(const IoFilterGroup *this);
 
+// Get a filter by index
+const IoFilter *ioFilterGroupFilter(const IoFilterGroup *this, unsigned int listIdx);
+
 // Should the same input be passed again? A buffer of input can produce multiple buffers of output, e.g. when a file containing all
 // zeroes is being decompressed.
 bool ioFilterGroupInputSame(const IoFilterGroup *this);
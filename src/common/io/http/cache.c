@@ -16,12 +16,10 @@ struct HttpClientCache
 {
     MemContext *memContext;                                         // Mem context
 
-    const String *host;                                             // Client settings
-    unsigned int port;
-    TimeMSec timeout;
-    bool verifyPeer;
-    const String *caFile;
-    const String *caPath;
+    IoClient *ioClient;                                             // Io client shared by all http clients
+    TimeMSec timeout;                                               // Request timeout
+    unsigned int sessionMax;                                        // Maximum sessions kept open by clients that are not busy
+    TimeMSec sessionIdleTimeout;                                    // Close sessions that have been idle longer than this
 
     List *clientList;                                               // List of http clients
 };
@@ -30,19 +28,17 @@ OBJECT_DEFINE_FREE(HTTP_CLIENT_CACHE);
 
 /**********************************************************************************************************************************/
 HttpClientCache *
-httpClientCacheNew(
-    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+httpClientCacheNew(IoClient *ioClient, TimeMSec timeout, unsigned int sessionMax, TimeMSec sessionIdleTimeout)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug)
-        FUNCTION_LOG_PARAM(STRING, host);
-        FUNCTION_LOG_PARAM(UINT, port);
+        FUNCTION_LOG_PARAM(IO_CLIENT, ioClient);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
-        FUNCTION_LOG_PARAM(BOOL, verifyPeer);
-        FUNCTION_LOG_PARAM(STRING, caFile);
-        FUNCTION_LOG_PARAM(STRING, caPath);
+        FUNCTION_LOG_PARAM(UINT, sessionMax);
+        FUNCTION_LOG_PARAM(TIME_MSEC, sessionIdleTimeout);
     FUNCTION_LOG_END();
 
-    ASSERT(host != NULL);
+    ASSERT(ioClient != NULL);
+    ASSERT(sessionMax > 0);
 
     HttpClientCache *this = NULL;
 
@@ -54,12 +50,10 @@ httpClientCacheNew(
         *this = (HttpClientCache)
         {
             .memContext = MEM_CONTEXT_NEW(),
-            .host = strDup(host),
-            .port = port,
+            .ioClient = ioClientMove(ioClient, MEM_CONTEXT_NEW()),
             .timeout = timeout,
-            .verifyPeer = verifyPeer,
-            .caFile = strDup(caFile),
-            .caPath = strDup(caPath),
+            .sessionMax = sessionMax,
+            .sessionIdleTimeout = sessionIdleTimeout,
             .clientList = lstNew(sizeof(HttpClient *)),
         };
     }
@@ -79,22 +73,47 @@ httpClientCacheGet(HttpClientCache *this)
     ASSERT(this != NULL);
 
     HttpClient *result = NULL;
+    HttpClient *resultClosed = NULL;
+    unsigned int sessionTotal = 0;
 
-    // Search for a client that is not busy
-    for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+    // Search for a client that is not busy, starting with the most recently created. Sessions on clients that are not busy are
+    // closed if they have been idle too long, since the server or a firewall may have dropped them, or if there are more open than
+    // the maximum.
+    for (unsigned int clientIdx = lstSize(this->clientList); clientIdx > 0; clientIdx--)
     {
-        HttpClient *httpClient = *(HttpClient **)lstGet(this->clientList, clientIdx);
+        HttpClient *httpClient = *(HttpClient **)lstGet(this->clientList, clientIdx - 1);
 
         if (!httpClientBusy(httpClient))
-            result = httpClient;
+        {
+            if (httpClientSessionOpen(httpClient))
+            {
+                if (httpClientSessionIdle(httpClient) > this->sessionIdleTimeout || sessionTotal == this->sessionMax)
+                    httpClientClose(httpClient);
+                else
+                    sessionTotal++;
+            }
+
+            // Prefer a client with an open session so a new connection (and TLS handshake) is not required
+            if (httpClientSessionOpen(httpClient))
+            {
+                if (result == NULL)
+                    result = httpClient;
+            }
+            else if (resultClosed == NULL)
+                resultClosed = httpClient;
+        }
     }
 
+    // Else use a client with a closed session
+    if (result == NULL)
+        result = resultClosed;
+
     // If none found then create a new one
     if (result == NULL)
     {
         MEM_CONTEXT_BEGIN(this->memContext)
         {
-            result = httpClientNew(this->host, this->port, this->timeout, this->verifyPeer, this->caFile, this->caPath);
+            result = httpClientNew(this->ioClient, this->timeout);
             lstAdd(this->clientList, &result);
         }
         MEM_CONTEXT_END();
@@ -1,7 +1,10 @@
 /***********************************************************************************************************************************
 Http Client Cache
 
-Cache http clients and return one that is not busy on request.
+Cache http clients and return one that is not busy on request. All clients open sessions with the same io client.
+
+Sessions are kept open between requests so they can be reused without a new connection (and TLS handshake). The number of sessions
+kept open by clients that are not busy is limited and sessions that have been idle too long are closed rather than reused.
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_HTTP_CLIENT_CACHE_H
 #define COMMON_IO_HTTP_CLIENT_CACHE_H
@@ -19,8 +22,8 @@ typedef struct HttpClientCache HttpClientCache;
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-HttpClientCache *httpClientCacheNew(
-    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+// The io client is moved to the cache
+HttpClientCache *httpClientCacheNew(IoClient *ioClient, TimeMSec timeout, unsigned int sessionMax, TimeMSec sessionIdleTimeout);
 
 /***********************************************************************************************************************************
 Functions
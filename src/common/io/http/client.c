@@ -8,7 +8,7 @@ Http Client
 #include "common/io/http/common.h"
 #include "common/io/io.h"
 #include "common/io/read.intern.h"
-#include "common/io/tls/client.h"
+#include "common/io/socket/common.h"
 #include "common/log.h"
 #include "common/type/object.h"
 #include "common/wait.h"
@@ -52,13 +52,27 @@ static HttpClientStat httpClientStatLocal;
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
+typedef struct HttpClientRequest
+{
+    MemContext *memContext;                                         // Mem context
+    Wait *wait;                                                     // Wait for retries
+    const String *verb;                                             // Verb (GET, PUT, etc.)
+    const String *uri;                                              // Uri
+    const String *query;                                            // Rendered query (NULL if no query)
+    const HttpHeader *header;                                       // Request headers
+    const Buffer *body;                                             // Body owned by the caller (NULL if no body)
+} HttpClientRequest;
+
 struct HttpClient
 {
     MemContext *memContext;                                         // Mem context
     TimeMSec timeout;                                               // Request timeout
+    HttpClientRequest *request;                                     // Request waiting for a response
+    unsigned int requestRetry;                                      // Retries required by the last request
 
-    TlsClient *tlsClient;                                           // TLS client
-    TlsSession *tlsSession;                                         // Current TLS session
+    IoClient *ioClient;                                             // Client used to open sessions (owned by the caller)
+    IoSession *ioSession;                                           // Current session
+    TimeMSec sessionTime;                                           // Time the session was last used
     IoRead *ioRead;                                                 // Read io interface
 
     unsigned int responseCode;                                      // Response code (e.g. 200, 404)
@@ -100,8 +114,8 @@ httpClientRead(THIS_VOID, Buffer *buffer, bool block)
         // If close was requested and no content specified then the server may send content up until the eof
         if (this->closeOnContentEof && !this->contentChunked && this->contentSize == 0)
         {
-            ioRead(tlsSessionIoRead(this->tlsSession), buffer);
-            this->contentEof = ioReadEof(tlsSessionIoRead(this->tlsSession));
+            ioRead(ioSessionIoRead(this->ioSession), buffer);
+            this->contentEof = ioReadEof(ioSessionIoRead(this->ioSession));
         }
         // Else read using specified encoding or size
         else
@@ -115,7 +129,7 @@ httpClientRead(THIS_VOID, Buffer *buffer, bool block)
                     MEM_CONTEXT_TEMP_BEGIN()
                     {
                         this->contentRemaining = cvtZToUInt64Base(
-                            strPtr(strTrim(ioReadLine(tlsSessionIoRead(this->tlsSession)))), 16);
+                            strPtr(strTrim(ioReadLine(ioSessionIoRead(this->ioSession)))), 16);
                     }
                     MEM_CONTEXT_TEMP_END();
 
@@ -134,10 +148,10 @@ httpClientRead(THIS_VOID, Buffer *buffer, bool block)
                         bufLimitSet(buffer, bufSize(buffer) - (bufRemains(buffer) - (size_t)this->contentRemaining));
 
                     actualBytes = bufRemains(buffer);
-                    this->contentRemaining -= ioRead(tlsSessionIoRead(this->tlsSession), buffer);
+                    this->contentRemaining -= ioRead(ioSessionIoRead(this->ioSession), buffer);
 
                     // Error if EOF but content read is not complete
-                    if (ioReadEof(tlsSessionIoRead(this->tlsSession)))
+                    if (ioReadEof(ioSessionIoRead(this->ioSession)))
                         THROW(FileReadError, "unexpected EOF reading HTTP content");
 
                     // Clear limit (this works even if the limit was not set and it is easier than checking)
@@ -151,7 +165,7 @@ httpClientRead(THIS_VOID, Buffer *buffer, bool block)
                     // around to check.
                     if (this->contentChunked)
                     {
-                        ioReadLine(tlsSessionIoRead(this->tlsSession));
+                        ioReadLine(ioSessionIoRead(this->ioSession));
                     }
                     // If total content size was provided then this is eof
                     else
@@ -164,9 +178,11 @@ httpClientRead(THIS_VOID, Buffer *buffer, bool block)
         // If the server notified that it would close the connection after sending content then close the client side
         if (this->contentEof && this->closeOnContentEof)
         {
-            tlsSessionFree(this->tlsSession);
-            this->tlsSession = NULL;
+            ioSessionFree(this->ioSession);
+            this->ioSession = NULL;
         }
+
+        this->sessionTime = timeMSec();
     }
 
     FUNCTION_LOG_RETURN(SIZE, (size_t)actualBytes);
@@ -191,19 +207,14 @@ httpClientEof(THIS_VOID)
 
 /**********************************************************************************************************************************/
 HttpClient *
-httpClientNew(
-    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+httpClientNew(IoClient *ioClient, TimeMSec timeout)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug)
-        FUNCTION_LOG_PARAM(STRING, host);
-        FUNCTION_LOG_PARAM(UINT, port);
+        FUNCTION_LOG_PARAM(IO_CLIENT, ioClient);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
-        FUNCTION_LOG_PARAM(BOOL, verifyPeer);
-        FUNCTION_LOG_PARAM(STRING, caFile);
-        FUNCTION_LOG_PARAM(STRING, caPath);
     FUNCTION_LOG_END();
 
-    ASSERT(host != NULL);
+    ASSERT(ioClient != NULL);
 
     HttpClient *this = NULL;
 
@@ -215,7 +226,7 @@ httpClientNew(
         {
             .memContext = MEM_CONTEXT_NEW(),
             .timeout = timeout,
-            .tlsClient = tlsClientNew(sckClientNew(host, port, timeout), timeout, verifyPeer, caFile, caPath),
+            .ioClient = ioClient,
         };
 
         httpClientStatLocal.object++;
@@ -225,276 +236,442 @@ httpClientNew(
     FUNCTION_LOG_RETURN(HTTP_CLIENT, this);
 }
 
-/**********************************************************************************************************************************/
-Buffer *
-httpClientRequest(
-    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
-    const Buffer *body, bool returnContent)
+/***********************************************************************************************************************************
+Write the pending request
+***********************************************************************************************************************************/
+static void
+httpClientRequestWrite(HttpClient *this)
 {
-    FUNCTION_LOG_BEGIN(logLevelDebug)
+    FUNCTION_LOG_BEGIN(logLevelTrace)
         FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
-        FUNCTION_LOG_PARAM(STRING, verb);
-        FUNCTION_LOG_PARAM(STRING, uri);
-        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
-        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
-        FUNCTION_LOG_PARAM(BUFFER, body);
-        FUNCTION_LOG_PARAM(BOOL, returnContent);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(verb != NULL);
-    ASSERT(uri != NULL);
+    ASSERT(this->request != NULL);
 
-    // Buffer for returned content
-    Buffer *result = NULL;
+    // Free response status left over from the last request
+    httpHeaderFree(this->responseHeader);
+    this->responseHeader = NULL;
+    strFree(this->responseMessage);
+    this->responseMessage = NULL;
+
+    // Reset all content info
+    this->contentChunked = false;
+    this->contentSize = 0;
+    this->contentRemaining = 0;
+    this->closeOnContentEof = false;
+    this->contentEof = true;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        bool retry;
-        Wait *wait = waitNew(this->timeout);
+        // If the session is read ready while idle then the server has closed it (or sent something unexpected). Close the session
+        // rather than writing a request that will fail and need to be retried.
+        if (this->ioSession != NULL && sckReadyRead(ioSessionFd(this->ioSession), 0))
+        {
+            ioSessionFree(this->ioSession);
+            this->ioSession = NULL;
 
-        do
+            httpClientStatLocal.close++;
+        }
+
+        if (this->ioSession == NULL)
         {
-            // Assume there will be no retry
-            retry = false;
-
-            // Free the read interface
-            httpClientDone(this);
-
-            // Free response status left over from the last request
-            httpHeaderFree(this->responseHeader);
-            this->responseHeader = NULL;
-            strFree(this->responseMessage);
-            this->responseMessage = NULL;
-
-            // Reset all content info
-            this->contentChunked = false;
-            this->contentSize = 0;
-            this->contentRemaining = 0;
-            this->closeOnContentEof = false;
-            this->contentEof = true;
-
-            TRY_BEGIN()
+            MEM_CONTEXT_BEGIN(this->memContext)
             {
-                if (this->tlsSession == NULL)
-                {
-                    MEM_CONTEXT_BEGIN(this->memContext)
-                    {
-                        this->tlsSession = tlsClientOpen(this->tlsClient);
-                        httpClientStatLocal.session++;
-                    }
-                    MEM_CONTEXT_END();
-                }
+                this->ioSession = ioClientOpen(this->ioClient);
+                httpClientStatLocal.session++;
+            }
+            MEM_CONTEXT_END();
+        }
 
-                // Write the request
-                String *queryStr = httpQueryRender(query);
+        // Write the request
+        ioWriteStrLine(
+            ioSessionIoWrite(this->ioSession),
+            strNewFmt(
+                "%s %s%s%s " HTTP_VERSION "\r", strPtr(this->request->verb), strPtr(httpUriEncode(this->request->uri, true)),
+                this->request->query == NULL ? "" : "?", this->request->query == NULL ? "" : strPtr(this->request->query)));
 
-                ioWriteStrLine(
-                    tlsSessionIoWrite(this->tlsSession),
-                    strNewFmt(
-                        "%s %s%s%s " HTTP_VERSION "\r", strPtr(verb), strPtr(httpUriEncode(uri, true)), queryStr == NULL ? "" : "?",
-                        queryStr == NULL ? "" : strPtr(queryStr)));
+        // Write headers
+        if (this->request->header != NULL)
+        {
+            const StringList *headerList = httpHeaderList(this->request->header);
 
-                // Write headers
-                if (requestHeader != NULL)
-                {
-                    const StringList *headerList = httpHeaderList(requestHeader);
+            for (unsigned int headerIdx = 0; headerIdx < strLstSize(headerList); headerIdx++)
+            {
+                const String *headerKey = strLstGet(headerList, headerIdx);
+                ioWriteStrLine(
+                    ioSessionIoWrite(this->ioSession),
+                    strNewFmt("%s:%s\r", strPtr(headerKey), strPtr(httpHeaderGet(this->request->header, headerKey))));
+            }
+        }
 
-                    for (unsigned int headerIdx = 0; headerIdx < strLstSize(headerList); headerIdx++)
-                    {
-                        const String *headerKey = strLstGet(headerList, headerIdx);
-                        ioWriteStrLine(
-                            tlsSessionIoWrite(this->tlsSession),
-                            strNewFmt("%s:%s\r", strPtr(headerKey), strPtr(httpHeaderGet(requestHeader, headerKey))));
-                    }
-                }
+        // Write out blank line to end the headers
+        ioWriteLine(ioSessionIoWrite(this->ioSession), CR_BUF);
 
-                // Write out blank line to end the headers
-                ioWriteLine(tlsSessionIoWrite(this->tlsSession), CR_BUF);
+        // Write out body if any
+        if (this->request->body != NULL)
+            ioWrite(ioSessionIoWrite(this->ioSession), this->request->body);
 
-                // Write out body if any
-                if (body != NULL)
-                    ioWrite(tlsSessionIoWrite(this->tlsSession), body);
+        // Flush all writes
+        ioWriteFlush(ioSessionIoWrite(this->ioSession));
+        this->sessionTime = timeMSec();
+    }
+    MEM_CONTEXT_TEMP_END();
 
-                // Flush all writes
-                ioWriteFlush(tlsSessionIoWrite(this->tlsSession));
+    FUNCTION_LOG_RETURN_VOID();
+}
 
-                // Read status
-                String *status = ioReadLine(tlsSessionIoRead(this->tlsSession));
+/***********************************************************************************************************************************
+Read the response to the pending request
+***********************************************************************************************************************************/
+static Buffer *
+httpClientResponseRead(HttpClient *this, bool returnContent)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+    FUNCTION_LOG_END();
 
-                // Check status ends with a CR and remove it to make error formatting easier and more accurate
-                if (!strEndsWith(status, CR_STR))
-                    THROW_FMT(FormatError, "http response status '%s' should be CR-terminated", strPtr(status));
+    ASSERT(this != NULL);
+    ASSERT(this->request != NULL);
 
-                status = strSubN(status, 0, strSize(status) - 1);
+    // Buffer for returned content
+    Buffer *result = NULL;
 
-                // Check status is at least the minimum required length to avoid harder to interpret errors later on
-                if (strSize(status) < sizeof(HTTP_VERSION) + 4)
-                    THROW_FMT(FormatError, "http response '%s' has invalid length", strPtr(strTrim(status)));
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Read status
+        String *status = ioReadLine(ioSessionIoRead(this->ioSession));
 
-                // Check status starts with the correct http version
-                 if (!strBeginsWith(status, HTTP_VERSION_STR))
-                    THROW_FMT(FormatError, "http version of response '%s' must be " HTTP_VERSION, strPtr(status));
+        // Check status ends with a CR and remove it to make error formatting easier and more accurate
+        if (!strEndsWith(status, CR_STR))
+            THROW_FMT(FormatError, "http response status '%s' should be CR-terminated", strPtr(status));
 
-                // Read status code
-                status = strSub(status, sizeof(HTTP_VERSION));
+        status = strSubN(status, 0, strSize(status) - 1);
 
-                int spacePos = strChr(status, ' ');
+        // Check status is at least the minimum required length to avoid harder to interpret errors later on
+        if (strSize(status) < sizeof(HTTP_VERSION) + 4)
+            THROW_FMT(FormatError, "http response '%s' has invalid length", strPtr(strTrim(status)));
 
-                if (spacePos != 3)
-                    THROW_FMT(FormatError, "response status '%s' must have a space after the status code", strPtr(status));
+        // Check status starts with the correct http version
+         if (!strBeginsWith(status, HTTP_VERSION_STR))
+            THROW_FMT(FormatError, "http version of response '%s' must be " HTTP_VERSION, strPtr(status));
 
-                this->responseCode = cvtZToUInt(strPtr(strSubN(status, 0, (size_t)spacePos)));
+        // Read status code
+        status = strSub(status, sizeof(HTTP_VERSION));
 
-                // Read reason phrase. A missing reason phrase will be represented as an empty string.
-                MEM_CONTEXT_BEGIN(this->memContext)
-                {
-                    this->responseMessage = strSub(status, (size_t)spacePos + 1);
-                }
-                MEM_CONTEXT_END();
+        int spacePos = strChr(status, ' ');
 
-                // Read headers
-                MEM_CONTEXT_BEGIN(this->memContext)
-                {
-                    this->responseHeader = httpHeaderNew(NULL);
-                }
-                MEM_CONTEXT_END();
+        if (spacePos != 3)
+            THROW_FMT(FormatError, "response status '%s' must have a space after the status code", strPtr(status));
 
-                do
-                {
-                    // Read the next header
-                    String *header = strTrim(ioReadLine(tlsSessionIoRead(this->tlsSession)));
+        this->responseCode = cvtZToUInt(strPtr(strSubN(status, 0, (size_t)spacePos)));
 
-                    // If the header is empty then we have reached the end of the headers
-                    if (strSize(header) == 0)
-                        break;
+        // Read reason phrase. A missing reason phrase will be represented as an empty string.
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->responseMessage = strSub(status, (size_t)spacePos + 1);
+        }
+        MEM_CONTEXT_END();
 
-                    // Split the header and store it
-                    int colonPos = strChr(header, ':');
+        // Read headers
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->responseHeader = httpHeaderNew(NULL);
+        }
+        MEM_CONTEXT_END();
 
-                    if (colonPos < 0)
-                        THROW_FMT(FormatError, "header '%s' missing colon", strPtr(strTrim(header)));
+        do
+        {
+            // Read the next header
+            String *header = strTrim(ioReadLine(ioSessionIoRead(this->ioSession)));
 
-                    String *headerKey = strLower(strTrim(strSubN(header, 0, (size_t)colonPos)));
-                    String *headerValue = strTrim(strSub(header, (size_t)colonPos + 1));
+            // If the header is empty then we have reached the end of the headers
+            if (strSize(header) == 0)
+                break;
 
-                    httpHeaderAdd(this->responseHeader, headerKey, headerValue);
+            // Split the header and store it
+            int colonPos = strChr(header, ':');
 
-                    // Read transfer encoding (only chunked is supported)
-                    if (strEq(headerKey, HTTP_HEADER_TRANSFER_ENCODING_STR))
-                    {
-                        // Error if transfer encoding is not chunked
-                        if (!strEq(headerValue, HTTP_VALUE_TRANSFER_ENCODING_CHUNKED_STR))
-                        {
-                            THROW_FMT(
-                                FormatError, "only '%s' is supported for '%s' header", HTTP_VALUE_TRANSFER_ENCODING_CHUNKED,
-                                HTTP_HEADER_TRANSFER_ENCODING);
-                        }
-
-                        this->contentChunked = true;
-                    }
+            if (colonPos < 0)
+                THROW_FMT(FormatError, "header '%s' missing colon", strPtr(strTrim(header)));
 
-                    // Read content size
-                    if (strEq(headerKey, HTTP_HEADER_CONTENT_LENGTH_STR))
-                    {
-                        this->contentSize = cvtZToUInt64(strPtr(headerValue));
-                        this->contentRemaining = this->contentSize;
-                    }
+            String *headerKey = strLower(strTrim(strSubN(header, 0, (size_t)colonPos)));
+            String *headerValue = strTrim(strSub(header, (size_t)colonPos + 1));
 
-                    // If the server notified of a closed connection then close the client connection after reading content.  This
-                    // prevents doing a retry on the next request when using the closed connection.
-                    if (strEq(headerKey, HTTP_HEADER_CONNECTION_STR) && strEq(headerValue, HTTP_VALUE_CONNECTION_CLOSE_STR))
-                    {
-                        this->closeOnContentEof = true;
-                        httpClientStatLocal.close++;
-                    }
-                }
-                while (1);
+            httpHeaderAdd(this->responseHeader, headerKey, headerValue);
 
-                // Error if transfer encoding and content length are both set
-                if (this->contentChunked && this->contentSize > 0)
+            // Read transfer encoding (only chunked is supported)
+            if (strEq(headerKey, HTTP_HEADER_TRANSFER_ENCODING_STR))
+            {
+                // Error if transfer encoding is not chunked
+                if (!strEq(headerValue, HTTP_VALUE_TRANSFER_ENCODING_CHUNKED_STR))
                 {
                     THROW_FMT(
-                        FormatError,  "'%s' and '%s' headers are both set", HTTP_HEADER_TRANSFER_ENCODING,
-                        HTTP_HEADER_CONTENT_LENGTH);
+                        FormatError, "only '%s' is supported for '%s' header", HTTP_VALUE_TRANSFER_ENCODING_CHUNKED,
+                        HTTP_HEADER_TRANSFER_ENCODING);
                 }
 
-                // Was content returned in the response?  HEAD will report content but not actually return any.
-                bool contentExists =
-                    (this->contentChunked || this->contentSize > 0 || this->closeOnContentEof) && !strEq(verb, HTTP_VERB_HEAD_STR);
-                this->contentEof = !contentExists;
-
-                // If all content should be returned from this function then read the buffer.  Also read the response if there has
-                // been an error.
-                if (returnContent || !httpClientResponseCodeOk(this))
-                {
-                    if (contentExists)
-                    {
-                        result = bufNew(0);
-
-                        do
-                        {
-                            bufResize(result, bufSize(result) + ioBufferSize());
-                            httpClientRead(this, result, true);
-                        }
-                        while (!httpClientEof(this));
-                    }
-                }
-                // Else create an io object, even if there is no content.  This makes the logic for readers easier -- they can just
-                // check eof rather than also checking if the io object exists.
-                else
-                {
-                    MEM_CONTEXT_BEGIN(this->memContext)
-                    {
-                        this->ioRead = ioReadNewP(this, .eof = httpClientEof, .read = httpClientRead);
-                        ioReadOpen(this->ioRead);
-                    }
-                    MEM_CONTEXT_END();
-                }
+                this->contentChunked = true;
+            }
 
-                // If the server notified that it would close the connection and there is no content then close the client side
-                if (this->closeOnContentEof && !contentExists)
-                {
-                    tlsSessionFree(this->tlsSession);
-                    this->tlsSession = NULL;
-                }
+            // Read content size
+            if (strEq(headerKey, HTTP_HEADER_CONTENT_LENGTH_STR))
+            {
+                this->contentSize = cvtZToUInt64(strPtr(headerValue));
+                this->contentRemaining = this->contentSize;
+            }
 
-                // Retry when response code is 5xx.  These errors generally represent a server error for a request that looks valid.
-                // There are a few errors that might be permanently fatal but they are rare and it seems best not to try and pick
-                // and choose errors in this class to retry.
-                if (httpClientResponseCode(this) / 100 == HTTP_RESPONSE_CODE_RETRY_CLASS)
-                    THROW_FMT(ServiceError, "[%u] %s", httpClientResponseCode(this), strPtr(httpClientResponseMessage(this)));
+            // If the server notified of a closed connection then close the client connection after reading content.  This
+            // prevents doing a retry on the next request when using the closed connection.
+            if (strEq(headerKey, HTTP_HEADER_CONNECTION_STR) && strEq(headerValue, HTTP_VALUE_CONNECTION_CLOSE_STR))
+            {
+                this->closeOnContentEof = true;
+                httpClientStatLocal.close++;
             }
-            CATCH_ANY()
+        }
+        while (1);
+
+        // Error if transfer encoding and content length are both set
+        if (this->contentChunked && this->contentSize > 0)
+        {
+            THROW_FMT(
+                FormatError,  "'%s' and '%s' headers are both set", HTTP_HEADER_TRANSFER_ENCODING, HTTP_HEADER_CONTENT_LENGTH);
+        }
+
+        // Was content returned in the response?  HEAD will report content but not actually return any.
+        bool contentExists =
+            (this->contentChunked || this->contentSize > 0 || this->closeOnContentEof) &&
+            !strEq(this->request->verb, HTTP_VERB_HEAD_STR);
+        this->contentEof = !contentExists;
+
+        // If all content should be returned from this function then read the buffer.  Also read the response if there has been an
+        // error.
+        if (returnContent || !httpClientResponseCodeOk(this))
+        {
+            if (contentExists)
             {
-                tlsSessionFree(this->tlsSession);
-                this->tlsSession = NULL;
+                result = bufNew(0);
 
-                // Retry if wait time has not expired
-                if (waitMore(wait))
+                do
                 {
-                    LOG_DEBUG_FMT("retry %s: %s", errorTypeName(errorType()), errorMessage());
-                    retry = true;
-
-                    httpClientStatLocal.retry++;
+                    bufResize(result, bufSize(result) + ioBufferSize());
+                    httpClientRead(this, result, true);
                 }
-                else
-                    RETHROW();
+                while (!httpClientEof(this));
             }
-            TRY_END();
         }
-        while (retry);
+        // Else create an io object, even if there is no content.  This makes the logic for readers easier -- they can just check
+        // eof rather than also checking if the io object exists.
+        else
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->ioRead = ioReadNewP(this, .eof = httpClientEof, .read = httpClientRead);
+                ioReadOpen(this->ioRead);
+            }
+            MEM_CONTEXT_END();
+        }
 
-        // Move the result buffer (if any) to the parent context
-        bufMove(result, memContextPrior());
+        // If the server notified that it would close the connection and there is no content then close the client side
+        if (this->closeOnContentEof && !contentExists)
+        {
+            ioSessionFree(this->ioSession);
+            this->ioSession = NULL;
+        }
+
+        // Retry when response code is 5xx.  These errors generally represent a server error for a request that looks valid.  There
+        // are a few errors that might be permanently fatal but they are rare and it seems best not to try and pick and choose
+        // errors in this class to retry.
+        if (httpClientResponseCode(this) / 100 == HTTP_RESPONSE_CODE_RETRY_CLASS)
+            THROW_FMT(ServiceError, "[%u] %s", httpClientResponseCode(this), strPtr(httpClientResponseMessage(this)));
 
-        httpClientStatLocal.request++;
+        // Move the result buffer (if any) to the prior context
+        bufMove(result, memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN(BUFFER, result);
 }
 
+/***********************************************************************************************************************************
+Handle an error while writing the request or reading the response. Returns true if the request should be retried.
+***********************************************************************************************************************************/
+static bool
+httpClientRetry(HttpClient *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->request != NULL);
+
+    bool result = false;
+
+    ioSessionFree(this->ioSession);
+    this->ioSession = NULL;
+
+    // Retry if wait time has not expired
+    if (waitMore(this->request->wait))
+    {
+        LOG_DEBUG_FMT("retry %s: %s", errorTypeName(errorType()), errorMessage());
+        result = true;
+
+        this->requestRetry++;
+        httpClientStatLocal.retry++;
+    }
+    // Else free the request so the client is no longer busy
+    else
+    {
+        memContextFree(this->request->memContext);
+        this->request = NULL;
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+void
+httpClientRequestAsync(
+    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
+    const Buffer *body)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
+        FUNCTION_LOG_PARAM(BUFFER, body);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->request == NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+
+    // Free the read interface
+    httpClientDone(this);
+
+    // Store the request so it can be written again if a retry is required
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        MEM_CONTEXT_NEW_BEGIN("HttpClientRequest")
+        {
+            this->request = memNew(sizeof(HttpClientRequest));
+
+            *this->request = (HttpClientRequest)
+            {
+                .memContext = MEM_CONTEXT_NEW(),
+                .wait = waitNew(this->timeout),
+                .verb = strDup(verb),
+                .uri = strDup(uri),
+                .query = httpQueryRender(query),
+                .header = requestHeader == NULL ? NULL : httpHeaderDup(requestHeader, NULL),
+                .body = body,
+            };
+        }
+        MEM_CONTEXT_NEW_END();
+    }
+    MEM_CONTEXT_END();
+
+    this->requestRetry = 0;
+
+    bool retry;
+
+    do
+    {
+        retry = false;
+
+        TRY_BEGIN()
+        {
+            httpClientRequestWrite(this);
+        }
+        CATCH_ANY()
+        {
+            if (httpClientRetry(this))
+                retry = true;
+            else
+                RETHROW();
+        }
+        TRY_END();
+    }
+    while (retry);
+
+    httpClientStatLocal.request++;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+httpClientResponse(HttpClient *this, bool returnContent)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->request != NULL);
+
+    // Buffer for returned content
+    Buffer *result = NULL;
+    bool retry;
+
+    do
+    {
+        retry = false;
+
+        TRY_BEGIN()
+        {
+            // The request is written again before the response is read on retry
+            if (this->ioSession == NULL)
+                httpClientRequestWrite(this);
+
+            result = httpClientResponseRead(this, returnContent);
+        }
+        CATCH_ANY()
+        {
+            if (httpClientRetry(this))
+                retry = true;
+            else
+                RETHROW();
+        }
+        TRY_END();
+    }
+    while (retry);
+
+    // The request is complete
+    memContextFree(this->request->memContext);
+    this->request = NULL;
+    this->sessionTime = timeMSec();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+httpClientRequest(
+    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
+    const Buffer *body, bool returnContent)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
+        FUNCTION_LOG_PARAM(BUFFER, body);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+    FUNCTION_LOG_END();
+
+    httpClientRequestAsync(this, verb, uri, query, requestHeader, body);
+
+    FUNCTION_LOG_RETURN(BUFFER, httpClientResponse(this, returnContent));
+}
+
 /**********************************************************************************************************************************/
 String *
 httpClientStatStr(void)
@@ -527,17 +704,44 @@ httpClientDone(HttpClient *this)
 
     if (this->ioRead != NULL)
     {
-        // If it looks like we were in the middle of a response then close the TLS session so we can start clean next time
+        // If it looks like we were in the middle of a response then close the session so we can start clean next time
         if (!this->contentEof)
         {
-            tlsSessionFree(this->tlsSession);
-            this->tlsSession = NULL;
+            ioSessionFree(this->ioSession);
+            this->ioSession = NULL;
         }
 
         ioReadFree(this->ioRead);
         this->ioRead = NULL;
     }
 
+    // If a response is still pending then close the session since the response will never be read
+    if (this->request != NULL)
+    {
+        ioSessionFree(this->ioSession);
+        this->ioSession = NULL;
+
+        memContextFree(this->request->memContext);
+        this->request = NULL;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+httpClientClose(HttpClient *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!httpClientBusy(this));
+
+    ioSessionFree(this->ioSession);
+    this->ioSession = NULL;
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -551,7 +755,7 @@ httpClientBusy(const HttpClient *this)
 
     ASSERT(this != NULL);
 
-    FUNCTION_TEST_RETURN(this->ioRead);
+    FUNCTION_TEST_RETURN(this->ioRead != NULL || this->request != NULL);
 }
 
 /**********************************************************************************************************************************/
@@ -567,6 +771,19 @@ httpClientIoRead(const HttpClient *this)
     FUNCTION_TEST_RETURN(this->ioRead);
 }
 
+/**********************************************************************************************************************************/
+unsigned int
+httpClientRequestRetry(const HttpClient *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(HTTP_CLIENT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->requestRetry);
+}
+
 /**********************************************************************************************************************************/
 unsigned int
 httpClientResponseCode(const HttpClient *this)
@@ -618,3 +835,30 @@ httpClientResponseMessage(const HttpClient *this)
 
     FUNCTION_TEST_RETURN(this->responseMessage);
 }
+
+/**********************************************************************************************************************************/
+TimeMSec
+httpClientSessionIdle(const HttpClient *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(HTTP_CLIENT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->ioSession != NULL);
+
+    FUNCTION_TEST_RETURN(timeMSec() - this->sessionTime);
+}
+
+/**********************************************************************************************************************************/
+bool
+httpClientSessionOpen(const HttpClient *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(HTTP_CLIENT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->ioSession != NULL);
+}
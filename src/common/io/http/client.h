@@ -4,9 +4,11 @@ Http Client
 A robust HTTP client with connection reuse and automatic retries.
 
 Using a single object to make multiple requests is more efficient because connections are reused whenever possible.  Requests are
-automatically retried when the connection has been closed by the server.  Any 5xx response is also retried.
+automatically retried when the connection has been closed by the server.  Any 5xx response is also retried.  An idle connection that
+has been closed by the server is detected before the next request is written so no retry is required.
 
-Only the HTTPS protocol is currently supported.
+Connections are opened with an IoClient so the same client can be used for HTTPS (see TlsClient) or plain HTTP over a TCP or Unix
+domain socket (see SocketClient).
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_HTTP_CLIENT_H
 #define COMMON_IO_HTTP_CLIENT_H
@@ -19,6 +21,7 @@ Object type
 
 typedef struct HttpClient HttpClient;
 
+#include "common/io/client.h"
 #include "common/io/http/header.h"
 #include "common/io/http/query.h"
 #include "common/io/read.h"
@@ -52,8 +55,10 @@ HTTP Constants
 #define HTTP_HEADER_LAST_MODIFIED                                   "last-modified"
     STRING_DECLARE(HTTP_HEADER_LAST_MODIFIED_STR);
 
+#define HTTP_RESPONSE_CODE_PARTIAL_CONTENT                          206
 #define HTTP_RESPONSE_CODE_FORBIDDEN                                403
 #define HTTP_RESPONSE_CODE_NOT_FOUND                                404
+#define HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE                    416
 
 /***********************************************************************************************************************************
 Statistics
@@ -61,7 +66,7 @@ Statistics
 typedef struct HttpClientStat
 {
     uint64_t object;                                                // Objects created
-    uint64_t session;                                               // TLS sessions created
+    uint64_t session;                                               // Sessions created
     uint64_t request;                                               // Requests (i.e. calls to httpClientRequest())
     uint64_t retry;                                                 // Request retries
     uint64_t close;                                                 // Closes forced by server
@@ -70,16 +75,19 @@ typedef struct HttpClientStat
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-HttpClient *httpClientNew(
-    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+// The io client (e.g. TLS or plain socket) is not owned by the http client and must not be freed while the http client is in use
+HttpClient *httpClientNew(IoClient *ioClient, TimeMSec timeout);
 
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
-// Is the http object busy?
+// Is the http object busy? The client is busy while content is being read or a response is pending.
 bool httpClientBusy(const HttpClient *this);
 
-// Mark the client as done if read is complete
+// Close the session so the next request opens a new one. The client must not be busy.
+void httpClientClose(HttpClient *this);
+
+// Mark the client as done so it can be reused. Content not read and responses not yet received are abandoned.
 void httpClientDone(HttpClient *this);
 
 // Perform a request
@@ -87,6 +95,16 @@ Buffer *httpClientRequest(
     HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
     const Buffer *body, bool returnContent);
 
+// Write a request without waiting for the response. The client is busy until httpClientResponse() is called, so other requests can
+// be sent on other clients in the meantime. The body is not copied and must not be modified or freed until the response is read
+// since it may need to be sent again on retry.
+void httpClientRequestAsync(
+    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
+    const Buffer *body);
+
+// Read the response to a request sent with httpClientRequestAsync(). The request is sent again when the response cannot be read.
+Buffer *httpClientResponse(HttpClient *this, bool returnContent);
+
 // Is this response code OK, i.e. 2XX?
 bool httpClientResponseCodeOk(const HttpClient *this);
 
@@ -99,6 +117,10 @@ Getters/Setters
 // Read interface
 IoRead *httpClientIoRead(const HttpClient *this);
 
+// Retries required by the last request, e.g. because the server responded with a 5xx error. A server that is throttling requests
+// will usually respond with 503 so retries are a signal that requests should be sent more slowly.
+unsigned int httpClientRequestRetry(const HttpClient *this);
+
 // Get the response code
 unsigned int httpClientResponseCode(const HttpClient *this);
 
@@ -108,6 +130,12 @@ const HttpHeader *httpClientResponseHeader(const HttpClient *this);
 // Response message
 const String *httpClientResponseMessage(const HttpClient *this);
 
+// Time in milliseconds since the session was last used. The session must be open.
+TimeMSec httpClientSessionIdle(const HttpClient *this);
+
+// Is a session open? Sessions are kept open between requests unless the server closes them.
+bool httpClientSessionOpen(const HttpClient *this);
+
 /***********************************************************************************************************************************
 Destructor
 ***********************************************************************************************************************************/
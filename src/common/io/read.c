@@ -211,6 +211,29 @@ ioRead(IoRead *this, Buffer *buffer)
     FUNCTION_LOG_RETURN(SIZE, outputRemains - bufRemains(buffer));
 }
 
+/***********************************************************************************************************************************
+Allocate the output buffer if it has not already been allocated. This buffer is not allocated at object creation because it is not
+always used.
+***********************************************************************************************************************************/
+static void
+ioReadOutputAlloc(IoRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, this);
+    FUNCTION_TEST_END();
+
+    if (this->output == NULL)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->output = bufNew(ioBufferSize());
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 The entire string to search for must fit within a single buffer.
 ***********************************************************************************************************************************/
@@ -225,16 +248,7 @@ ioReadLineParam(IoRead *this, bool allowEof)
     ASSERT(this != NULL);
     ASSERT(this->opened && !this->closed);
 
-    // Allocate the output buffer if it has not already been allocated.  This buffer is not allocated at object creation because it
-    // is not always used.
-    if (this->output == NULL)
-    {
-        MEM_CONTEXT_BEGIN(this->memContext)
-        {
-            this->output = bufNew(ioBufferSize());
-        }
-        MEM_CONTEXT_END();
-    }
+    ioReadOutputAlloc(this);
 
     // Search for a linefeed
     String *result = NULL;
@@ -294,6 +308,43 @@ ioReadLine(IoRead *this)
     FUNCTION_LOG_RETURN(STRING, ioReadLineParam(this, false));
 }
 
+/**********************************************************************************************************************************/
+const Buffer *
+ioReadPeek(IoRead *this, size_t size, bool block)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_READ, this);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(BOOL, block);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->opened && !this->closed);
+
+    ioReadOutputAlloc(this);
+
+    ASSERT(size <= bufSize(this->output));
+
+    while (bufUsed(this->output) < size)
+    {
+        // Read from the driver when blocking and stop at eof
+        if (block)
+        {
+            if (this->eofAll)
+                break;
+
+            ioReadInternal(this, this->output, false);
+        }
+        // Else only process input that has already been read from the driver
+        else if (ioFilterGroupInputSame(this->filterGroup))
+            ioFilterGroupProcess(this->filterGroup, this->input, this->output);
+        else
+            break;
+    }
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, this->output);
+}
+
 /**********************************************************************************************************************************/
 void
 ioReadClose(IoRead *this)
@@ -35,6 +35,11 @@ String *ioReadLine(IoRead *this);
 // Read linefeed-terminated string and optionally error on eof
 String *ioReadLineParam(IoRead *this, bool allowEof);
 
+// Buffer at least size bytes without consuming them and return the buffered data, which may contain more than size bytes. The size
+// must not be larger than the buffer size. Fewer than size bytes are returned at eof or, when block is false, if the data has not
+// already been read from the driver.
+const Buffer *ioReadPeek(IoRead *this, size_t size, bool block);
+
 // Close the IO
 void ioReadClose(IoRead *this);
 
@@ -0,0 +1,52 @@
+/***********************************************************************************************************************************
+IO Session Interface
+
+A session is a connection returned by ioClientOpen() that provides IoRead/IoWrite interfaces. Users of a session do not need to know
+which driver (e.g. TLS or a plain socket) implements it.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_SESSION_H
+#define COMMON_IO_SESSION_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define IO_SESSION_TYPE                                             IoSession
+#define IO_SESSION_PREFIX                                           ioSession
+
+typedef struct IoSession IoSession;
+
+#include "common/io/read.h"
+#include "common/io/write.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Close the session gracefully. Freeing the session without closing it drops the connection.
+void ioSessionClose(IoSession *this);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+// File descriptor of the underlying socket, e.g. to check if the peer has closed an idle session
+int ioSessionFd(IoSession *this);
+
+// Read interface
+IoRead *ioSessionIoRead(IoSession *this);
+
+// Write interface
+IoWrite *ioSessionIoWrite(IoSession *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void ioSessionFree(IoSession *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_IO_SESSION_TYPE                                                                                               \
+    IoSession *
+#define FUNCTION_LOG_IO_SESSION_FORMAT(value, buffer, bufferSize)                                                                  \
+    objToLog(value, "IoSession", buffer, bufferSize)
+
+#endif
@@ -0,0 +1,23 @@
+/***********************************************************************************************************************************
+IO Session Interface Internal
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_SESSION_INTERN_H
+#define COMMON_IO_SESSION_INTERN_H
+
+#include "common/io/session.h"
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+typedef struct IoSessionInterface
+{
+    void (*close)(void *driver);
+    int (*fd)(void *driver);
+    IoRead *(*ioRead)(void *driver);
+    IoWrite *(*ioWrite)(void *driver);
+} IoSessionInterface;
+
+// The session must be created in the mem context of the driver since freeing the session frees the driver
+IoSession *ioSessionNew(void *driver, const IoSessionInterface *interface);
+
+#endif
@@ -4,12 +4,15 @@ Socket Client
 #include "build.auto.h"
 
 #include <netinet/in.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 #include "common/debug.h"
 #include "common/log.h"
+#include "common/io/client.intern.h"
 #include "common/io/socket/client.h"
 #include "common/io/socket/common.h"
 #include "common/io/socket/session.h"
@@ -31,13 +34,35 @@ struct SocketClient
     String *host;                                                   // Hostname or IP address
     unsigned int port;                                              // Port to connect to host on
     TimeMSec timeout;                                               // Timeout for any i/o operation (connect, read, etc.)
+    IoClient *ioClient;                                             // Client interface
 };
 
 OBJECT_DEFINE_MOVE(SOCKET_CLIENT);
 
 OBJECT_DEFINE_GET(Host, const, SOCKET_CLIENT, const String *, host);
+OBJECT_DEFINE_GET(IoClient, , SOCKET_CLIENT, IoClient *, ioClient);
 OBJECT_DEFINE_GET(Port, const, SOCKET_CLIENT, unsigned int, port);
 
+/***********************************************************************************************************************************
+Client interface
+***********************************************************************************************************************************/
+static IoSession *
+sckClientOpenDriver(THIS_VOID)
+{
+    THIS(SocketClient);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(SOCKET_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(IO_SESSION, sckSessionIoSession(sckClientOpen(this)));
+}
+
+static const IoClientInterface sckClientInterface =
+{
+    .open = sckClientOpenDriver,
+};
+
 /**********************************************************************************************************************************/
 SocketClient *
 sckClientNew(const String *host, unsigned int port, TimeMSec timeout)
@@ -64,6 +89,8 @@ sckClientNew(const String *host, unsigned int port, TimeMSec timeout)
             .timeout = timeout,
         };
 
+        this->ioClient = ioClientNew(this, &sckClientInterface);
+
         sckClientStatLocal.object++;
     }
     MEM_CONTEXT_NEW_END();
@@ -96,43 +123,71 @@ sckClientOpen(SocketClient *this)
 
             TRY_BEGIN()
             {
-                // Set hints that narrow the type of address we are looking for -- we'll take ipv4 or ipv6
-                struct addrinfo hints = (struct addrinfo)
+                // Connect to a Unix domain socket when the host is a path
+                if (strBeginsWithZ(this->host, "/"))
                 {
-                    .ai_family = AF_UNSPEC,
-                    .ai_socktype = SOCK_STREAM,
-                    .ai_protocol = IPPROTO_TCP,
-                };
+                    struct sockaddr_un address = {.sun_family = AF_UNIX};
 
-                // Convert the port to a zero-terminated string for use with getaddrinfo()
-                char port[CVT_BASE10_BUFFER_SIZE];
-                cvtUIntToZ(this->port, port, sizeof(port));
+                    if (strSize(this->host) >= sizeof(address.sun_path))
+                        THROW_FMT(HostConnectError, "socket path '%s' is too long", strPtr(this->host));
 
-                // Get an address for the host.  We are only going to try the first address returned.
-                struct addrinfo *hostAddress;
-                int resultAddr;
+                    strncpy(address.sun_path, strPtr(this->host), sizeof(address.sun_path) - 1);
 
-                if ((resultAddr = getaddrinfo(strPtr(this->host), port, &hints, &hostAddress)) != 0)
-                {
-                    THROW_FMT(
-                        HostConnectError, "unable to get address for '%s': [%d] %s", strPtr(this->host), resultAddr,
-                        gai_strerror(resultAddr));
-                }
+                    struct addrinfo hostAddress =
+                    {
+                        .ai_family = AF_UNIX,
+                        .ai_socktype = SOCK_STREAM,
+                        .ai_addr = (struct sockaddr *)&address,
+                        .ai_addrlen = sizeof(address),
+                    };
 
-                // Connect to the host
-                TRY_BEGIN()
-                {
-                    fd = socket(hostAddress->ai_family, hostAddress->ai_socktype, hostAddress->ai_protocol);
+                    fd = socket(AF_UNIX, SOCK_STREAM, 0);
                     THROW_ON_SYS_ERROR(fd == -1, HostConnectError, "unable to create socket");
 
-                    sckOptionSet(fd);
-                    sckConnect(fd, this->host, this->port, hostAddress, waitRemaining(wait));
+                    sckOptionSet(fd, false);
+                    sckConnect(fd, this->host, this->port, &hostAddress, waitRemaining(wait));
                 }
-                FINALLY()
+                // Else connect to a TCP socket
+                else
                 {
-                    freeaddrinfo(hostAddress);
+                    // Set hints that narrow the type of address we are looking for -- we'll take ipv4 or ipv6
+                    struct addrinfo hints = (struct addrinfo)
+                    {
+                        .ai_family = AF_UNSPEC,
+                        .ai_socktype = SOCK_STREAM,
+                        .ai_protocol = IPPROTO_TCP,
+                    };
+
+                    // Convert the port to a zero-terminated string for use with getaddrinfo()
+                    char port[CVT_BASE10_BUFFER_SIZE];
+                    cvtUIntToZ(this->port, port, sizeof(port));
+
+                    // Get an address for the host.  We are only going to try the first address returned.
+                    struct addrinfo *hostAddress;
+                    int resultAddr;
+
+                    if ((resultAddr = getaddrinfo(strPtr(this->host), port, &hints, &hostAddress)) != 0)
+                    {
+                        THROW_FMT(
+                            HostConnectError, "unable to get address for '%s': [%d] %s", strPtr(this->host), resultAddr,
+                            gai_strerror(resultAddr));
+                    }
+
+                    // Connect to the host
+                    TRY_BEGIN()
+                    {
+                        fd = socket(hostAddress->ai_family, hostAddress->ai_socktype, hostAddress->ai_protocol);
+                        THROW_ON_SYS_ERROR(fd == -1, HostConnectError, "unable to create socket");
+
+                        sckOptionSet(fd, true);
+                        sckConnect(fd, this->host, this->port, hostAddress, waitRemaining(wait));
+                    }
+                    FINALLY()
+                    {
+                        freeaddrinfo(hostAddress);
+                    }
+                    TRY_END();
                 }
-                TRY_END();
 
                 // Create the session
                 MEM_CONTEXT_PRIOR_BEGIN()
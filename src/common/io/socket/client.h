@@ -1,9 +1,8 @@
 /***********************************************************************************************************************************
 Socket Client
 
-A simple socket client intended to allow access to services that are exposed via a socket.
-
-Currently this is not a full-featured client and is only intended to isolate socket functionality from the tls code.
+A simple socket client intended to allow access to services that are exposed via a socket. If the host begins with / then it is
+treated as the path of a Unix domain socket and the port is ignored.
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_SOCKET_CLIENT_H
 #define COMMON_IO_SOCKET_CLIENT_H
@@ -16,6 +15,7 @@ Object type
 
 typedef struct SocketClient SocketClient;
 
+#include "common/io/client.h"
 #include "common/io/read.h"
 #include "common/io/socket/session.h"
 #include "common/io/write.h"
@@ -55,6 +55,9 @@ Getters/Setters
 // Socket host
 const String *sckClientHost(const SocketClient *this);
 
+// Client interface. Sessions opened with the client interface are plain socket sessions.
+IoClient *sckClientIoClient(SocketClient *this);
+
 // Socket port
 unsigned int sckClientPort(const SocketClient *this);
 
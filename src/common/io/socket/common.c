@@ -58,10 +58,11 @@ sckInit(bool block, bool keepAlive, int tcpKeepAliveCount, int tcpKeepAliveIdle,
 
 /**********************************************************************************************************************************/
 void
-sckOptionSet(int fd)
+sckOptionSet(int fd, bool tcp)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(INT, fd);
+        FUNCTION_TEST_PARAM(BOOL, tcp);
     FUNCTION_TEST_END();
 
     ASSERT(socketLocal.init);
@@ -69,10 +70,13 @@ sckOptionSet(int fd)
     // Disable the Nagle algorithm. This means that segments are always sent as soon as possible, even if there is only a small
     // amount of data. Our internal buffering minimizes the benefit of this optimization so lower latency is preferred.
 #ifdef TCP_NODELAY
-    int socketValue = 1;
+    if (tcp)
+    {
+        int socketValue = 1;
 
-    THROW_ON_SYS_ERROR(
-        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &socketValue, sizeof(int)) == -1, ProtocolError, "unable set TCP_NODELAY");
+        THROW_ON_SYS_ERROR(
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &socketValue, sizeof(int)) == -1, ProtocolError, "unable set TCP_NODELAY");
+    }
 #endif
 
     // Put the socket in non-blocking mode
@@ -91,7 +95,7 @@ sckOptionSet(int fd)
 #endif
 
     // Enable TCP keepalives
-    if (socketLocal.keepAlive)
+    if (tcp && socketLocal.keepAlive)
     {
         int socketValue = 1;
 
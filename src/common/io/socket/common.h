@@ -15,8 +15,8 @@ Functions
 // Initialize settings for socket connections (some are used only for TCP)
 void sckInit(bool block, bool keepAlive, int tcpKeepAliveCount, int tcpKeepAliveIdle, int tcpKeepAliveInterval);
 
-// Set options on a socket
-void sckOptionSet(int fd);
+// Set options on a socket. TCP options are only set for TCP sockets, e.g. not for Unix domain sockets.
+void sckOptionSet(int fd, bool tcp);
 
 // Connect socket to an IP address
 void sckConnect(int fd, const String *host, unsigned int port, const struct addrinfo *hostAddress, TimeMSec timeout);
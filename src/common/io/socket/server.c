@@ -0,0 +1,220 @@
+/***********************************************************************************************************************************
+Socket Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/io/socket/common.h"
+#include "common/io/socket/server.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Maximum number of pending connections on the listening socket
+***********************************************************************************************************************************/
+#define SOCKET_SERVER_BACKLOG                                       64
+
+/***********************************************************************************************************************************
+Time to wait before accepting again when the process or system is out of resources. Accepting immediately would fail again since the
+pending connection is still ready.
+***********************************************************************************************************************************/
+#define SOCKET_SERVER_RESOURCE_RETRY_MSEC                           100
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct SocketServer
+{
+    MemContext *memContext;                                         // Mem context
+    String *address;                                                // Hostname or IP address to listen on
+    unsigned int port;                                              // Port to listen on
+    TimeMSec timeout;                                               // Timeout for any i/o operation on accepted sessions
+    int fd;                                                         // Listening socket file descriptor
+};
+
+OBJECT_DEFINE_MOVE(SOCKET_SERVER);
+
+OBJECT_DEFINE_GET(Address, const, SOCKET_SERVER, const String *, address);
+OBJECT_DEFINE_GET(Fd, const, SOCKET_SERVER, int, fd);
+OBJECT_DEFINE_GET(Port, const, SOCKET_SERVER, unsigned int, port);
+
+OBJECT_DEFINE_FREE(SOCKET_SERVER);
+
+/***********************************************************************************************************************************
+Free listening socket
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(SOCKET_SERVER, LOG, logLevelTrace)
+{
+    close(this->fd);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/**********************************************************************************************************************************/
+SocketServer *
+sckServerNew(const String *address, unsigned int port, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, address);
+        FUNCTION_LOG_PARAM(UINT, port);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(address != NULL);
+
+    SocketServer *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("SocketServer")
+    {
+        this = memNew(sizeof(SocketServer));
+
+        *this = (SocketServer)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .address = strDup(address),
+            .port = port,
+            .timeout = timeout,
+            .fd = -1,
+        };
+
+        // Set hints that narrow the type of address we are looking for -- we'll take ipv4 or ipv6
+        struct addrinfo hints = (struct addrinfo)
+        {
+            .ai_family = AF_UNSPEC,
+            .ai_socktype = SOCK_STREAM,
+            .ai_protocol = IPPROTO_TCP,
+            .ai_flags = AI_PASSIVE,
+        };
+
+        // Convert the port to a zero-terminated string for use with getaddrinfo()
+        char portZ[CVT_BASE10_BUFFER_SIZE];
+        cvtUIntToZ(this->port, portZ, sizeof(portZ));
+
+        // Get an address to listen on. We are only going to try the first address returned.
+        struct addrinfo *serverAddress;
+        int resultAddr;
+
+        if ((resultAddr = getaddrinfo(strPtr(this->address), portZ, &hints, &serverAddress)) != 0)
+        {
+            THROW_FMT(
+                HostConnectError, "unable to get address for '%s': [%d] %s", strPtr(this->address), resultAddr,
+                gai_strerror(resultAddr));
+        }
+
+        TRY_BEGIN()
+        {
+            this->fd = socket(serverAddress->ai_family, serverAddress->ai_socktype, serverAddress->ai_protocol);
+            THROW_ON_SYS_ERROR(this->fd == -1, HostConnectError, "unable to create socket");
+
+            memContextCallbackSet(this->memContext, sckServerFreeResource, this);
+
+            // Allow the address to be reused immediately when the server is restarted
+            int socketValue = 1;
+
+            THROW_ON_SYS_ERROR(
+                setsockopt(this->fd, SOL_SOCKET, SO_REUSEADDR, &socketValue, sizeof(int)) == -1, ProtocolError,
+                "unable set SO_REUSEADDR");
+
+            // Bind the address and start listening
+            THROW_ON_SYS_ERROR_FMT(
+                bind(this->fd, serverAddress->ai_addr, serverAddress->ai_addrlen) == -1, HostConnectError,
+                "unable to bind '%s:%u'", strPtr(this->address), this->port);
+
+            THROW_ON_SYS_ERROR_FMT(
+                listen(this->fd, SOCKET_SERVER_BACKLOG) == -1, HostConnectError, "unable to listen on '%s:%u'",
+                strPtr(this->address), this->port);
+        }
+        FINALLY()
+        {
+            freeaddrinfo(serverAddress);
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(SOCKET_SERVER, this);
+}
+
+/**********************************************************************************************************************************/
+SocketSession *
+sckServerAccept(SocketServer *this, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(SOCKET_SERVER, this);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    SocketSession *result = NULL;
+
+    // Wait for a connection
+    if (sckReadyRead(this->fd, timeout))
+    {
+        int fd = accept(this->fd, NULL, NULL);
+
+        if (fd == -1)
+        {
+            switch (errno)
+            {
+                // The connection was aborted before it could be accepted or the wait was interrupted. Network errors on the pending
+                // connection are also returned by accept() on Linux and should be treated the same way.
+                case EAGAIN:
+#if EWOULDBLOCK != EAGAIN
+                case EWOULDBLOCK:
+#endif
+                case ECONNABORTED:
+                case EINTR:
+                case EPROTO:
+                case ENETDOWN:
+                case ENETUNREACH:
+                case EHOSTUNREACH:
+                case ENOPROTOOPT:
+                case EOPNOTSUPP:
+                    break;
+
+                // Out of resources so the connection stays pending. Wait before trying again so the server does not spin.
+                case EMFILE:
+                case ENFILE:
+                case ENOBUFS:
+                case ENOMEM:
+                {
+                    LOG_WARN_FMT(
+                        "unable to accept connection on '%s:%u': [%d] %s", strPtr(this->address), this->port, errno,
+                        strerror(errno));
+                    sleepMSec(SOCKET_SERVER_RESOURCE_RETRY_MSEC);
+                    break;
+                }
+
+                default:
+                {
+                    THROW_SYS_ERROR_FMT(
+                        HostConnectError, "unable to accept connection on '%s:%u'", strPtr(this->address), this->port);
+                }
+            }
+        }
+        else
+        {
+            // Create the session first so the connection is closed if setting options fails
+            result = sckSessionNew(sckSessionTypeServer, fd, this->address, this->port, this->timeout);
+            sckOptionSet(fd, true);
+        }
+    }
+
+    FUNCTION_LOG_RETURN(SOCKET_SESSION, result);
+}
+
+/**********************************************************************************************************************************/
+String *
+sckServerToLog(const SocketServer *this)
+{
+    return strNewFmt("{address: %s, port: %u, timeout: %" PRIu64 "}", strPtr(this->address), this->port, this->timeout);
+}
@@ -0,0 +1,64 @@
+/***********************************************************************************************************************************
+Socket Server
+
+A simple socket server that listens on an address/port and accepts connections as server sessions. Sessions are usually wrapped by
+another protocol such as TLS.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_SOCKET_SERVER_H
+#define COMMON_IO_SOCKET_SERVER_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define SOCKET_SERVER_TYPE                                          SocketServer
+#define SOCKET_SERVER_PREFIX                                        sckServer
+
+typedef struct SocketServer SocketServer;
+
+#include "common/io/socket/session.h"
+#include "common/time.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+SocketServer *sckServerNew(const String *address, unsigned int port, TimeMSec timeout);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Wait up to timeout for a connection and return it as a server session. NULL is returned when no connection arrives before the
+// timeout or when the connection could not be accepted due to a transient error, e.g. it was aborted by the client.
+SocketSession *sckServerAccept(SocketServer *this, TimeMSec timeout);
+
+// Move to a new parent mem context
+SocketServer *sckServerMove(SocketServer *this, MemContext *parentNew);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+// Address the server is listening on
+const String *sckServerAddress(const SocketServer *this);
+
+// Listening socket file descriptor
+int sckServerFd(const SocketServer *this);
+
+// Port the server is listening on
+unsigned int sckServerPort(const SocketServer *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void sckServerFree(SocketServer *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+String *sckServerToLog(const SocketServer *this);
+
+#define FUNCTION_LOG_SOCKET_SERVER_TYPE                                                                                            \
+    SocketServer *
+#define FUNCTION_LOG_SOCKET_SERVER_FORMAT(value, buffer, bufferSize)                                                               \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, sckServerToLog, buffer, bufferSize)
+
+#endif
@@ -7,8 +7,11 @@ Socket Session
 
 #include "common/debug.h"
 #include "common/log.h"
+#include "common/io/read.intern.h"
+#include "common/io/session.intern.h"
 #include "common/io/socket/client.h"
 #include "common/io/socket/common.h"
+#include "common/io/write.intern.h"
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "common/wait.h"
@@ -24,11 +27,19 @@ struct SocketSession
     String *host;                                                   // Hostname or IP address
     unsigned int port;                                              // Port to connect to host on
     TimeMSec timeout;                                               // Timeout for any i/o operation (connect, read, etc.)
+    bool eof;                                                       // Has the peer closed the connection?
+
+    IoRead *read;                                                   // Read interface
+    IoWrite *write;                                                 // Write interface
+    IoSession *ioSession;                                           // Session interface
 };
 
 OBJECT_DEFINE_MOVE(SOCKET_SESSION);
 
 OBJECT_DEFINE_GET(Fd, , SOCKET_SESSION, int, fd);
+OBJECT_DEFINE_GET(IoRead, , SOCKET_SESSION, IoRead *, read);
+OBJECT_DEFINE_GET(IoSession, , SOCKET_SESSION, IoSession *, ioSession);
+OBJECT_DEFINE_GET(IoWrite, , SOCKET_SESSION, IoWrite *, write);
 OBJECT_DEFINE_GET(Type, const, SOCKET_SESSION, SocketSessionType, type);
 
 OBJECT_DEFINE_FREE(SOCKET_SESSION);
@@ -42,6 +53,183 @@ OBJECT_DEFINE_FREE_RESOURCE_BEGIN(SOCKET_SESSION, LOG, logLevelTrace)
 }
 OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
 
+/**********************************************************************************************************************************/
+void
+sckSessionClose(SocketSession *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SOCKET_SESSION, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // If not already closed
+    if (this->fd != -1)
+    {
+        memContextCallbackClear(this->memContext);
+        sckSessionFreeResource(this);
+        this->fd = -1;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read from the socket
+***********************************************************************************************************************************/
+static size_t
+sckSessionRead(THIS_VOID, Buffer *buffer, bool block)
+{
+    THIS(SocketSession);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SOCKET_SESSION, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+        FUNCTION_LOG_PARAM(BOOL, block);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+    ASSERT(buffer != NULL);
+    ASSERT(!bufFull(buffer));
+
+    ssize_t result = 0;
+
+    // If blocking read keep reading until buffer is full or eof
+    do
+    {
+        sckSessionReadyRead(this);
+
+        result = read(this->fd, bufRemainsPtr(buffer), bufRemains(buffer));
+
+        THROW_ON_SYS_ERROR_FMT(result == -1, FileReadError, "unable to read from '%s:%u'", strPtr(this->host), this->port);
+
+        // If the connection was closed then we are at eof. It is up to the caller to decide if this is an error.
+        if (result == 0)
+        {
+            this->eof = true;
+            break;
+        }
+
+        bufUsedInc(buffer, (size_t)result);
+    }
+    while (block && bufRemains(buffer) > 0);
+
+    FUNCTION_LOG_RETURN(SIZE, (size_t)result);
+}
+
+/***********************************************************************************************************************************
+Write to the socket
+***********************************************************************************************************************************/
+static void
+sckSessionWrite(THIS_VOID, const Buffer *buffer)
+{
+    THIS(SocketSession);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SOCKET_SESSION, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+    ASSERT(buffer != NULL);
+
+    size_t written = 0;
+
+    // Keep writing until all data is written since non-blocking writes may be partial
+    while (written < bufUsed(buffer))
+    {
+        sckSessionReadyWrite(this);
+
+        ssize_t result = write(this->fd, bufPtrConst(buffer) + written, bufUsed(buffer) - written);
+
+        THROW_ON_SYS_ERROR_FMT(result == -1, FileWriteError, "unable to write to '%s:%u'", strPtr(this->host), this->port);
+
+        written += (size_t)result;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Has the connection been closed by the peer?
+***********************************************************************************************************************************/
+static bool
+sckSessionEof(THIS_VOID)
+{
+    THIS(SocketSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SESSION, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->eof);
+}
+
+/***********************************************************************************************************************************
+Session interface
+***********************************************************************************************************************************/
+static void
+sckSessionCloseDriver(THIS_VOID)
+{
+    THIS(SocketSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SESSION, this);
+    FUNCTION_TEST_END();
+
+    sckSessionClose(this);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static int
+sckSessionFdDriver(THIS_VOID)
+{
+    THIS(SocketSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SESSION, this);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(sckSessionFd(this));
+}
+
+static IoRead *
+sckSessionIoReadDriver(THIS_VOID)
+{
+    THIS(SocketSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SESSION, this);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(sckSessionIoRead(this));
+}
+
+static IoWrite *
+sckSessionIoWriteDriver(THIS_VOID)
+{
+    THIS(SocketSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SESSION, this);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(sckSessionIoWrite(this));
+}
+
+static const IoSessionInterface sckSessionInterface =
+{
+    .close = sckSessionCloseDriver,
+    .fd = sckSessionFdDriver,
+    .ioRead = sckSessionIoReadDriver,
+    .ioWrite = sckSessionIoWriteDriver,
+};
+
 /**********************************************************************************************************************************/
 SocketSession *
 sckSessionNew(SocketSessionType type, int fd, const String *host, unsigned int port, TimeMSec timeout)
@@ -74,6 +262,14 @@ sckSessionNew(SocketSessionType type, int fd, const String *host, unsigned int p
         };
 
         memContextCallbackSet(this->memContext, sckSessionFreeResource, this);
+
+        // Create read, write, and session interfaces. These are only used when the socket is not wrapped by another protocol, e.g.
+        // TLS, that reads and writes the socket directly.
+        this->read = ioReadNewP(this, .block = true, .eof = sckSessionEof, .read = sckSessionRead);
+        ioReadOpen(this->read);
+        this->write = ioWriteNewP(this, .write = sckSessionWrite);
+        ioWriteOpen(this->write);
+        this->ioSession = ioSessionNew(this, &sckSessionInterface);
     }
     MEM_CONTEXT_NEW_END();
 
@@ -119,6 +315,22 @@ sckSessionReadyWrite(SocketSession *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+sckSessionTimeoutSet(SocketSession *this, TimeMSec timeout)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SESSION, this);
+        FUNCTION_TEST_PARAM(TIME_MSEC, timeout);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    this->timeout = timeout;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 String *
 sckSessionToLog(const SocketSession *this)
@@ -3,7 +3,7 @@ Socket Session
 
 A simple socket session intended to allow access to services that are exposed via a socket.
 
-Currently this is not a full-featured session and is only intended to isolate socket functionality from the tls code.
+The session can be used directly (e.g. for plain HTTP) through its read/write interfaces or wrapped by another protocol such as TLS.
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_SOCKET_SESSION_H
 #define COMMON_IO_SOCKET_SESSION_H
@@ -25,6 +25,9 @@ Object type
 
 typedef struct SocketSession SocketSession;
 
+#include "common/io/read.h"
+#include "common/io/session.h"
+#include "common/io/write.h"
 #include "common/time.h"
 #include "common/type/string.h"
 
@@ -36,6 +39,9 @@ SocketSession *sckSessionNew(SocketSessionType type, int fd, const String *host,
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+// Close the socket
+void sckSessionClose(SocketSession *this);
+
 // Move to a new parent mem context
 SocketSession *sckSessionMove(SocketSession *this, MemContext *parentNew);
 
@@ -49,6 +55,18 @@ Getters/Setters
 // Socket file descriptor
 int sckSessionFd(SocketSession *this);
 
+// Read interface
+IoRead *sckSessionIoRead(SocketSession *this);
+
+// Session interface. Freeing the session interface frees the socket session.
+IoSession *sckSessionIoSession(SocketSession *this);
+
+// Write interface
+IoWrite *sckSessionIoWrite(SocketSession *this);
+
+// Timeout for any i/o operation
+void sckSessionTimeoutSet(SocketSession *this, TimeMSec timeout);
+
 // Socket type
 SocketSessionType sckSessionType(const SocketSession *this);
 
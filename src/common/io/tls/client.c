@@ -11,6 +11,7 @@ TLS Client
 #include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/log.h"
+#include "common/io/client.intern.h"
 #include "common/io/io.h"
 #include "common/io/tls/client.h"
 #include "common/io/tls/session.intern.h"
@@ -32,10 +33,14 @@ struct TlsClient
     TimeMSec timeout;                                               // Timeout for any i/o operation (connect, read, etc.)
     bool verifyPeer;                                                // Should the peer (server) certificate be verified?
     SocketClient *socketClient;                                     // Socket client
+    IoClient *ioClient;                                             // Client interface
 
     SSL_CTX *context;                                               // TLS context
+    Buffer *session;                                                // Last session issued by the server (encoded) for resumption
 };
 
+OBJECT_DEFINE_GET(IoClient, , TLS_CLIENT, IoClient *, ioClient);
+
 OBJECT_DEFINE_FREE(TLS_CLIENT);
 
 /***********************************************************************************************************************************
@@ -47,9 +52,70 @@ OBJECT_DEFINE_FREE_RESOURCE_BEGIN(TLS_CLIENT, LOG, logLevelTrace)
 }
 OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
 
+/***********************************************************************************************************************************
+Client interface
+***********************************************************************************************************************************/
+static IoSession *
+tlsClientOpenDriver(THIS_VOID)
+{
+    THIS(TlsClient);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(TLS_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(IO_SESSION, tlsSessionIoSession(tlsClientOpen(this)));
+}
+
+static const IoClientInterface tlsClientInterface =
+{
+    .open = tlsClientOpenDriver,
+};
+
+/***********************************************************************************************************************************
+Save a new session issued by the server so the next connection can resume it rather than performing a full handshake. With TLS 1.3
+sessions are issued after the handshake so this may be called while reading.
+
+The session is stored encoded rather than by reference because OpenSSL marks a session as not resumable when a connection using it
+is freed without a TLS shutdown, which is normal when an http session is dropped.
+***********************************************************************************************************************************/
+static int
+tlsClientSessionNew(SSL *tls, SSL_SESSION *session)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, tls);
+        FUNCTION_TEST_PARAM_P(VOID, session);
+    FUNCTION_TEST_END();
+
+    ASSERT(tls != NULL);
+    ASSERT(session != NULL);
+
+    TlsClient *this = SSL_CTX_get_app_data(SSL_get_SSL_CTX(tls));
+    int size = i2d_SSL_SESSION(session, NULL);
+
+    if (size > 0)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            bufFree(this->session);
+            this->session = bufNew((size_t)size);
+        }
+        MEM_CONTEXT_END();
+
+        unsigned char *sessionPtr = bufPtr(this->session);
+        i2d_SSL_SESSION(session, &sessionPtr);
+        bufUsedSet(this->session, (size_t)size);
+    }
+
+    // Return 0 since ownership of the session is not taken
+    FUNCTION_TEST_RETURN(0);
+}
+
 /**********************************************************************************************************************************/
 TlsClient *
-tlsClientNew(SocketClient *socket, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+tlsClientNew(
+    SocketClient *socket, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath, const String *certFile,
+    const String *keyFile)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug)
         FUNCTION_LOG_PARAM(SOCKET_CLIENT, socket);
@@ -57,9 +123,12 @@ tlsClientNew(SocketClient *socket, TimeMSec timeout, bool verifyPeer, const Stri
         FUNCTION_LOG_PARAM(BOOL, verifyPeer);
         FUNCTION_LOG_PARAM(STRING, caFile);
         FUNCTION_LOG_PARAM(STRING, caPath);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
     FUNCTION_LOG_END();
 
     ASSERT(socket != NULL);
+    ASSERT((certFile == NULL && keyFile == NULL) || (certFile != NULL && keyFile != NULL));
 
     TlsClient *this = NULL;
 
@@ -96,6 +165,11 @@ tlsClientNew(SocketClient *socket, TimeMSec timeout, bool verifyPeer, const Stri
         // Disable auto-retry to prevent SSL_read() from hanging
         SSL_CTX_clear_mode(this->context, SSL_MODE_AUTO_RETRY);
 
+        // Save sessions issued by the server on the client rather than in the internal cache, which is not used by clients
+        SSL_CTX_set_app_data(this->context, this);
+        SSL_CTX_set_session_cache_mode(this->context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        SSL_CTX_sess_set_new_cb(this->context, tlsClientSessionNew);
+
         // Set location of CA certificates if the server certificate will be verified
         // -------------------------------------------------------------------------------------------------------------------------
         if (this->verifyPeer)
@@ -112,6 +186,20 @@ tlsClientNew(SocketClient *socket, TimeMSec timeout, bool verifyPeer, const Stri
                 cryptoError(SSL_CTX_set_default_verify_paths(this->context) != 1, "unable to set default CA certificate location");
         }
 
+        // Load the client certificate and key if the server requires the client to authenticate
+        // -------------------------------------------------------------------------------------------------------------------------
+        if (certFile != NULL)
+        {
+            cryptoError(
+                SSL_CTX_use_certificate_chain_file(this->context, strPtr(certFile)) != 1, "unable to load client certificate");
+            cryptoError(
+                SSL_CTX_use_PrivateKey_file(this->context, strPtr(keyFile), SSL_FILETYPE_PEM) != 1, "unable to load client key");
+            cryptoError(SSL_CTX_check_private_key(this->context) != 1, "client key does not match certificate");
+        }
+
+        // Create client interface
+        this->ioClient = ioClientNew(this, &tlsClientInterface);
+
         tlsClientStatLocal.object++;
     }
     MEM_CONTEXT_NEW_END();
@@ -290,6 +378,19 @@ tlsClientOpen(TlsClient *this)
                 // of the TLS session but this is likely to result in program termination so it doesn't seem worth coding for.
                 cryptoError((session = SSL_new(this->context)) == NULL, "unable to create TLS session");
 
+                // Attempt to resume the last session. If the server will not resume it then a full handshake is performed.
+                if (this->session != NULL)
+                {
+                    const unsigned char *sessionPtr = bufPtrConst(this->session);
+                    SSL_SESSION *sessionResume = d2i_SSL_SESSION(NULL, &sessionPtr, (long)bufUsed(this->session));
+                    cryptoError(sessionResume == NULL, "unable to decode TLS session");
+
+                    int result = SSL_set_session(session, sessionResume);
+                    SSL_SESSION_free(sessionResume);
+
+                    cryptoError(result != 1, "unable to set TLS session");
+                }
+
                 // Set server host name used for validation
                 cryptoError(
                     SSL_set_tlsext_host_name(session, strPtr(sckClientHost(this->socketClient))) != 1,
@@ -323,6 +424,9 @@ tlsClientOpen(TlsClient *this)
 
     tlsClientStatLocal.session++;
 
+    if (SSL_session_reused(session))
+        tlsClientStatLocal.resume++;
+
     // Verify that the certificate presented by the server is valid
     if (this->verifyPeer)                                                                                           // {vm_covered}
     {
@@ -365,8 +469,8 @@ tlsClientStatStr(void)
     if (tlsClientStatLocal.object > 0)
     {
         result = strNewFmt(
-            "tls statistics: objects %" PRIu64 ", sessions %" PRIu64 ", retries %" PRIu64, tlsClientStatLocal.object,
-            tlsClientStatLocal.session, tlsClientStatLocal.retry);
+            "tls statistics: objects %" PRIu64 ", sessions %" PRIu64 ", resumes %" PRIu64 ", retries %" PRIu64,
+            tlsClientStatLocal.object, tlsClientStatLocal.session, tlsClientStatLocal.resume, tlsClientStatLocal.retry);
     }
 
     FUNCTION_TEST_RETURN(result);
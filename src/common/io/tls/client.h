@@ -4,7 +4,8 @@ TLS Client
 A simple, secure TLS client intended to allow access to services that are exposed via HTTPS. We call it TLS instead of SSL because
 SSL methods are disabled so only TLS connections are allowed.
 
-This object is intended to be used for multiple TLS sessions so tlsClientOpen() can be called each time a new session is needed.
+This object is intended to be used for multiple TLS sessions so tlsClientOpen() can be called each time a new session is needed. The
+last session issued by the server is resumed when a new session is opened, which avoids a full handshake if the server allows it.
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_TLS_CLIENT_H
 #define COMMON_IO_TLS_CLIENT_H
@@ -17,6 +18,7 @@ Object type
 
 typedef struct TlsClient TlsClient;
 
+#include "common/io/client.h"
 #include "common/io/socket/client.h"
 #include "common/io/tls/session.h"
 
@@ -27,13 +29,16 @@ typedef struct TlsClientStat
 {
     uint64_t object;                                                // Objects created
     uint64_t session;                                               // Sessions created
+    uint64_t resume;                                                // Sessions resumed without a full handshake
     uint64_t retry;                                                 // Connection retries
 } TlsClientStat;
 
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-TlsClient *tlsClientNew(SocketClient *socket, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+TlsClient *tlsClientNew(
+    SocketClient *socket, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath, const String *certFile,
+    const String *keyFile);
 
 /***********************************************************************************************************************************
 Functions
@@ -44,6 +49,12 @@ TlsSession *tlsClientOpen(TlsClient *this);
 // Statistics as a formatted string
 String *tlsClientStatStr(void);
 
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+// Client interface. Sessions opened with the client interface are TLS sessions.
+IoClient *tlsClientIoClient(TlsClient *this);
+
 /***********************************************************************************************************************************
 Destructor
 ***********************************************************************************************************************************/
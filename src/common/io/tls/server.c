@@ -0,0 +1,136 @@
+/***********************************************************************************************************************************
+TLS Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/crypto/common.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/io/tls/server.h"
+#include "common/io/tls/session.intern.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+#include "version.h"
+
+/***********************************************************************************************************************************
+Session id context used to allow session resumption. Any value will do as long as it is the same for all server processes.
+***********************************************************************************************************************************/
+#define TLS_SERVER_SESSION_ID_CONTEXT                               PROJECT_NAME
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct TlsServer
+{
+    MemContext *memContext;                                         // Mem context
+    TimeMSec timeout;                                               // Timeout for any i/o operation (accept, read, etc.)
+
+    SSL_CTX *context;                                               // TLS context
+};
+
+OBJECT_DEFINE_FREE(TLS_SERVER);
+
+/***********************************************************************************************************************************
+Free context
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(TLS_SERVER, LOG, logLevelTrace)
+{
+    SSL_CTX_free(this->context);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/**********************************************************************************************************************************/
+TlsServer *
+tlsServerNew(const String *caFile, const String *certFile, const String *keyFile, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, caFile);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(caFile != NULL);
+    ASSERT(certFile != NULL);
+    ASSERT(keyFile != NULL);
+
+    TlsServer *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("TlsServer")
+    {
+        this = memNew(sizeof(TlsServer));
+
+        *this = (TlsServer)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .timeout = timeout,
+        };
+
+        // Setup TLS context
+        // -------------------------------------------------------------------------------------------------------------------------
+        cryptoInit();
+
+        // Select the TLS method to use. SSL versions will be excluded in SSL_CTX_set_options() as in the client.
+        const SSL_METHOD *method = SSLv23_method();
+        cryptoError(method == NULL, "unable to load TLS method");
+
+        // Create the TLS context
+        this->context = SSL_CTX_new(method);
+        cryptoError(this->context == NULL, "unable to create TLS context");
+
+        memContextCallbackSet(this->memContext, tlsServerFreeResource, this);
+
+        // Exclude SSL versions to only allow TLS and also disable compression
+        SSL_CTX_set_options(this->context, (long)(SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_COMPRESSION));
+
+        // Disable auto-retry to prevent SSL_read() from hanging
+        SSL_CTX_clear_mode(this->context, SSL_MODE_AUTO_RETRY);
+
+        // Set the session id context so clients can resume sessions with the tickets issued by this context
+        cryptoError(
+            SSL_CTX_set_session_id_context(
+                this->context, (const unsigned char *)TLS_SERVER_SESSION_ID_CONTEXT,
+                sizeof(TLS_SERVER_SESSION_ID_CONTEXT) - 1) != 1,
+            "unable to set TLS session id context");
+
+        // Load the server certificate and key
+        // -------------------------------------------------------------------------------------------------------------------------
+        cryptoError(
+            SSL_CTX_use_certificate_chain_file(this->context, strPtr(certFile)) != 1, "unable to load server certificate");
+        cryptoError(
+            SSL_CTX_use_PrivateKey_file(this->context, strPtr(keyFile), SSL_FILETYPE_PEM) != 1, "unable to load server key");
+        cryptoError(SSL_CTX_check_private_key(this->context) != 1, "server key does not match certificate");
+
+        // Require a client certificate signed by the CA
+        // -------------------------------------------------------------------------------------------------------------------------
+        cryptoError(
+            SSL_CTX_load_verify_locations(this->context, strPtr(caFile), NULL) != 1, "unable to load CA certificate");
+        SSL_CTX_set_verify(this->context, SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT, NULL);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(TLS_SERVER, this);
+}
+
+/**********************************************************************************************************************************/
+TlsSession *
+tlsServerAccept(TlsServer *this, SocketSession *socketSession)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(TLS_SERVER, this);
+        FUNCTION_LOG_PARAM(SOCKET_SESSION, socketSession);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(socketSession != NULL);
+    ASSERT(sckSessionType(socketSession) == sckSessionTypeServer);
+
+    // Create internal TLS session
+    SSL *session = SSL_new(this->context);
+    cryptoError(session == NULL, "unable to create TLS session");
+
+    // Negotiate the session. The handshake will fail if the client does not present a certificate signed by the CA.
+    TlsSession *result = tlsSessionNew(session, socketSession, this->timeout);
+
+    FUNCTION_LOG_RETURN(TLS_SESSION, result);
+}
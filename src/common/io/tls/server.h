@@ -0,0 +1,45 @@
+/***********************************************************************************************************************************
+TLS Server
+
+A TLS server that requires clients to present a certificate signed by a trusted CA. The context is created once and used for all
+accepted sessions, so session tickets issued by one session can be used to resume another, even in a forked process.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_TLS_SERVER_H
+#define COMMON_IO_TLS_SERVER_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define TLS_SERVER_TYPE                                             TlsServer
+#define TLS_SERVER_PREFIX                                           tlsServer
+
+typedef struct TlsServer TlsServer;
+
+#include "common/io/socket/session.h"
+#include "common/io/tls/session.h"
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+TlsServer *tlsServerNew(const String *caFile, const String *certFile, const String *keyFile, TimeMSec timeout);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Negotiate a TLS session on an accepted socket session. The socket session is moved to the TLS session.
+TlsSession *tlsServerAccept(TlsServer *this, SocketSession *socketSession);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void tlsServerFree(TlsServer *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_TLS_SERVER_TYPE                                                                                               \
+    TlsServer *
+#define FUNCTION_LOG_TLS_SERVER_FORMAT(value, buffer, bufferSize)                                                                  \
+    objToLog(value, "TlsServer", buffer, bufferSize)
+
+#endif
@@ -4,11 +4,13 @@ TLS Session
 #include "build.auto.h"
 
 #include <openssl/err.h>
+#include <openssl/x509.h>
 
 #include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/io/io.h"
 #include "common/io/read.intern.h"
+#include "common/io/session.intern.h"
 #include "common/io/tls/session.intern.h"
 #include "common/io/write.intern.h"
 #include "common/log.h"
@@ -27,11 +29,13 @@ struct TlsSession
 
     IoRead *read;                                                   // Read interface
     IoWrite *write;                                                 // Write interface
+    IoSession *ioSession;                                           // Session interface
 };
 
 OBJECT_DEFINE_MOVE(TLS_SESSION);
 
 OBJECT_DEFINE_GET(IoRead, , TLS_SESSION, IoRead *, read);
+OBJECT_DEFINE_GET(IoSession, , TLS_SESSION, IoSession *, ioSession);
 OBJECT_DEFINE_GET(IoWrite, , TLS_SESSION, IoWrite *, write);
 
 OBJECT_DEFINE_FREE(TLS_SESSION);
@@ -76,6 +80,49 @@ tlsSessionClose(TlsSession *this, bool shutdown)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+String *
+tlsSessionPeerName(TlsSession *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->session != NULL);
+
+    String *result = NULL;
+    X509 *certificate = SSL_get_peer_certificate(this->session);
+
+    if (certificate != NULL)
+    {
+        TRY_BEGIN()
+        {
+            X509_NAME *subjectName = X509_get_subject_name(certificate);
+            int commonNameIndex = X509_NAME_get_index_by_NID(subjectName, NID_commonName, -1);
+
+            if (commonNameIndex >= 0)
+            {
+                unsigned char *commonName = NULL;
+                int commonNameSize = ASN1_STRING_to_UTF8(
+                    &commonName, X509_NAME_ENTRY_get_data(X509_NAME_get_entry(subjectName, commonNameIndex)));
+
+                cryptoError(commonNameSize < 0, "unable to get certificate common name");
+
+                result = strNewN((const char *)commonName, (size_t)commonNameSize);
+                OPENSSL_free(commonName);
+            }
+        }
+        FINALLY()
+        {
+            X509_free(certificate);
+        }
+        TRY_END();
+    }
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
+
 /***********************************************************************************************************************************
 Process result from SSL_read(), SSL_write(), SSL_connect(), and SSL_accept().
 
@@ -262,6 +309,69 @@ tlsSessionEof(THIS_VOID)
     FUNCTION_LOG_RETURN(BOOL, this->session == NULL);
 }
 
+/***********************************************************************************************************************************
+Session interface
+***********************************************************************************************************************************/
+static void
+tlsSessionCloseDriver(THIS_VOID)
+{
+    THIS(TlsSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SESSION, this);
+    FUNCTION_TEST_END();
+
+    tlsSessionClose(this, true);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static int
+tlsSessionFdDriver(THIS_VOID)
+{
+    THIS(TlsSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SESSION, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this->socketSession != NULL);
+
+    FUNCTION_TEST_RETURN(sckSessionFd(this->socketSession));
+}
+
+static IoRead *
+tlsSessionIoReadDriver(THIS_VOID)
+{
+    THIS(TlsSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SESSION, this);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(tlsSessionIoRead(this));
+}
+
+static IoWrite *
+tlsSessionIoWriteDriver(THIS_VOID)
+{
+    THIS(TlsSession);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SESSION, this);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(tlsSessionIoWrite(this));
+}
+
+static const IoSessionInterface tlsSessionInterface =
+{
+    .close = tlsSessionCloseDriver,
+    .fd = tlsSessionFdDriver,
+    .ioRead = tlsSessionIoReadDriver,
+    .ioWrite = tlsSessionIoWriteDriver,
+};
+
 /**********************************************************************************************************************************/
 TlsSession *
 tlsSessionNew(SSL *session, SocketSession *socketSession, TimeMSec timeout)
@@ -314,6 +424,9 @@ tlsSessionNew(SSL *session, SocketSession *socketSession, TimeMSec timeout)
         ioWriteOpen(this->write);
         this->read = ioReadNewP(this, .block = true, .eof = tlsSessionEof, .read = tlsSessionRead);
         ioReadOpen(this->read);
+
+        // Create session interface
+        this->ioSession = ioSessionNew(this, &tlsSessionInterface);
     }
     MEM_CONTEXT_NEW_END();
 
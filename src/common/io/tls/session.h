@@ -19,6 +19,7 @@ Object type
 typedef struct TlsSession TlsSession;
 
 #include "common/io/read.h"
+#include "common/io/session.h"
 #include "common/io/socket/session.h"
 #include "common/io/write.h"
 
@@ -38,9 +39,16 @@ Getters/Setters
 // Read interface
 IoRead *tlsSessionIoRead(TlsSession *this);
 
+// Session interface. Freeing the session interface frees the TLS session.
+IoSession *tlsSessionIoSession(TlsSession *this);
+
 // Write interface
 IoWrite *tlsSessionIoWrite(TlsSession *this);
 
+// Common name of the certificate presented by the peer or NULL if no certificate was presented. On the server the certificate has
+// already been verified by the handshake.
+String *tlsSessionPeerName(TlsSession *this);
+
 /***********************************************************************************************************************************
 Destructor
 ***********************************************************************************************************************************/
@@ -26,6 +26,7 @@ static const char *const lockTypeName[] =
 {
     "archive",                                                      // lockTypeArchive
     "backup",                                                       // lockTypeBackup
+    "archive-get",                                                  // lockTypeArchiveGet
 };
 
 /***********************************************************************************************************************************
@@ -11,6 +11,7 @@ typedef enum
 {
     lockTypeArchive,
     lockTypeBackup,
+    lockTypeArchiveGet,
     lockTypeAll,
     lockTypeNone,
 } LockType;
@@ -27,7 +28,7 @@ Constants
 Functions
 ***********************************************************************************************************************************/
 // Acquire a lock type. This will involve locking one or more files on disk depending on the lock type.  Most operations only take a
-// single lock (archive or backup), but the stanza commands all need to lock both.
+// single lock (archive, backup, or archive-get), but the stanza commands all need to lock all of them.
 bool lockAcquire(const String *lockPath, const String *stanza, LockType lockType, TimeMSec lockTimeout, bool failOnNoLock);
 
 // Clear the lock without releasing it.  This is used by a master process after it has spawned a child so the child can keep the
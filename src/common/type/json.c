@@ -952,6 +952,14 @@ jsonFromVar(const Variant *var)
         {
             strCat(jsonStr, strPtr(jsonFromBool(varBool(var))));
         }
+        else if (varType(var) == varTypeInt)
+        {
+            strCat(jsonStr, strPtr(jsonFromInt(varInt(var))));
+        }
+        else if (varType(var) == varTypeInt64)
+        {
+            strCat(jsonStr, strPtr(jsonFromInt64(varInt64(var))));
+        }
         else if (varType(var) == varTypeUInt)
         {
             strCat(jsonStr, strPtr(jsonFromUInt(varUInt(var))));
@@ -101,6 +101,7 @@ lstClear(List *this)
         }
         MEM_CONTEXT_END();
 
+        this->list = NULL;
         this->listSize = 0;
         this->listSizeMax = 0;
     }
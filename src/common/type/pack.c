@@ -0,0 +1,396 @@
+/***********************************************************************************************************************************
+Convert Variants to/from Pack Format
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <limits.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/type/keyValue.h"
+#include "common/type/pack.h"
+#include "common/type/variantList.h"
+
+/***********************************************************************************************************************************
+Type of each value. The type is stored in the first byte of the value and must never be renumbered since the client and server must
+agree on it.
+***********************************************************************************************************************************/
+typedef enum
+{
+    packTypeNull = 0,
+    packTypeFalse = 1,
+    packTypeTrue = 2,
+    packTypeInt = 3,
+    packTypeInt64 = 4,
+    packTypeUInt = 5,
+    packTypeUInt64 = 6,
+    packTypeString = 7,
+    packTypeVariantList = 8,
+    packTypeKeyValue = 9,
+} PackType;
+
+// Maximum bytes required to store a 64-bit varint
+#define PACK_VARINT_SIZE_MAX                                        10
+
+/***********************************************************************************************************************************
+Append bytes to the pack. The buffer is grown geometrically since bufCatC() only grows it by the size appended.
+***********************************************************************************************************************************/
+static void
+packCat(Buffer *pack, const unsigned char *data, size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, pack);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, data);
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    if (bufRemains(pack) < size)
+        bufResize(pack, (bufUsed(pack) + size) * 2);
+
+    bufCatC(pack, data, 0, size);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write/read a varint
+***********************************************************************************************************************************/
+static void
+packCatVarInt(Buffer *pack, uint64_t value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, pack);
+        FUNCTION_TEST_PARAM(UINT64, value);
+    FUNCTION_TEST_END();
+
+    unsigned char buffer[PACK_VARINT_SIZE_MAX];
+    size_t bufferSize = 0;
+
+    // Store 7 bits per byte with the high bit set when there are more bytes
+    while (value >= 0x80)
+    {
+        buffer[bufferSize++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+
+    buffer[bufferSize++] = (unsigned char)value;
+
+    packCat(pack, buffer, bufferSize);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static uint64_t
+packReadVarInt(const Buffer *pack, size_t *packPos)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, pack);
+        FUNCTION_TEST_PARAM_P(SIZE, packPos);
+    FUNCTION_TEST_END();
+
+    uint64_t result = 0;
+    unsigned char byte;
+
+    for (unsigned int byteIdx = 0; ; byteIdx++)
+    {
+        if (*packPos == bufUsed(pack))
+            THROW(FormatError, "unexpected end of pack while reading integer");
+
+        if (byteIdx == PACK_VARINT_SIZE_MAX)
+            THROW(FormatError, "integer in pack is too large");
+
+        byte = bufPtrConst(pack)[(*packPos)++];
+        result |= (uint64_t)(byte & 0x7F) << (7 * byteIdx);
+
+        if (byte < 0x80)
+            break;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Zigzag encode signed integers so small negative numbers also require few bytes
+***********************************************************************************************************************************/
+static uint64_t
+packZigZag(int64_t value)
+{
+    return value < 0 ? ~((uint64_t)value << 1) : (uint64_t)value << 1;
+}
+
+static int64_t
+packZigZagUn(uint64_t value)
+{
+    return (value & 1) ? (int64_t)~(value >> 1) : (int64_t)(value >> 1);
+}
+
+/**********************************************************************************************************************************/
+void
+packCatVar(Buffer *pack, const Variant *var)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, pack);
+        FUNCTION_TEST_PARAM(VARIANT, var);
+    FUNCTION_TEST_END();
+
+    ASSERT(pack != NULL);
+
+    unsigned char type;
+
+    // A String Variant may contain a NULL String (e.g. VARSTR(NULL)) which is also stored as null
+    if (var == NULL || (varType(var) == varTypeString && varStr(var) == NULL))
+    {
+        type = packTypeNull;
+        packCat(pack, &type, 1);
+    }
+    else
+    {
+        switch (varType(var))
+        {
+            case varTypeBool:
+            {
+                type = varBool(var) ? packTypeTrue : packTypeFalse;
+                packCat(pack, &type, 1);
+                break;
+            }
+
+            case varTypeInt:
+            {
+                type = packTypeInt;
+                packCat(pack, &type, 1);
+                packCatVarInt(pack, packZigZag(varInt(var)));
+                break;
+            }
+
+            case varTypeInt64:
+            {
+                type = packTypeInt64;
+                packCat(pack, &type, 1);
+                packCatVarInt(pack, packZigZag(varInt64(var)));
+                break;
+            }
+
+            case varTypeUInt:
+            {
+                type = packTypeUInt;
+                packCat(pack, &type, 1);
+                packCatVarInt(pack, varUInt(var));
+                break;
+            }
+
+            case varTypeUInt64:
+            {
+                type = packTypeUInt64;
+                packCat(pack, &type, 1);
+                packCatVarInt(pack, varUInt64(var));
+                break;
+            }
+
+            case varTypeString:
+            {
+                type = packTypeString;
+                packCat(pack, &type, 1);
+                packCatVarInt(pack, strSize(varStr(var)));
+                packCat(pack, (const unsigned char *)strPtr(varStr(var)), strSize(varStr(var)));
+                break;
+            }
+
+            case varTypeVariantList:
+            {
+                const VariantList *list = varVarLst(var);
+
+                type = packTypeVariantList;
+                packCat(pack, &type, 1);
+                packCatVarInt(pack, varLstSize(list));
+
+                for (unsigned int listIdx = 0; listIdx < varLstSize(list); listIdx++)
+                    packCatVar(pack, varLstGet(list, listIdx));
+
+                break;
+            }
+
+            case varTypeKeyValue:
+            {
+                const KeyValue *kv = varKv(var);
+                const VariantList *keyList = kvKeyList(kv);
+
+                type = packTypeKeyValue;
+                packCat(pack, &type, 1);
+                packCatVarInt(pack, varLstSize(keyList));
+
+                for (unsigned int keyIdx = 0; keyIdx < varLstSize(keyList); keyIdx++)
+                {
+                    const Variant *key = varLstGet(keyList, keyIdx);
+
+                    packCatVar(pack, key);
+                    packCatVar(pack, kvGet(kv, key));
+                }
+
+                break;
+            }
+
+            default:
+                THROW(FormatError, "variant type is invalid");
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+packFromVar(const Variant *var)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VARIANT, var);
+    FUNCTION_TEST_END();
+
+    Buffer *result = bufNew(0);
+    packCatVar(result, var);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+Variant *
+packReadVar(const Buffer *pack, size_t *packPos)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, pack);
+        FUNCTION_TEST_PARAM_P(SIZE, packPos);
+    FUNCTION_TEST_END();
+
+    ASSERT(pack != NULL);
+    ASSERT(packPos != NULL);
+
+    if (*packPos == bufUsed(pack))
+        THROW(FormatError, "unexpected end of pack while reading type");
+
+    Variant *result = NULL;
+    unsigned char type = bufPtrConst(pack)[(*packPos)++];
+
+    switch (type)
+    {
+        case packTypeNull:
+            break;
+
+        case packTypeFalse:
+        case packTypeTrue:
+        {
+            result = varNewBool(type == packTypeTrue);
+            break;
+        }
+
+        case packTypeInt:
+        {
+            int64_t value = packZigZagUn(packReadVarInt(pack, packPos));
+
+            if (value < INT_MIN || value > INT_MAX)
+                THROW_FMT(FormatError, "int %" PRId64 " in pack is out of range", value);
+
+            result = varNewInt((int)value);
+            break;
+        }
+
+        case packTypeInt64:
+        {
+            result = varNewInt64(packZigZagUn(packReadVarInt(pack, packPos)));
+            break;
+        }
+
+        case packTypeUInt:
+        {
+            uint64_t value = packReadVarInt(pack, packPos);
+
+            if (value > UINT_MAX)
+                THROW_FMT(FormatError, "unsigned int %" PRIu64 " in pack is out of range", value);
+
+            result = varNewUInt((unsigned int)value);
+            break;
+        }
+
+        case packTypeUInt64:
+        {
+            result = varNewUInt64(packReadVarInt(pack, packPos));
+            break;
+        }
+
+        case packTypeString:
+        {
+            uint64_t size = packReadVarInt(pack, packPos);
+
+            if (size > bufUsed(pack) - *packPos)
+                THROW(FormatError, "unexpected end of pack while reading string");
+
+            result = varNewStr(strNewN((const char *)bufPtrConst(pack) + *packPos, (size_t)size));
+            *packPos += (size_t)size;
+            break;
+        }
+
+        case packTypeVariantList:
+        {
+            uint64_t size = packReadVarInt(pack, packPos);
+
+            // Each value requires at least one byte so the size cannot be larger than the remaining bytes
+            if (size > bufUsed(pack) - *packPos)
+                THROW(FormatError, "unexpected end of pack while reading list");
+
+            // Add values directly to the list of the variant rather than duplicating a list
+            result = varNewVarLst(varLstNew());
+
+            for (uint64_t listIdx = 0; listIdx < size; listIdx++)
+                varLstAdd(varVarLst(result), packReadVar(pack, packPos));
+
+            break;
+        }
+
+        case packTypeKeyValue:
+        {
+            uint64_t size = packReadVarInt(pack, packPos);
+
+            // Each key and value requires at least one byte so the size cannot be larger than half the remaining bytes
+            if (size > (bufUsed(pack) - *packPos) / 2)
+                THROW(FormatError, "unexpected end of pack while reading key/value");
+
+            KeyValue *kv = kvNew();
+
+            for (uint64_t keyIdx = 0; keyIdx < size; keyIdx++)
+            {
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    // The key and value are copied into the KeyValue
+                    Variant *key = packReadVar(pack, packPos);
+                    kvPut(kv, key, packReadVar(pack, packPos));
+                }
+                MEM_CONTEXT_TEMP_END();
+            }
+
+            result = varNewKv(kv);
+            break;
+        }
+
+        default:
+            THROW_FMT(FormatError, "invalid type %u in pack", type);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+Variant *
+packToVar(const Buffer *pack)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, pack);
+    FUNCTION_TEST_END();
+
+    ASSERT(pack != NULL);
+
+    size_t packPos = 0;
+    Variant *result = packReadVar(pack, &packPos);
+
+    if (packPos != bufUsed(pack))
+        THROW_FMT(FormatError, "unexpected %zu byte(s) after value in pack", bufUsed(pack) - packPos);
+
+    FUNCTION_TEST_RETURN(result);
+}
@@ -0,0 +1,29 @@
+/***********************************************************************************************************************************
+Convert Variants to/from Pack Format
+
+Pack is a compact binary format for Variants. Each value is prefixed with its type so it is read back as the same type, and strings
+and containers are prefixed with their size so no parsing is required to find the end of a value. Integers are stored as base-128
+varints (signed integers are zigzag encoded first) so small values require a single byte.
+***********************************************************************************************************************************/
+#ifndef COMMON_TYPE_PACK_H
+#define COMMON_TYPE_PACK_H
+
+#include "common/type/buffer.h"
+#include "common/type/variant.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Append a Variant to a buffer in pack format. The Variant may be NULL.
+void packCatVar(Buffer *pack, const Variant *var);
+
+// Convert a Variant to pack format
+Buffer *packFromVar(const Variant *var);
+
+// Read the Variant that begins at packPos and advance packPos past it
+Variant *packReadVar(const Buffer *pack, size_t *packPos);
+
+// Convert pack format to a Variant. The pack must contain exactly one Variant.
+Variant *packToVar(const Buffer *pack);
+
+#endif
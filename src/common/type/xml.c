@@ -40,6 +40,41 @@ struct XmlDocument
 
 OBJECT_DEFINE_FREE(XML_DOCUMENT);
 
+/***********************************************************************************************************************************
+Stream element type
+***********************************************************************************************************************************/
+typedef struct XmlStreamElementChild
+{
+    const String *name;                                             // Child name
+    const String *content;                                          // Child content
+} XmlStreamElementChild;
+
+struct XmlStreamElement
+{
+    MemContext *memContext;                                         // Mem context for the element
+    const String *name;                                             // Element name
+    String *content;                                                // Element content
+    List *childList;                                                // Child element names and content
+};
+
+/***********************************************************************************************************************************
+Stream type
+***********************************************************************************************************************************/
+struct XmlStream
+{
+    MemContext *memContext;                                         // Mem context for the stream
+    xmlParserCtxtPtr context;                                       // Push parser context
+    XmlStreamCallback *callback;                                    // Callback for each child element of the root node
+    void *callbackData;                                             // User data for callback
+
+    unsigned int depth;                                             // Depth of the current element (the root node is 1)
+    XmlStreamElement *element;                                      // Child element of the root node being parsed
+    String *childContent;                                           // Content of the child element being parsed
+    List *elementList;                                              // Elements parsed but not yet passed to the callback
+};
+
+OBJECT_DEFINE_FREE(XML_STREAM);
+
 /***********************************************************************************************************************************
 Error handler
 
@@ -502,3 +537,313 @@ xmlDocumentRoot(const XmlDocument *this)
 
     FUNCTION_TEST_RETURN(this->root);
 }
+
+/***********************************************************************************************************************************
+Parser callbacks for the stream
+
+Elements are queued rather than passed to the stream callback here because errors must not be thrown through libxml2.
+***********************************************************************************************************************************/
+static void
+xmlStreamSaxElementStart(
+    void *data, const xmlChar *name, const xmlChar *prefix, const xmlChar *uri, int namespaceTotal, const xmlChar **namespaceList,
+    int attributeTotal, int attributeDefaultTotal, const xmlChar **attributeList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(name != NULL);
+
+    (void)prefix;
+    (void)uri;
+    (void)namespaceTotal;
+    (void)namespaceList;
+    (void)attributeTotal;
+    (void)attributeDefaultTotal;
+    (void)attributeList;
+
+    XmlStream *this = data;
+    this->depth++;
+
+    // Start a new element for each child of the root node
+    if (this->depth == 2)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            MEM_CONTEXT_NEW_BEGIN("XmlStreamElement")
+            {
+                this->element = memNew(sizeof(XmlStreamElement));
+
+                *this->element = (XmlStreamElement)
+                {
+                    .memContext = MEM_CONTEXT_NEW(),
+                    .name = strNew((const char *)name),
+                    .content = strNew(""),
+                    .childList = lstNew(sizeof(XmlStreamElementChild)),
+                };
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+    // Else start content for a child of the element
+    else if (this->depth == 3)
+    {
+        MEM_CONTEXT_BEGIN(this->element->memContext)
+        {
+            this->childContent = strNew("");
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static void
+xmlStreamSaxElementEnd(void *data, const xmlChar *name, const xmlChar *prefix, const xmlChar *uri)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(name != NULL);
+
+    (void)prefix;
+    (void)uri;
+
+    XmlStream *this = data;
+
+    // Queue the element for the callback
+    if (this->depth == 2)
+    {
+        lstAdd(this->elementList, &this->element);
+        this->element = NULL;
+    }
+    // Else add the child to the element
+    else if (this->depth == 3)
+    {
+        MEM_CONTEXT_BEGIN(this->element->memContext)
+        {
+            lstAdd(
+                this->element->childList,
+                &(XmlStreamElementChild){.name = strNew((const char *)name), .content = this->childContent});
+        }
+        MEM_CONTEXT_END();
+
+        this->childContent = NULL;
+    }
+
+    this->depth--;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static void
+xmlStreamSaxCharacters(void *data, const xmlChar *content, int contentSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, content);
+        FUNCTION_TEST_PARAM(INT, contentSize);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(content != NULL);
+
+    XmlStream *this = data;
+
+    // Content is only kept for the child elements of the root node and their children. Content may be reported in more than one
+    // part so it is accumulated.
+    if (this->depth == 2 || this->depth == 3)
+    {
+        MEM_CONTEXT_BEGIN(this->element->memContext)
+        {
+            strCatZN(this->depth == 2 ? this->element->content : this->childContent, (const char *)content, (size_t)contentSize);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Free stream
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(XML_STREAM, LOG, logLevelTrace)
+{
+    xmlFreeParserCtxt(this->context);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/**********************************************************************************************************************************/
+XmlStream *
+xmlStreamNew(XmlStreamCallback *callback, void *callbackData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(FUNCTIONP, callback);
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+    FUNCTION_TEST_END();
+
+    ASSERT(callback != NULL);
+
+    xmlInit();
+
+    // Create object
+    XmlStream *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("XmlStream")
+    {
+        this = memNew(sizeof(XmlStream));
+
+        *this = (XmlStream)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .callback = callback,
+            .callbackData = callbackData,
+            .elementList = lstNew(sizeof(XmlStreamElement *)),
+        };
+
+        // Only the handlers needed to report elements and content are set so no tree is built
+        xmlSAXHandler handler =
+        {
+            .initialized = XML_SAX2_MAGIC,
+            .startElementNs = xmlStreamSaxElementStart,
+            .endElementNs = xmlStreamSaxElementEnd,
+            .characters = xmlStreamSaxCharacters,
+        };
+
+        this->context = xmlCreatePushParserCtxt(&handler, this, NULL, 0, "noname.xml");
+        CHECK(this->context != NULL);
+
+        // Set callback to ensure parser context is freed
+        memContextCallbackSet(this->memContext, xmlStreamFreeResource, this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/***********************************************************************************************************************************
+Parse part of the document and pass completed elements to the callback
+***********************************************************************************************************************************/
+static void
+xmlStreamParse(XmlStream *this, const unsigned char *buffer, size_t bufferSize, bool end)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_STREAM, this);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, buffer);
+        FUNCTION_TEST_PARAM(SIZE, bufferSize);
+        FUNCTION_TEST_PARAM(BOOL, end);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    if (xmlParseChunk(this->context, (const char *)buffer, (int)bufferSize, end) != XML_ERR_OK)
+        THROW_FMT(FormatError, "invalid xml");
+
+    for (unsigned int elementIdx = 0; elementIdx < lstSize(this->elementList); elementIdx++)
+    {
+        XmlStreamElement *element = *(XmlStreamElement **)lstGet(this->elementList, elementIdx);
+
+        this->callback(this->callbackData, element);
+        memContextFree(element->memContext);
+    }
+
+    lstClear(this->elementList);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+xmlStreamPush(XmlStream *this, const Buffer *buffer)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_STREAM, this);
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL);
+
+    xmlStreamParse(this, bufPtrConst(buffer), bufUsed(buffer), false);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+xmlStreamEnd(XmlStream *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_STREAM, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    xmlStreamParse(this, NULL, 0, true);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+const String *
+xmlStreamElementChild(const XmlStreamElement *this, const String *name, bool errorOnMissing)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_STREAM_ELEMENT, this);
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM(BOOL, errorOnMissing);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(name != NULL);
+
+    const String *result = NULL;
+
+    for (unsigned int childIdx = 0; childIdx < lstSize(this->childList); childIdx++)
+    {
+        const XmlStreamElementChild *child = lstGet(this->childList, childIdx);
+
+        if (strEq(child->name, name))
+        {
+            result = child->content;
+            break;
+        }
+    }
+
+    if (result == NULL && errorOnMissing)
+        THROW_FMT(FormatError, "unable to find child '%s' in element '%s'", strPtr(name), strPtr(this->name));
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+const String *
+xmlStreamElementContent(const XmlStreamElement *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_STREAM_ELEMENT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->content);
+}
+
+/**********************************************************************************************************************************/
+const String *
+xmlStreamElementName(const XmlStreamElement *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_STREAM_ELEMENT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->name);
+}
@@ -4,6 +4,10 @@ Xml Handler
 A thin wrapper around the libxml2 library.
 
 There are many capabilities of libxml2 that are not exposed here and may need to be added to when implementing new features.
+
+Documents are parsed into a tree that can be queried and modified. Large documents that are only read can instead be parsed as a
+stream with XmlStream, which reports each child element of the root node to a callback as it is parsed without building a tree. Only
+the content of the element and the content of its own children are reported, which is enough for flat documents such as lists.
 ***********************************************************************************************************************************/
 #ifndef COMMON_TYPE_XML_H
 #define COMMON_TYPE_XML_H
@@ -13,10 +17,14 @@ Objects
 ***********************************************************************************************************************************/
 #define XML_DOCUMENT_TYPE                                           XmlDocument
 #define XML_DOCUMENT_PREFIX                                         xmlDocument
+#define XML_STREAM_TYPE                                             XmlStream
+#define XML_STREAM_PREFIX                                           xmlStream
 
 typedef struct XmlDocument XmlDocument;
 typedef struct XmlNode XmlNode;
 typedef struct XmlNodeList XmlNodeList;
+typedef struct XmlStream XmlStream;
+typedef struct XmlStreamElement XmlStreamElement;
 
 #include "common/memContext.h"
 #include "common/type/string.h"
@@ -95,6 +103,40 @@ Node List Destructor
 ***********************************************************************************************************************************/
 void xmlNodeLstFree(XmlNodeList *this);
 
+/***********************************************************************************************************************************
+Stream Constructors
+***********************************************************************************************************************************/
+// Callback for each child element of the root node. The element is only valid until the callback returns.
+typedef void XmlStreamCallback(void *callbackData, const XmlStreamElement *element);
+
+XmlStream *xmlStreamNew(XmlStreamCallback *callback, void *callbackData);
+
+/***********************************************************************************************************************************
+Stream Functions
+***********************************************************************************************************************************/
+// Parse the next part of the document. Elements completed by this part are passed to the callback before the function returns.
+void xmlStreamPush(XmlStream *this, const Buffer *buffer);
+
+// End the document and error if it is not complete
+void xmlStreamEnd(XmlStream *this);
+
+/***********************************************************************************************************************************
+Stream Destructor
+***********************************************************************************************************************************/
+void xmlStreamFree(XmlStream *this);
+
+/***********************************************************************************************************************************
+Element Getters
+***********************************************************************************************************************************/
+// Content of a child element (the first when there are duplicates)
+const String *xmlStreamElementChild(const XmlStreamElement *this, const String *name, bool errorOnMissing);
+
+// Content of an element without children
+const String *xmlStreamElementContent(const XmlStreamElement *this);
+
+// Element name
+const String *xmlStreamElementName(const XmlStreamElement *this);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
@@ -113,4 +155,14 @@ Macros for function logging
 #define FUNCTION_LOG_XML_NODE_LIST_FORMAT(value, buffer, bufferSize)                                                               \
     objToLog(value, "XmlNodeList", buffer, bufferSize)
 
+#define FUNCTION_LOG_XML_STREAM_TYPE                                                                                               \
+    XmlStream *
+#define FUNCTION_LOG_XML_STREAM_FORMAT(value, buffer, bufferSize)                                                                  \
+    objToLog(value, "XmlStream", buffer, bufferSize)
+
+#define FUNCTION_LOG_XML_STREAM_ELEMENT_TYPE                                                                                       \
+    XmlStreamElement *
+#define FUNCTION_LOG_XML_STREAM_ELEMENT_FORMAT(value, buffer, bufferSize)                                                          \
+    objToLog(value, "XmlStreamElement", buffer, bufferSize)
+
 #endif
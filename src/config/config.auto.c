@@ -20,6 +20,7 @@ STRING_EXTERN(CFGCMD_REPO_LS_STR,                                   CFGCMD_REPO_
 STRING_EXTERN(CFGCMD_REPO_PUT_STR,                                  CFGCMD_REPO_PUT);
 STRING_EXTERN(CFGCMD_REPO_RM_STR,                                   CFGCMD_REPO_RM);
 STRING_EXTERN(CFGCMD_RESTORE_STR,                                   CFGCMD_RESTORE);
+STRING_EXTERN(CFGCMD_SERVER_STR,                                    CFGCMD_SERVER);
 STRING_EXTERN(CFGCMD_STANZA_CREATE_STR,                             CFGCMD_STANZA_CREATE);
 STRING_EXTERN(CFGCMD_STANZA_DELETE_STR,                             CFGCMD_STANZA_DELETE);
 STRING_EXTERN(CFGCMD_STANZA_UPGRADE_STR,                            CFGCMD_STANZA_UPGRADE);
@@ -41,7 +42,7 @@ static ConfigCommandData configCommandData[CFG_COMMAND_TOTAL] = CONFIG_COMMAND_L
         CONFIG_COMMAND_LOG_LEVEL_DEFAULT(logLevelInfo)
         CONFIG_COMMAND_LOCK_REQUIRED(false)
         CONFIG_COMMAND_LOCK_REMOTE_REQUIRED(false)
-        CONFIG_COMMAND_LOCK_TYPE(lockTypeArchive)
+        CONFIG_COMMAND_LOCK_TYPE(lockTypeArchiveGet)
         CONFIG_COMMAND_PARAMETER_ALLOWED(true)
     )
 
@@ -201,6 +202,19 @@ static ConfigCommandData configCommandData[CFG_COMMAND_TOTAL] = CONFIG_COMMAND_L
         CONFIG_COMMAND_PARAMETER_ALLOWED(false)
     )
 
+    CONFIG_COMMAND
+    (
+        CONFIG_COMMAND_NAME(CFGCMD_SERVER)
+
+        CONFIG_COMMAND_INTERNAL(false)
+        CONFIG_COMMAND_LOG_FILE(true)
+        CONFIG_COMMAND_LOG_LEVEL_DEFAULT(logLevelInfo)
+        CONFIG_COMMAND_LOCK_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_REMOTE_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
+        CONFIG_COMMAND_PARAMETER_ALLOWED(false)
+    )
+
     CONFIG_COMMAND
     (
         CONFIG_COMMAND_NAME(CFGCMD_STANZA_CREATE)
@@ -285,6 +299,7 @@ Option constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(CFGOPT_ARCHIVE_ASYNC_STR,                             CFGOPT_ARCHIVE_ASYNC);
 STRING_EXTERN(CFGOPT_ARCHIVE_CHECK_STR,                             CFGOPT_ARCHIVE_CHECK);
+STRING_EXTERN(CFGOPT_ARCHIVE_COMPRESS_DICT_STR,                     CFGOPT_ARCHIVE_COMPRESS_DICT);
 STRING_EXTERN(CFGOPT_ARCHIVE_COPY_STR,                              CFGOPT_ARCHIVE_COPY);
 STRING_EXTERN(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR,                     CFGOPT_ARCHIVE_GET_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR,                    CFGOPT_ARCHIVE_PUSH_QUEUE_MAX);
@@ -294,10 +309,13 @@ STRING_EXTERN(CFGOPT_BUFFER_SIZE_STR,                               CFGOPT_BUFFE
 STRING_EXTERN(CFGOPT_CHECKSUM_PAGE_STR,                             CFGOPT_CHECKSUM_PAGE);
 STRING_EXTERN(CFGOPT_CIPHER_PASS_STR,                               CFGOPT_CIPHER_PASS);
 STRING_EXTERN(CFGOPT_CMD_SSH_STR,                                   CFGOPT_CMD_SSH);
+STRING_EXTERN(CFGOPT_CMD_SSH_CONTROL_PATH_STR,                      CFGOPT_CMD_SSH_CONTROL_PATH);
+STRING_EXTERN(CFGOPT_CMD_SSH_CONTROL_PERSIST_STR,                   CFGOPT_CMD_SSH_CONTROL_PERSIST);
 STRING_EXTERN(CFGOPT_COMPRESS_STR,                                  CFGOPT_COMPRESS);
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_STR,                            CFGOPT_COMPRESS_LEVEL);
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_NETWORK_STR,                    CFGOPT_COMPRESS_LEVEL_NETWORK);
 STRING_EXTERN(CFGOPT_COMPRESS_TYPE_STR,                             CFGOPT_COMPRESS_TYPE);
+STRING_EXTERN(CFGOPT_COMPRESS_TYPE_NETWORK_STR,                     CFGOPT_COMPRESS_TYPE_NETWORK);
 STRING_EXTERN(CFGOPT_CONFIG_STR,                                    CFGOPT_CONFIG);
 STRING_EXTERN(CFGOPT_CONFIG_INCLUDE_PATH_STR,                       CFGOPT_CONFIG_INCLUDE_PATH);
 STRING_EXTERN(CFGOPT_CONFIG_PATH_STR,                               CFGOPT_CONFIG_PATH);
@@ -332,6 +350,22 @@ STRING_EXTERN(CFGOPT_PG5_HOST_STR,                                  CFGOPT_PG5_H
 STRING_EXTERN(CFGOPT_PG6_HOST_STR,                                  CFGOPT_PG6_HOST);
 STRING_EXTERN(CFGOPT_PG7_HOST_STR,                                  CFGOPT_PG7_HOST);
 STRING_EXTERN(CFGOPT_PG8_HOST_STR,                                  CFGOPT_PG8_HOST);
+STRING_EXTERN(CFGOPT_PG1_HOST_CA_FILE_STR,                          CFGOPT_PG1_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG2_HOST_CA_FILE_STR,                          CFGOPT_PG2_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG3_HOST_CA_FILE_STR,                          CFGOPT_PG3_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG4_HOST_CA_FILE_STR,                          CFGOPT_PG4_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG5_HOST_CA_FILE_STR,                          CFGOPT_PG5_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG6_HOST_CA_FILE_STR,                          CFGOPT_PG6_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG7_HOST_CA_FILE_STR,                          CFGOPT_PG7_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG8_HOST_CA_FILE_STR,                          CFGOPT_PG8_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG1_HOST_CERT_FILE_STR,                        CFGOPT_PG1_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG2_HOST_CERT_FILE_STR,                        CFGOPT_PG2_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG3_HOST_CERT_FILE_STR,                        CFGOPT_PG3_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG4_HOST_CERT_FILE_STR,                        CFGOPT_PG4_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG5_HOST_CERT_FILE_STR,                        CFGOPT_PG5_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG6_HOST_CERT_FILE_STR,                        CFGOPT_PG6_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG7_HOST_CERT_FILE_STR,                        CFGOPT_PG7_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG8_HOST_CERT_FILE_STR,                        CFGOPT_PG8_HOST_CERT_FILE);
 STRING_EXTERN(CFGOPT_PG1_HOST_CMD_STR,                              CFGOPT_PG1_HOST_CMD);
 STRING_EXTERN(CFGOPT_PG2_HOST_CMD_STR,                              CFGOPT_PG2_HOST_CMD);
 STRING_EXTERN(CFGOPT_PG3_HOST_CMD_STR,                              CFGOPT_PG3_HOST_CMD);
@@ -364,6 +398,14 @@ STRING_EXTERN(CFGOPT_PG5_HOST_CONFIG_PATH_STR,                      CFGOPT_PG5_H
 STRING_EXTERN(CFGOPT_PG6_HOST_CONFIG_PATH_STR,                      CFGOPT_PG6_HOST_CONFIG_PATH);
 STRING_EXTERN(CFGOPT_PG7_HOST_CONFIG_PATH_STR,                      CFGOPT_PG7_HOST_CONFIG_PATH);
 STRING_EXTERN(CFGOPT_PG8_HOST_CONFIG_PATH_STR,                      CFGOPT_PG8_HOST_CONFIG_PATH);
+STRING_EXTERN(CFGOPT_PG1_HOST_KEY_FILE_STR,                         CFGOPT_PG1_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG2_HOST_KEY_FILE_STR,                         CFGOPT_PG2_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG3_HOST_KEY_FILE_STR,                         CFGOPT_PG3_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG4_HOST_KEY_FILE_STR,                         CFGOPT_PG4_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG5_HOST_KEY_FILE_STR,                         CFGOPT_PG5_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG6_HOST_KEY_FILE_STR,                         CFGOPT_PG6_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG7_HOST_KEY_FILE_STR,                         CFGOPT_PG7_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG8_HOST_KEY_FILE_STR,                         CFGOPT_PG8_HOST_KEY_FILE);
 STRING_EXTERN(CFGOPT_PG1_HOST_PORT_STR,                             CFGOPT_PG1_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG2_HOST_PORT_STR,                             CFGOPT_PG2_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG3_HOST_PORT_STR,                             CFGOPT_PG3_HOST_PORT);
@@ -372,6 +414,14 @@ STRING_EXTERN(CFGOPT_PG5_HOST_PORT_STR,                             CFGOPT_PG5_H
 STRING_EXTERN(CFGOPT_PG6_HOST_PORT_STR,                             CFGOPT_PG6_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG7_HOST_PORT_STR,                             CFGOPT_PG7_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG8_HOST_PORT_STR,                             CFGOPT_PG8_HOST_PORT);
+STRING_EXTERN(CFGOPT_PG1_HOST_TYPE_STR,                             CFGOPT_PG1_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG2_HOST_TYPE_STR,                             CFGOPT_PG2_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG3_HOST_TYPE_STR,                             CFGOPT_PG3_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG4_HOST_TYPE_STR,                             CFGOPT_PG4_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG5_HOST_TYPE_STR,                             CFGOPT_PG5_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG6_HOST_TYPE_STR,                             CFGOPT_PG6_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG7_HOST_TYPE_STR,                             CFGOPT_PG7_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG8_HOST_TYPE_STR,                             CFGOPT_PG8_HOST_TYPE);
 STRING_EXTERN(CFGOPT_PG1_HOST_USER_STR,                             CFGOPT_PG1_HOST_USER);
 STRING_EXTERN(CFGOPT_PG2_HOST_USER_STR,                             CFGOPT_PG2_HOST_USER);
 STRING_EXTERN(CFGOPT_PG3_HOST_USER_STR,                             CFGOPT_PG3_HOST_USER);
@@ -422,6 +472,7 @@ STRING_EXTERN(CFGOPT_PG7_USER_STR,                                  CFGOPT_PG7_U
 STRING_EXTERN(CFGOPT_PG8_USER_STR,                                  CFGOPT_PG8_USER);
 STRING_EXTERN(CFGOPT_PROCESS_STR,                                   CFGOPT_PROCESS);
 STRING_EXTERN(CFGOPT_PROCESS_MAX_STR,                               CFGOPT_PROCESS_MAX);
+STRING_EXTERN(CFGOPT_PROCESS_QUEUE_MAX_STR,                         CFGOPT_PROCESS_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_PROTOCOL_TIMEOUT_STR,                          CFGOPT_PROTOCOL_TIMEOUT);
 STRING_EXTERN(CFGOPT_RAW_STR,                                       CFGOPT_RAW);
 STRING_EXTERN(CFGOPT_RECOVERY_OPTION_STR,                           CFGOPT_RECOVERY_OPTION);
@@ -431,11 +482,15 @@ STRING_EXTERN(CFGOPT_REPO1_CIPHER_PASS_STR,                         CFGOPT_REPO1
 STRING_EXTERN(CFGOPT_REPO1_CIPHER_TYPE_STR,                         CFGOPT_REPO1_CIPHER_TYPE);
 STRING_EXTERN(CFGOPT_REPO1_HARDLINK_STR,                            CFGOPT_REPO1_HARDLINK);
 STRING_EXTERN(CFGOPT_REPO1_HOST_STR,                                CFGOPT_REPO1_HOST);
+STRING_EXTERN(CFGOPT_REPO1_HOST_CA_FILE_STR,                        CFGOPT_REPO1_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_REPO1_HOST_CERT_FILE_STR,                      CFGOPT_REPO1_HOST_CERT_FILE);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CMD_STR,                            CFGOPT_REPO1_HOST_CMD);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CONFIG_STR,                         CFGOPT_REPO1_HOST_CONFIG);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CONFIG_INCLUDE_PATH_STR,            CFGOPT_REPO1_HOST_CONFIG_INCLUDE_PATH);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CONFIG_PATH_STR,                    CFGOPT_REPO1_HOST_CONFIG_PATH);
+STRING_EXTERN(CFGOPT_REPO1_HOST_KEY_FILE_STR,                       CFGOPT_REPO1_HOST_KEY_FILE);
 STRING_EXTERN(CFGOPT_REPO1_HOST_PORT_STR,                           CFGOPT_REPO1_HOST_PORT);
+STRING_EXTERN(CFGOPT_REPO1_HOST_TYPE_STR,                           CFGOPT_REPO1_HOST_TYPE);
 STRING_EXTERN(CFGOPT_REPO1_HOST_USER_STR,                           CFGOPT_REPO1_HOST_USER);
 STRING_EXTERN(CFGOPT_REPO1_LOCAL_STR,                               CFGOPT_REPO1_LOCAL);
 STRING_EXTERN(CFGOPT_REPO1_PATH_STR,                                CFGOPT_REPO1_PATH);
@@ -447,13 +502,17 @@ STRING_EXTERN(CFGOPT_REPO1_RETENTION_FULL_TYPE_STR,                 CFGOPT_REPO1
 STRING_EXTERN(CFGOPT_REPO1_S3_BUCKET_STR,                           CFGOPT_REPO1_S3_BUCKET);
 STRING_EXTERN(CFGOPT_REPO1_S3_CA_FILE_STR,                          CFGOPT_REPO1_S3_CA_FILE);
 STRING_EXTERN(CFGOPT_REPO1_S3_CA_PATH_STR,                          CFGOPT_REPO1_S3_CA_PATH);
+STRING_EXTERN(CFGOPT_REPO1_S3_DOWNLOAD_MAX_STR,                     CFGOPT_REPO1_S3_DOWNLOAD_MAX);
 STRING_EXTERN(CFGOPT_REPO1_S3_ENDPOINT_STR,                         CFGOPT_REPO1_S3_ENDPOINT);
 STRING_EXTERN(CFGOPT_REPO1_S3_HOST_STR,                             CFGOPT_REPO1_S3_HOST);
 STRING_EXTERN(CFGOPT_REPO1_S3_KEY_STR,                              CFGOPT_REPO1_S3_KEY);
 STRING_EXTERN(CFGOPT_REPO1_S3_KEY_SECRET_STR,                       CFGOPT_REPO1_S3_KEY_SECRET);
+STRING_EXTERN(CFGOPT_REPO1_S3_LIST_MAX_STR,                         CFGOPT_REPO1_S3_LIST_MAX);
 STRING_EXTERN(CFGOPT_REPO1_S3_PORT_STR,                             CFGOPT_REPO1_S3_PORT);
 STRING_EXTERN(CFGOPT_REPO1_S3_REGION_STR,                           CFGOPT_REPO1_S3_REGION);
+STRING_EXTERN(CFGOPT_REPO1_S3_TLS_STR,                              CFGOPT_REPO1_S3_TLS);
 STRING_EXTERN(CFGOPT_REPO1_S3_TOKEN_STR,                            CFGOPT_REPO1_S3_TOKEN);
+STRING_EXTERN(CFGOPT_REPO1_S3_UPLOAD_MAX_STR,                       CFGOPT_REPO1_S3_UPLOAD_MAX);
 STRING_EXTERN(CFGOPT_REPO1_S3_URI_STYLE_STR,                        CFGOPT_REPO1_S3_URI_STYLE);
 STRING_EXTERN(CFGOPT_REPO1_S3_VERIFY_TLS_STR,                       CFGOPT_REPO1_S3_VERIFY_TLS);
 STRING_EXTERN(CFGOPT_REPO1_TYPE_STR,                                CFGOPT_REPO1_TYPE);
@@ -475,6 +534,13 @@ STRING_EXTERN(CFGOPT_TARGET_TIMELINE_STR,                           CFGOPT_TARGE
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_COUNT_STR,                      CFGOPT_TCP_KEEP_ALIVE_COUNT);
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_IDLE_STR,                       CFGOPT_TCP_KEEP_ALIVE_IDLE);
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_INTERVAL_STR,                   CFGOPT_TCP_KEEP_ALIVE_INTERVAL);
+STRING_EXTERN(CFGOPT_TLS_SERVER_ADDRESS_STR,                        CFGOPT_TLS_SERVER_ADDRESS);
+STRING_EXTERN(CFGOPT_TLS_SERVER_AUTH_STR,                           CFGOPT_TLS_SERVER_AUTH);
+STRING_EXTERN(CFGOPT_TLS_SERVER_CA_FILE_STR,                        CFGOPT_TLS_SERVER_CA_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_CERT_FILE_STR,                      CFGOPT_TLS_SERVER_CERT_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_KEY_FILE_STR,                       CFGOPT_TLS_SERVER_KEY_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_PORT_STR,                           CFGOPT_TLS_SERVER_PORT);
+STRING_EXTERN(CFGOPT_TLS_SERVER_PROCESS_MAX_STR,                    CFGOPT_TLS_SERVER_PROCESS_MAX);
 STRING_EXTERN(CFGOPT_TYPE_STR,                                      CFGOPT_TYPE);
 
 /***********************************************************************************************************************************
@@ -498,6 +564,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptArchiveCheck)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_ARCHIVE_COMPRESS_DICT)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptArchiveCompressDict)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -570,6 +644,22 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptCmdSsh)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_CMD_SSH_CONTROL_PATH)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptCmdSshControlPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_CMD_SSH_CONTROL_PERSIST)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptCmdSshControlPersist)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -602,6 +692,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptCompressType)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_COMPRESS_TYPE_NETWORK)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptCompressTypeNetwork)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -874,6 +972,134 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHost)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1130,6 +1356,70 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostConfigPath)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1194,6 +1484,70 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostPort)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_TYPE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_TYPE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_TYPE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_TYPE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_TYPE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_TYPE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_TYPE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_TYPE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1594,6 +1948,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptProcessMax)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PROCESS_QUEUE_MAX)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptProcessQueueMax)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1666,6 +2028,22 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHost)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostCertFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1698,6 +2076,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostConfigPath)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostKeyFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1706,6 +2092,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostPort)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_TYPE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostType)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1794,6 +2188,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3CaPath)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_S3_DOWNLOAD_MAX)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3DownloadMax)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1826,6 +2228,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3KeySecret)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_S3_LIST_MAX)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3ListMax)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1842,6 +2252,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3Region)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_S3_TLS)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3Tls)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1850,6 +2268,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3Token)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_S3_UPLOAD_MAX)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3UploadMax)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -2018,6 +2444,62 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptTcpKeepAliveInterval)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_ADDRESS)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerAddress)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_AUTH)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerAuth)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_CA_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_CERT_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_KEY_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_PORT)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerPort)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_PROCESS_MAX)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerProcessMax)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -35,6 +35,8 @@ Command constants
     STRING_DECLARE(CFGCMD_REPO_RM_STR);
 #define CFGCMD_RESTORE                                              "restore"
     STRING_DECLARE(CFGCMD_RESTORE_STR);
+#define CFGCMD_SERVER                                               "server"
+    STRING_DECLARE(CFGCMD_SERVER_STR);
 #define CFGCMD_STANZA_CREATE                                        "stanza-create"
     STRING_DECLARE(CFGCMD_STANZA_CREATE_STR);
 #define CFGCMD_STANZA_DELETE                                        "stanza-delete"
@@ -48,7 +50,7 @@ Command constants
 #define CFGCMD_VERSION                                              "version"
     STRING_DECLARE(CFGCMD_VERSION_STR);
 
-#define CFG_COMMAND_TOTAL                                           20
+#define CFG_COMMAND_TOTAL                                           21
 
 /***********************************************************************************************************************************
 Option constants
@@ -57,6 +59,8 @@ Option constants
     STRING_DECLARE(CFGOPT_ARCHIVE_ASYNC_STR);
 #define CFGOPT_ARCHIVE_CHECK                                        "archive-check"
     STRING_DECLARE(CFGOPT_ARCHIVE_CHECK_STR);
+#define CFGOPT_ARCHIVE_COMPRESS_DICT                                "archive-compress-dict"
+    STRING_DECLARE(CFGOPT_ARCHIVE_COMPRESS_DICT_STR);
 #define CFGOPT_ARCHIVE_COPY                                         "archive-copy"
     STRING_DECLARE(CFGOPT_ARCHIVE_COPY_STR);
 #define CFGOPT_ARCHIVE_GET_QUEUE_MAX                                "archive-get-queue-max"
@@ -75,6 +79,10 @@ Option constants
     STRING_DECLARE(CFGOPT_CIPHER_PASS_STR);
 #define CFGOPT_CMD_SSH                                              "cmd-ssh"
     STRING_DECLARE(CFGOPT_CMD_SSH_STR);
+#define CFGOPT_CMD_SSH_CONTROL_PATH                                 "cmd-ssh-control-path"
+    STRING_DECLARE(CFGOPT_CMD_SSH_CONTROL_PATH_STR);
+#define CFGOPT_CMD_SSH_CONTROL_PERSIST                              "cmd-ssh-control-persist"
+    STRING_DECLARE(CFGOPT_CMD_SSH_CONTROL_PERSIST_STR);
 #define CFGOPT_COMPRESS                                             "compress"
     STRING_DECLARE(CFGOPT_COMPRESS_STR);
 #define CFGOPT_COMPRESS_LEVEL                                       "compress-level"
@@ -83,6 +91,8 @@ Option constants
     STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_NETWORK_STR);
 #define CFGOPT_COMPRESS_TYPE                                        "compress-type"
     STRING_DECLARE(CFGOPT_COMPRESS_TYPE_STR);
+#define CFGOPT_COMPRESS_TYPE_NETWORK                                "compress-type-network"
+    STRING_DECLARE(CFGOPT_COMPRESS_TYPE_NETWORK_STR);
 #define CFGOPT_CONFIG                                               "config"
     STRING_DECLARE(CFGOPT_CONFIG_STR);
 #define CFGOPT_CONFIG_INCLUDE_PATH                                  "config-include-path"
@@ -137,6 +147,10 @@ Option constants
     STRING_DECLARE(CFGOPT_OUTPUT_STR);
 #define CFGOPT_PG1_HOST                                             "pg1-host"
     STRING_DECLARE(CFGOPT_PG1_HOST_STR);
+#define CFGOPT_PG1_HOST_CA_FILE                                     "pg1-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG1_HOST_CA_FILE_STR);
+#define CFGOPT_PG1_HOST_CERT_FILE                                   "pg1-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG1_HOST_CERT_FILE_STR);
 #define CFGOPT_PG1_HOST_CMD                                         "pg1-host-cmd"
     STRING_DECLARE(CFGOPT_PG1_HOST_CMD_STR);
 #define CFGOPT_PG1_HOST_CONFIG                                      "pg1-host-config"
@@ -145,8 +159,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG1_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG1_HOST_CONFIG_PATH                                 "pg1-host-config-path"
     STRING_DECLARE(CFGOPT_PG1_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG1_HOST_KEY_FILE                                    "pg1-host-key-file"
+    STRING_DECLARE(CFGOPT_PG1_HOST_KEY_FILE_STR);
 #define CFGOPT_PG1_HOST_PORT                                        "pg1-host-port"
     STRING_DECLARE(CFGOPT_PG1_HOST_PORT_STR);
+#define CFGOPT_PG1_HOST_TYPE                                        "pg1-host-type"
+    STRING_DECLARE(CFGOPT_PG1_HOST_TYPE_STR);
 #define CFGOPT_PG1_HOST_USER                                        "pg1-host-user"
     STRING_DECLARE(CFGOPT_PG1_HOST_USER_STR);
 #define CFGOPT_PG1_LOCAL                                            "pg1-local"
@@ -161,6 +179,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PG1_USER_STR);
 #define CFGOPT_PG2_HOST                                             "pg2-host"
     STRING_DECLARE(CFGOPT_PG2_HOST_STR);
+#define CFGOPT_PG2_HOST_CA_FILE                                     "pg2-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG2_HOST_CA_FILE_STR);
+#define CFGOPT_PG2_HOST_CERT_FILE                                   "pg2-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG2_HOST_CERT_FILE_STR);
 #define CFGOPT_PG2_HOST_CMD                                         "pg2-host-cmd"
     STRING_DECLARE(CFGOPT_PG2_HOST_CMD_STR);
 #define CFGOPT_PG2_HOST_CONFIG                                      "pg2-host-config"
@@ -169,8 +191,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG2_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG2_HOST_CONFIG_PATH                                 "pg2-host-config-path"
     STRING_DECLARE(CFGOPT_PG2_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG2_HOST_KEY_FILE                                    "pg2-host-key-file"
+    STRING_DECLARE(CFGOPT_PG2_HOST_KEY_FILE_STR);
 #define CFGOPT_PG2_HOST_PORT                                        "pg2-host-port"
     STRING_DECLARE(CFGOPT_PG2_HOST_PORT_STR);
+#define CFGOPT_PG2_HOST_TYPE                                        "pg2-host-type"
+    STRING_DECLARE(CFGOPT_PG2_HOST_TYPE_STR);
 #define CFGOPT_PG2_HOST_USER                                        "pg2-host-user"
     STRING_DECLARE(CFGOPT_PG2_HOST_USER_STR);
 #define CFGOPT_PG2_LOCAL                                            "pg2-local"
@@ -185,6 +211,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PG2_USER_STR);
 #define CFGOPT_PG3_HOST                                             "pg3-host"
     STRING_DECLARE(CFGOPT_PG3_HOST_STR);
+#define CFGOPT_PG3_HOST_CA_FILE                                     "pg3-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG3_HOST_CA_FILE_STR);
+#define CFGOPT_PG3_HOST_CERT_FILE                                   "pg3-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG3_HOST_CERT_FILE_STR);
 #define CFGOPT_PG3_HOST_CMD                                         "pg3-host-cmd"
     STRING_DECLARE(CFGOPT_PG3_HOST_CMD_STR);
 #define CFGOPT_PG3_HOST_CONFIG                                      "pg3-host-config"
@@ -193,8 +223,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG3_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG3_HOST_CONFIG_PATH                                 "pg3-host-config-path"
     STRING_DECLARE(CFGOPT_PG3_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG3_HOST_KEY_FILE                                    "pg3-host-key-file"
+    STRING_DECLARE(CFGOPT_PG3_HOST_KEY_FILE_STR);
 #define CFGOPT_PG3_HOST_PORT                                        "pg3-host-port"
     STRING_DECLARE(CFGOPT_PG3_HOST_PORT_STR);
+#define CFGOPT_PG3_HOST_TYPE                                        "pg3-host-type"
+    STRING_DECLARE(CFGOPT_PG3_HOST_TYPE_STR);
 #define CFGOPT_PG3_HOST_USER                                        "pg3-host-user"
     STRING_DECLARE(CFGOPT_PG3_HOST_USER_STR);
 #define CFGOPT_PG3_LOCAL                                            "pg3-local"
@@ -209,6 +243,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PG3_USER_STR);
 #define CFGOPT_PG4_HOST                                             "pg4-host"
     STRING_DECLARE(CFGOPT_PG4_HOST_STR);
+#define CFGOPT_PG4_HOST_CA_FILE                                     "pg4-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG4_HOST_CA_FILE_STR);
+#define CFGOPT_PG4_HOST_CERT_FILE                                   "pg4-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG4_HOST_CERT_FILE_STR);
 #define CFGOPT_PG4_HOST_CMD                                         "pg4-host-cmd"
     STRING_DECLARE(CFGOPT_PG4_HOST_CMD_STR);
 #define CFGOPT_PG4_HOST_CONFIG                                      "pg4-host-config"
@@ -217,8 +255,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG4_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG4_HOST_CONFIG_PATH                                 "pg4-host-config-path"
     STRING_DECLARE(CFGOPT_PG4_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG4_HOST_KEY_FILE                                    "pg4-host-key-file"
+    STRING_DECLARE(CFGOPT_PG4_HOST_KEY_FILE_STR);
 #define CFGOPT_PG4_HOST_PORT                                        "pg4-host-port"
     STRING_DECLARE(CFGOPT_PG4_HOST_PORT_STR);
+#define CFGOPT_PG4_HOST_TYPE                                        "pg4-host-type"
+    STRING_DECLARE(CFGOPT_PG4_HOST_TYPE_STR);
 #define CFGOPT_PG4_HOST_USER                                        "pg4-host-user"
     STRING_DECLARE(CFGOPT_PG4_HOST_USER_STR);
 #define CFGOPT_PG4_LOCAL                                            "pg4-local"
@@ -233,6 +275,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PG4_USER_STR);
 #define CFGOPT_PG5_HOST                                             "pg5-host"
     STRING_DECLARE(CFGOPT_PG5_HOST_STR);
+#define CFGOPT_PG5_HOST_CA_FILE                                     "pg5-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG5_HOST_CA_FILE_STR);
+#define CFGOPT_PG5_HOST_CERT_FILE                                   "pg5-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG5_HOST_CERT_FILE_STR);
 #define CFGOPT_PG5_HOST_CMD                                         "pg5-host-cmd"
     STRING_DECLARE(CFGOPT_PG5_HOST_CMD_STR);
 #define CFGOPT_PG5_HOST_CONFIG                                      "pg5-host-config"
@@ -241,8 +287,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG5_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG5_HOST_CONFIG_PATH                                 "pg5-host-config-path"
     STRING_DECLARE(CFGOPT_PG5_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG5_HOST_KEY_FILE                                    "pg5-host-key-file"
+    STRING_DECLARE(CFGOPT_PG5_HOST_KEY_FILE_STR);
 #define CFGOPT_PG5_HOST_PORT                                        "pg5-host-port"
     STRING_DECLARE(CFGOPT_PG5_HOST_PORT_STR);
+#define CFGOPT_PG5_HOST_TYPE                                        "pg5-host-type"
+    STRING_DECLARE(CFGOPT_PG5_HOST_TYPE_STR);
 #define CFGOPT_PG5_HOST_USER                                        "pg5-host-user"
     STRING_DECLARE(CFGOPT_PG5_HOST_USER_STR);
 #define CFGOPT_PG5_LOCAL                                            "pg5-local"
@@ -257,6 +307,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PG5_USER_STR);
 #define CFGOPT_PG6_HOST                                             "pg6-host"
     STRING_DECLARE(CFGOPT_PG6_HOST_STR);
+#define CFGOPT_PG6_HOST_CA_FILE                                     "pg6-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG6_HOST_CA_FILE_STR);
+#define CFGOPT_PG6_HOST_CERT_FILE                                   "pg6-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG6_HOST_CERT_FILE_STR);
 #define CFGOPT_PG6_HOST_CMD                                         "pg6-host-cmd"
     STRING_DECLARE(CFGOPT_PG6_HOST_CMD_STR);
 #define CFGOPT_PG6_HOST_CONFIG                                      "pg6-host-config"
@@ -265,8 +319,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG6_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG6_HOST_CONFIG_PATH                                 "pg6-host-config-path"
     STRING_DECLARE(CFGOPT_PG6_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG6_HOST_KEY_FILE                                    "pg6-host-key-file"
+    STRING_DECLARE(CFGOPT_PG6_HOST_KEY_FILE_STR);
 #define CFGOPT_PG6_HOST_PORT                                        "pg6-host-port"
     STRING_DECLARE(CFGOPT_PG6_HOST_PORT_STR);
+#define CFGOPT_PG6_HOST_TYPE                                        "pg6-host-type"
+    STRING_DECLARE(CFGOPT_PG6_HOST_TYPE_STR);
 #define CFGOPT_PG6_HOST_USER                                        "pg6-host-user"
     STRING_DECLARE(CFGOPT_PG6_HOST_USER_STR);
 #define CFGOPT_PG6_LOCAL                                            "pg6-local"
@@ -281,6 +339,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PG6_USER_STR);
 #define CFGOPT_PG7_HOST                                             "pg7-host"
     STRING_DECLARE(CFGOPT_PG7_HOST_STR);
+#define CFGOPT_PG7_HOST_CA_FILE                                     "pg7-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG7_HOST_CA_FILE_STR);
+#define CFGOPT_PG7_HOST_CERT_FILE                                   "pg7-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG7_HOST_CERT_FILE_STR);
 #define CFGOPT_PG7_HOST_CMD                                         "pg7-host-cmd"
     STRING_DECLARE(CFGOPT_PG7_HOST_CMD_STR);
 #define CFGOPT_PG7_HOST_CONFIG                                      "pg7-host-config"
@@ -289,8 +351,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG7_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG7_HOST_CONFIG_PATH                                 "pg7-host-config-path"
     STRING_DECLARE(CFGOPT_PG7_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG7_HOST_KEY_FILE                                    "pg7-host-key-file"
+    STRING_DECLARE(CFGOPT_PG7_HOST_KEY_FILE_STR);
 #define CFGOPT_PG7_HOST_PORT                                        "pg7-host-port"
     STRING_DECLARE(CFGOPT_PG7_HOST_PORT_STR);
+#define CFGOPT_PG7_HOST_TYPE                                        "pg7-host-type"
+    STRING_DECLARE(CFGOPT_PG7_HOST_TYPE_STR);
 #define CFGOPT_PG7_HOST_USER                                        "pg7-host-user"
     STRING_DECLARE(CFGOPT_PG7_HOST_USER_STR);
 #define CFGOPT_PG7_LOCAL                                            "pg7-local"
@@ -305,6 +371,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PG7_USER_STR);
 #define CFGOPT_PG8_HOST                                             "pg8-host"
     STRING_DECLARE(CFGOPT_PG8_HOST_STR);
+#define CFGOPT_PG8_HOST_CA_FILE                                     "pg8-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG8_HOST_CA_FILE_STR);
+#define CFGOPT_PG8_HOST_CERT_FILE                                   "pg8-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG8_HOST_CERT_FILE_STR);
 #define CFGOPT_PG8_HOST_CMD                                         "pg8-host-cmd"
     STRING_DECLARE(CFGOPT_PG8_HOST_CMD_STR);
 #define CFGOPT_PG8_HOST_CONFIG                                      "pg8-host-config"
@@ -313,8 +383,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG8_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG8_HOST_CONFIG_PATH                                 "pg8-host-config-path"
     STRING_DECLARE(CFGOPT_PG8_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG8_HOST_KEY_FILE                                    "pg8-host-key-file"
+    STRING_DECLARE(CFGOPT_PG8_HOST_KEY_FILE_STR);
 #define CFGOPT_PG8_HOST_PORT                                        "pg8-host-port"
     STRING_DECLARE(CFGOPT_PG8_HOST_PORT_STR);
+#define CFGOPT_PG8_HOST_TYPE                                        "pg8-host-type"
+    STRING_DECLARE(CFGOPT_PG8_HOST_TYPE_STR);
 #define CFGOPT_PG8_HOST_USER                                        "pg8-host-user"
     STRING_DECLARE(CFGOPT_PG8_HOST_USER_STR);
 #define CFGOPT_PG8_LOCAL                                            "pg8-local"
@@ -331,6 +405,8 @@ Option constants
     STRING_DECLARE(CFGOPT_PROCESS_STR);
 #define CFGOPT_PROCESS_MAX                                          "process-max"
     STRING_DECLARE(CFGOPT_PROCESS_MAX_STR);
+#define CFGOPT_PROCESS_QUEUE_MAX                                    "process-queue-max"
+    STRING_DECLARE(CFGOPT_PROCESS_QUEUE_MAX_STR);
 #define CFGOPT_PROTOCOL_TIMEOUT                                     "protocol-timeout"
     STRING_DECLARE(CFGOPT_PROTOCOL_TIMEOUT_STR);
 #define CFGOPT_RAW                                                  "raw"
@@ -349,6 +425,10 @@ Option constants
     STRING_DECLARE(CFGOPT_REPO1_HARDLINK_STR);
 #define CFGOPT_REPO1_HOST                                           "repo1-host"
     STRING_DECLARE(CFGOPT_REPO1_HOST_STR);
+#define CFGOPT_REPO1_HOST_CA_FILE                                   "repo1-host-ca-file"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_CA_FILE_STR);
+#define CFGOPT_REPO1_HOST_CERT_FILE                                 "repo1-host-cert-file"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_CERT_FILE_STR);
 #define CFGOPT_REPO1_HOST_CMD                                       "repo1-host-cmd"
     STRING_DECLARE(CFGOPT_REPO1_HOST_CMD_STR);
 #define CFGOPT_REPO1_HOST_CONFIG                                    "repo1-host-config"
@@ -357,8 +437,12 @@ Option constants
     STRING_DECLARE(CFGOPT_REPO1_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_REPO1_HOST_CONFIG_PATH                               "repo1-host-config-path"
     STRING_DECLARE(CFGOPT_REPO1_HOST_CONFIG_PATH_STR);
+#define CFGOPT_REPO1_HOST_KEY_FILE                                  "repo1-host-key-file"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_KEY_FILE_STR);
 #define CFGOPT_REPO1_HOST_PORT                                      "repo1-host-port"
     STRING_DECLARE(CFGOPT_REPO1_HOST_PORT_STR);
+#define CFGOPT_REPO1_HOST_TYPE                                      "repo1-host-type"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_TYPE_STR);
 #define CFGOPT_REPO1_HOST_USER                                      "repo1-host-user"
     STRING_DECLARE(CFGOPT_REPO1_HOST_USER_STR);
 #define CFGOPT_REPO1_LOCAL                                          "repo1-local"
@@ -381,6 +465,8 @@ Option constants
     STRING_DECLARE(CFGOPT_REPO1_S3_CA_FILE_STR);
 #define CFGOPT_REPO1_S3_CA_PATH                                     "repo1-s3-ca-path"
     STRING_DECLARE(CFGOPT_REPO1_S3_CA_PATH_STR);
+#define CFGOPT_REPO1_S3_DOWNLOAD_MAX                                "repo1-s3-download-max"
+    STRING_DECLARE(CFGOPT_REPO1_S3_DOWNLOAD_MAX_STR);
 #define CFGOPT_REPO1_S3_ENDPOINT                                    "repo1-s3-endpoint"
     STRING_DECLARE(CFGOPT_REPO1_S3_ENDPOINT_STR);
 #define CFGOPT_REPO1_S3_HOST                                        "repo1-s3-host"
@@ -389,12 +475,18 @@ Option constants
     STRING_DECLARE(CFGOPT_REPO1_S3_KEY_STR);
 #define CFGOPT_REPO1_S3_KEY_SECRET                                  "repo1-s3-key-secret"
     STRING_DECLARE(CFGOPT_REPO1_S3_KEY_SECRET_STR);
+#define CFGOPT_REPO1_S3_LIST_MAX                                    "repo1-s3-list-max"
+    STRING_DECLARE(CFGOPT_REPO1_S3_LIST_MAX_STR);
 #define CFGOPT_REPO1_S3_PORT                                        "repo1-s3-port"
     STRING_DECLARE(CFGOPT_REPO1_S3_PORT_STR);
 #define CFGOPT_REPO1_S3_REGION                                      "repo1-s3-region"
     STRING_DECLARE(CFGOPT_REPO1_S3_REGION_STR);
+#define CFGOPT_REPO1_S3_TLS                                         "repo1-s3-tls"
+    STRING_DECLARE(CFGOPT_REPO1_S3_TLS_STR);
 #define CFGOPT_REPO1_S3_TOKEN                                       "repo1-s3-token"
     STRING_DECLARE(CFGOPT_REPO1_S3_TOKEN_STR);
+#define CFGOPT_REPO1_S3_UPLOAD_MAX                                  "repo1-s3-upload-max"
+    STRING_DECLARE(CFGOPT_REPO1_S3_UPLOAD_MAX_STR);
 #define CFGOPT_REPO1_S3_URI_STYLE                                   "repo1-s3-uri-style"
     STRING_DECLARE(CFGOPT_REPO1_S3_URI_STYLE_STR);
 #define CFGOPT_REPO1_S3_VERIFY_TLS                                  "repo1-s3-verify-tls"
@@ -437,10 +529,24 @@ Option constants
     STRING_DECLARE(CFGOPT_TCP_KEEP_ALIVE_IDLE_STR);
 #define CFGOPT_TCP_KEEP_ALIVE_INTERVAL                              "tcp-keep-alive-interval"
     STRING_DECLARE(CFGOPT_TCP_KEEP_ALIVE_INTERVAL_STR);
+#define CFGOPT_TLS_SERVER_ADDRESS                                   "tls-server-address"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_ADDRESS_STR);
+#define CFGOPT_TLS_SERVER_AUTH                                      "tls-server-auth"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_AUTH_STR);
+#define CFGOPT_TLS_SERVER_CA_FILE                                   "tls-server-ca-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_CA_FILE_STR);
+#define CFGOPT_TLS_SERVER_CERT_FILE                                 "tls-server-cert-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_CERT_FILE_STR);
+#define CFGOPT_TLS_SERVER_KEY_FILE                                  "tls-server-key-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_KEY_FILE_STR);
+#define CFGOPT_TLS_SERVER_PORT                                      "tls-server-port"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_PORT_STR);
+#define CFGOPT_TLS_SERVER_PROCESS_MAX                               "tls-server-process-max"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_PROCESS_MAX_STR);
 #define CFGOPT_TYPE                                                 "type"
     STRING_DECLARE(CFGOPT_TYPE_STR);
 
-#define CFG_OPTION_TOTAL                                            193
+#define CFG_OPTION_TOTAL                                            245
 
 /***********************************************************************************************************************************
 Command enum
@@ -460,6 +566,7 @@ typedef enum
     cfgCmdRepoPut,
     cfgCmdRepoRm,
     cfgCmdRestore,
+    cfgCmdServer,
     cfgCmdStanzaCreate,
     cfgCmdStanzaDelete,
     cfgCmdStanzaUpgrade,
@@ -476,6 +583,7 @@ typedef enum
 {
     cfgOptArchiveAsync,
     cfgOptArchiveCheck,
+    cfgOptArchiveCompressDict,
     cfgOptArchiveCopy,
     cfgOptArchiveGetQueueMax,
     cfgOptArchivePushQueueMax,
@@ -485,10 +593,13 @@ typedef enum
     cfgOptChecksumPage,
     cfgOptCipherPass,
     cfgOptCmdSsh,
+    cfgOptCmdSshControlPath,
+    cfgOptCmdSshControlPersist,
     cfgOptCompress,
     cfgOptCompressLevel,
     cfgOptCompressLevelNetwork,
     cfgOptCompressType,
+    cfgOptCompressTypeNetwork,
     cfgOptConfig,
     cfgOptConfigIncludePath,
     cfgOptConfigPath,
@@ -523,6 +634,22 @@ typedef enum
     cfgOptPgHost6,
     cfgOptPgHost7,
     cfgOptPgHost8,
+    cfgOptPgHostCaFile,
+    cfgOptPgHostCaFile2,
+    cfgOptPgHostCaFile3,
+    cfgOptPgHostCaFile4,
+    cfgOptPgHostCaFile5,
+    cfgOptPgHostCaFile6,
+    cfgOptPgHostCaFile7,
+    cfgOptPgHostCaFile8,
+    cfgOptPgHostCertFile,
+    cfgOptPgHostCertFile2,
+    cfgOptPgHostCertFile3,
+    cfgOptPgHostCertFile4,
+    cfgOptPgHostCertFile5,
+    cfgOptPgHostCertFile6,
+    cfgOptPgHostCertFile7,
+    cfgOptPgHostCertFile8,
     cfgOptPgHostCmd,
     cfgOptPgHostCmd2,
     cfgOptPgHostCmd3,
@@ -555,6 +682,14 @@ typedef enum
     cfgOptPgHostConfigPath6,
     cfgOptPgHostConfigPath7,
     cfgOptPgHostConfigPath8,
+    cfgOptPgHostKeyFile,
+    cfgOptPgHostKeyFile2,
+    cfgOptPgHostKeyFile3,
+    cfgOptPgHostKeyFile4,
+    cfgOptPgHostKeyFile5,
+    cfgOptPgHostKeyFile6,
+    cfgOptPgHostKeyFile7,
+    cfgOptPgHostKeyFile8,
     cfgOptPgHostPort,
     cfgOptPgHostPort2,
     cfgOptPgHostPort3,
@@ -563,6 +698,14 @@ typedef enum
     cfgOptPgHostPort6,
     cfgOptPgHostPort7,
     cfgOptPgHostPort8,
+    cfgOptPgHostType,
+    cfgOptPgHostType2,
+    cfgOptPgHostType3,
+    cfgOptPgHostType4,
+    cfgOptPgHostType5,
+    cfgOptPgHostType6,
+    cfgOptPgHostType7,
+    cfgOptPgHostType8,
     cfgOptPgHostUser,
     cfgOptPgHostUser2,
     cfgOptPgHostUser3,
@@ -613,6 +756,7 @@ typedef enum
     cfgOptPgUser8,
     cfgOptProcess,
     cfgOptProcessMax,
+    cfgOptProcessQueueMax,
     cfgOptProtocolTimeout,
     cfgOptRaw,
     cfgOptRecoveryOption,
@@ -622,11 +766,15 @@ typedef enum
     cfgOptRepoCipherType,
     cfgOptRepoHardlink,
     cfgOptRepoHost,
+    cfgOptRepoHostCaFile,
+    cfgOptRepoHostCertFile,
     cfgOptRepoHostCmd,
     cfgOptRepoHostConfig,
     cfgOptRepoHostConfigIncludePath,
     cfgOptRepoHostConfigPath,
+    cfgOptRepoHostKeyFile,
     cfgOptRepoHostPort,
+    cfgOptRepoHostType,
     cfgOptRepoHostUser,
     cfgOptRepoLocal,
     cfgOptRepoPath,
@@ -638,13 +786,17 @@ typedef enum
     cfgOptRepoS3Bucket,
     cfgOptRepoS3CaFile,
     cfgOptRepoS3CaPath,
+    cfgOptRepoS3DownloadMax,
     cfgOptRepoS3Endpoint,
     cfgOptRepoS3Host,
     cfgOptRepoS3Key,
     cfgOptRepoS3KeySecret,
+    cfgOptRepoS3ListMax,
     cfgOptRepoS3Port,
     cfgOptRepoS3Region,
+    cfgOptRepoS3Tls,
     cfgOptRepoS3Token,
+    cfgOptRepoS3UploadMax,
     cfgOptRepoS3UriStyle,
     cfgOptRepoS3VerifyTls,
     cfgOptRepoType,
@@ -666,6 +818,13 @@ typedef enum
     cfgOptTcpKeepAliveCount,
     cfgOptTcpKeepAliveIdle,
     cfgOptTcpKeepAliveInterval,
+    cfgOptTlsServerAddress,
+    cfgOptTlsServerAuth,
+    cfgOptTlsServerCaFile,
+    cfgOptTlsServerCertFile,
+    cfgOptTlsServerKeyFile,
+    cfgOptTlsServerPort,
+    cfgOptTlsServerProcessMax,
     cfgOptType,
 } ConfigOption;
 
@@ -20,7 +20,7 @@ typedef struct ConfigCommandData
     bool internal:1;
     bool lockRequired:1;
     bool lockRemoteRequired:1;
-    unsigned int lockType:2;
+    unsigned int lockType:3;
 
     bool logFile:1;
     unsigned int logLevelDefault:4;
@@ -59,7 +59,7 @@ typedef struct ConfigOptionData
     const char *name;
 
     unsigned int index:5;
-    unsigned int defineId:7;
+    unsigned int defineId:8;
 } ConfigOptionData;
 
 #define CONFIG_OPTION_LIST(...)                                                                                                    \
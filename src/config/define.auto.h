@@ -24,6 +24,7 @@ typedef enum
     cfgDefCmdRepoPut,
     cfgDefCmdRepoRm,
     cfgDefCmdRestore,
+    cfgDefCmdServer,
     cfgDefCmdStanzaCreate,
     cfgDefCmdStanzaDelete,
     cfgDefCmdStanzaUpgrade,
@@ -54,6 +55,7 @@ typedef enum
 {
     cfgDefOptArchiveAsync,
     cfgDefOptArchiveCheck,
+    cfgDefOptArchiveCompressDict,
     cfgDefOptArchiveCopy,
     cfgDefOptArchiveGetQueueMax,
     cfgDefOptArchivePushQueueMax,
@@ -63,10 +65,13 @@ typedef enum
     cfgDefOptChecksumPage,
     cfgDefOptCipherPass,
     cfgDefOptCmdSsh,
+    cfgDefOptCmdSshControlPath,
+    cfgDefOptCmdSshControlPersist,
     cfgDefOptCompress,
     cfgDefOptCompressLevel,
     cfgDefOptCompressLevelNetwork,
     cfgDefOptCompressType,
+    cfgDefOptCompressTypeNetwork,
     cfgDefOptConfig,
     cfgDefOptConfigIncludePath,
     cfgDefOptConfigPath,
@@ -94,11 +99,15 @@ typedef enum
     cfgDefOptOnline,
     cfgDefOptOutput,
     cfgDefOptPgHost,
+    cfgDefOptPgHostCaFile,
+    cfgDefOptPgHostCertFile,
     cfgDefOptPgHostCmd,
     cfgDefOptPgHostConfig,
     cfgDefOptPgHostConfigIncludePath,
     cfgDefOptPgHostConfigPath,
+    cfgDefOptPgHostKeyFile,
     cfgDefOptPgHostPort,
+    cfgDefOptPgHostType,
     cfgDefOptPgHostUser,
     cfgDefOptPgLocal,
     cfgDefOptPgPath,
@@ -107,6 +116,7 @@ typedef enum
     cfgDefOptPgUser,
     cfgDefOptProcess,
     cfgDefOptProcessMax,
+    cfgDefOptProcessQueueMax,
     cfgDefOptProtocolTimeout,
     cfgDefOptRaw,
     cfgDefOptRecoveryOption,
@@ -116,11 +126,15 @@ typedef enum
     cfgDefOptRepoCipherType,
     cfgDefOptRepoHardlink,
     cfgDefOptRepoHost,
+    cfgDefOptRepoHostCaFile,
+    cfgDefOptRepoHostCertFile,
     cfgDefOptRepoHostCmd,
     cfgDefOptRepoHostConfig,
     cfgDefOptRepoHostConfigIncludePath,
     cfgDefOptRepoHostConfigPath,
+    cfgDefOptRepoHostKeyFile,
     cfgDefOptRepoHostPort,
+    cfgDefOptRepoHostType,
     cfgDefOptRepoHostUser,
     cfgDefOptRepoLocal,
     cfgDefOptRepoPath,
@@ -132,13 +146,17 @@ typedef enum
     cfgDefOptRepoS3Bucket,
     cfgDefOptRepoS3CaFile,
     cfgDefOptRepoS3CaPath,
+    cfgDefOptRepoS3DownloadMax,
     cfgDefOptRepoS3Endpoint,
     cfgDefOptRepoS3Host,
     cfgDefOptRepoS3Key,
     cfgDefOptRepoS3KeySecret,
+    cfgDefOptRepoS3ListMax,
     cfgDefOptRepoS3Port,
     cfgDefOptRepoS3Region,
+    cfgDefOptRepoS3Tls,
     cfgDefOptRepoS3Token,
+    cfgDefOptRepoS3UploadMax,
     cfgDefOptRepoS3UriStyle,
     cfgDefOptRepoS3VerifyTls,
     cfgDefOptRepoType,
@@ -160,6 +178,13 @@ typedef enum
     cfgDefOptTcpKeepAliveCount,
     cfgDefOptTcpKeepAliveIdle,
     cfgDefOptTcpKeepAliveInterval,
+    cfgDefOptTlsServerAddress,
+    cfgDefOptTlsServerAuth,
+    cfgDefOptTlsServerCaFile,
+    cfgDefOptTlsServerCertFile,
+    cfgDefOptTlsServerKeyFile,
+    cfgDefOptTlsServerPort,
+    cfgDefOptTlsServerProcessMax,
     cfgDefOptType,
 } ConfigDefineOption;
 
@@ -257,10 +257,13 @@ cfgLoadUpdateOption(void)
         cfgOptionSet(cfgOptCompress, cfgSourceDefault, NULL);
     }
 
-    // Check that selected compress type has been compiled into this binary
+    // Check that selected compress types have been compiled into this binary
     if (cfgOptionValid(cfgOptCompressType))
         compressTypePresent(compressTypeEnum(cfgOptionStr(cfgOptCompressType)));
 
+    if (cfgOptionValid(cfgOptCompressTypeNetwork))
+        compressTypePresent(compressTypeEnum(cfgOptionStr(cfgOptCompressTypeNetwork)));
+
     // Update compress-level default based on the compression type
     if (cfgOptionValid(cfgOptCompressLevel) && cfgOptionSource(cfgOptCompressLevel) == cfgSourceDefault)
     {
@@ -39,6 +39,21 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptArchiveCheck,
     },
 
+    // archive-compress-dict option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_ARCHIVE_COMPRESS_DICT,
+        .val = PARSE_OPTION_FLAG | cfgOptArchiveCompressDict,
+    },
+    {
+        .name = "no-" CFGOPT_ARCHIVE_COMPRESS_DICT,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptArchiveCompressDict,
+    },
+    {
+        .name = "reset-" CFGOPT_ARCHIVE_COMPRESS_DICT,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptArchiveCompressDict,
+    },
+
     // archive-copy option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -161,6 +176,30 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCmdSsh,
     },
 
+    // cmd-ssh-control-path option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_CMD_SSH_CONTROL_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptCmdSshControlPath,
+    },
+    {
+        .name = "reset-" CFGOPT_CMD_SSH_CONTROL_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCmdSshControlPath,
+    },
+
+    // cmd-ssh-control-persist option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_CMD_SSH_CONTROL_PERSIST,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptCmdSshControlPersist,
+    },
+    {
+        .name = "reset-" CFGOPT_CMD_SSH_CONTROL_PERSIST,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCmdSshControlPersist,
+    },
+
     // compress option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -212,6 +251,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressType,
     },
 
+    // compress-type-network option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_COMPRESS_TYPE_NETWORK,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptCompressTypeNetwork,
+    },
+    {
+        .name = "reset-" CFGOPT_COMPRESS_TYPE_NETWORK,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressTypeNetwork,
+    },
+
     // config option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -623,6 +674,156 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | (cfgOptPgHost + 7),
     },
 
+    // pg-host-ca-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostCaFile,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostCaFile,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 7),
+    },
+
+    // pg-host-cert-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostCertFile,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostCertFile,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 7),
+    },
+
     // pg-host-cmd option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1013,6 +1214,81 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostConfigPath + 7),
     },
 
+    // pg-host-key-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostKeyFile,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostKeyFile,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 7),
+    },
+
     // pg-host-port option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1133,6 +1409,81 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | (cfgOptPgHostPort + 7),
     },
 
+    // pg-host-type option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostType,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostType,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 7),
+    },
+
     // pg-host-user option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1807,6 +2158,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptProcessMax,
     },
 
+    // process-queue-max option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PROCESS_QUEUE_MAX,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptProcessQueueMax,
+    },
+    {
+        .name = "reset-" CFGOPT_PROCESS_QUEUE_MAX,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptProcessQueueMax,
+    },
+
     // protocol-timeout option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1927,6 +2290,30 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoHost,
     },
 
+    // repo-host-ca-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostCaFile,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostCaFile,
+    },
+
+    // repo-host-cert-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostCertFile,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostCertFile,
+    },
+
     // repo-host-cmd option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1985,6 +2372,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostConfigPath,
     },
 
+    // repo-host-key-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostKeyFile,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostKeyFile,
+    },
+
     // repo-host-port option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2002,6 +2401,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoHostPort,
     },
 
+    // repo-host-type option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostType,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostType,
+    },
+
     // repo-host-user option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2182,6 +2593,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoS3CaPath,
     },
 
+    // repo-s3-download-max option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_S3_DOWNLOAD_MAX,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoS3DownloadMax,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_S3_DOWNLOAD_MAX,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoS3DownloadMax,
+    },
+
     // repo-s3-endpoint option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2250,6 +2673,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoS3KeySecret,
     },
 
+    // repo-s3-list-max option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_S3_LIST_MAX,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoS3ListMax,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_S3_LIST_MAX,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoS3ListMax,
+    },
+
     // repo-s3-port option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2279,6 +2714,21 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoS3Region,
     },
 
+    // repo-s3-tls option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_S3_TLS,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoS3Tls,
+    },
+    {
+        .name = "no-" CFGOPT_REPO1_S3_TLS,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptRepoS3Tls,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_S3_TLS,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoS3Tls,
+    },
+
     // repo-s3-token option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2291,6 +2741,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoS3Token,
     },
 
+    // repo-s3-upload-max option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_S3_UPLOAD_MAX,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoS3UploadMax,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_S3_UPLOAD_MAX,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoS3UploadMax,
+    },
+
     // repo-s3-uri-style option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2553,6 +3015,90 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTcpKeepAliveInterval,
     },
 
+    // tls-server-address option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_ADDRESS,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerAddress,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_ADDRESS,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerAddress,
+    },
+
+    // tls-server-auth option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_AUTH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerAuth,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_AUTH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerAuth,
+    },
+
+    // tls-server-ca-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerCaFile,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerCaFile,
+    },
+
+    // tls-server-cert-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerCertFile,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerCertFile,
+    },
+
+    // tls-server-key-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerKeyFile,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerKeyFile,
+    },
+
+    // tls-server-port option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_PORT,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerPort,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_PORT,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerPort,
+    },
+
+    // tls-server-process-max option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_PROCESS_MAX,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerProcessMax,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_PROCESS_MAX,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerProcessMax,
+    },
+
     // type option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2573,6 +3119,7 @@ static const ConfigOption optionResolveOrder[] =
 {
     cfgOptStanza,
     cfgOptArchiveAsync,
+    cfgOptArchiveCompressDict,
     cfgOptArchiveGetQueueMax,
     cfgOptArchivePushQueueMax,
     cfgOptArchiveTimeout,
@@ -2581,10 +3128,13 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptChecksumPage,
     cfgOptCipherPass,
     cfgOptCmdSsh,
+    cfgOptCmdSshControlPath,
+    cfgOptCmdSshControlPersist,
     cfgOptCompress,
     cfgOptCompressLevel,
     cfgOptCompressLevelNetwork,
     cfgOptCompressType,
+    cfgOptCompressTypeNetwork,
     cfgOptConfig,
     cfgOptConfigIncludePath,
     cfgOptConfigPath,
@@ -2652,6 +3202,7 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptPgUser + 7,
     cfgOptProcess,
     cfgOptProcessMax,
+    cfgOptProcessQueueMax,
     cfgOptProtocolTimeout,
     cfgOptRaw,
     cfgOptRecurse,
@@ -2679,6 +3230,13 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptTcpKeepAliveCount,
     cfgOptTcpKeepAliveIdle,
     cfgOptTcpKeepAliveInterval,
+    cfgOptTlsServerAddress,
+    cfgOptTlsServerAuth,
+    cfgOptTlsServerCaFile,
+    cfgOptTlsServerCertFile,
+    cfgOptTlsServerKeyFile,
+    cfgOptTlsServerPort,
+    cfgOptTlsServerProcessMax,
     cfgOptType,
     cfgOptArchiveCheck,
     cfgOptArchiveCopy,
@@ -2731,6 +3289,14 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptPgHostPort + 5,
     cfgOptPgHostPort + 6,
     cfgOptPgHostPort + 7,
+    cfgOptPgHostType,
+    cfgOptPgHostType + 1,
+    cfgOptPgHostType + 2,
+    cfgOptPgHostType + 3,
+    cfgOptPgHostType + 4,
+    cfgOptPgHostType + 5,
+    cfgOptPgHostType + 6,
+    cfgOptPgHostType + 7,
     cfgOptPgHostUser,
     cfgOptPgHostUser + 1,
     cfgOptPgHostUser + 2,
@@ -2747,21 +3313,53 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptRepoHostConfigIncludePath,
     cfgOptRepoHostConfigPath,
     cfgOptRepoHostPort,
+    cfgOptRepoHostType,
     cfgOptRepoHostUser,
     cfgOptRepoS3Bucket,
     cfgOptRepoS3CaFile,
     cfgOptRepoS3CaPath,
+    cfgOptRepoS3DownloadMax,
     cfgOptRepoS3Endpoint,
     cfgOptRepoS3Host,
     cfgOptRepoS3Key,
     cfgOptRepoS3KeySecret,
+    cfgOptRepoS3ListMax,
     cfgOptRepoS3Port,
     cfgOptRepoS3Region,
+    cfgOptRepoS3Tls,
     cfgOptRepoS3Token,
+    cfgOptRepoS3UploadMax,
     cfgOptRepoS3UriStyle,
     cfgOptRepoS3VerifyTls,
     cfgOptTarget,
     cfgOptTargetAction,
     cfgOptTargetExclusive,
     cfgOptTargetTimeline,
+    cfgOptPgHostCaFile,
+    cfgOptPgHostCaFile + 1,
+    cfgOptPgHostCaFile + 2,
+    cfgOptPgHostCaFile + 3,
+    cfgOptPgHostCaFile + 4,
+    cfgOptPgHostCaFile + 5,
+    cfgOptPgHostCaFile + 6,
+    cfgOptPgHostCaFile + 7,
+    cfgOptPgHostCertFile,
+    cfgOptPgHostCertFile + 1,
+    cfgOptPgHostCertFile + 2,
+    cfgOptPgHostCertFile + 3,
+    cfgOptPgHostCertFile + 4,
+    cfgOptPgHostCertFile + 5,
+    cfgOptPgHostCertFile + 6,
+    cfgOptPgHostCertFile + 7,
+    cfgOptPgHostKeyFile,
+    cfgOptPgHostKeyFile + 1,
+    cfgOptPgHostKeyFile + 2,
+    cfgOptPgHostKeyFile + 3,
+    cfgOptPgHostKeyFile + 4,
+    cfgOptPgHostKeyFile + 5,
+    cfgOptPgHostKeyFile + 6,
+    cfgOptPgHostKeyFile + 7,
+    cfgOptRepoHostCaFile,
+    cfgOptRepoHostCertFile,
+    cfgOptRepoHostKeyFile,
 };
@@ -404,6 +404,7 @@ typedef struct ManifestBuildData
     const VariantList *tablespaceList;                              // List of tablespaces in the database
     StringList *excludeContent;                                     // Exclude contents of directories
     StringList *excludeSingle;                                      // Exclude a single file/link/path
+    List *pathQueue;                                                // Paths waiting to be listed (see manifestNewBuild())
 
     // These change with each level of recursion
     const String *manifestParentName;                               // Manifest name of this file/link/path's parent
@@ -555,16 +556,20 @@ manifestBuildCallback(void *data, const StorageInfo *info)
                 return;
             }
 
-            // Recurse into the path
+            // Queue the path so its contents will be listed along with the other paths found at this level of recursion
             ManifestBuildData buildDataSub = buildData;
-            buildDataSub.manifestParentName = manifestName;
-            buildDataSub.pgPath = strNewFmt("%s/%s", strPtr(buildData.pgPath), strPtr(info->name));
+
+            MEM_CONTEXT_BEGIN(lstMemContext(buildData.pathQueue))
+            {
+                buildDataSub.manifestParentName = strDup(manifestName);
+                buildDataSub.pgPath = strNewFmt("%s/%s", strPtr(buildData.pgPath), strPtr(info->name));
+            }
+            MEM_CONTEXT_END();
 
             if (buildData.dbPathExp != NULL)
                 buildDataSub.dbPath = regExpMatch(buildData.dbPathExp, manifestName);
 
-            storageInfoListP(
-                buildDataSub.storagePg, buildDataSub.pgPath, manifestBuildCallback, &buildDataSub, .sortOrder = sortOrderAsc);
+            lstAdd(buildData.pathQueue, &buildDataSub);
 
             break;
         }
@@ -842,6 +847,33 @@ manifestBuildCallback(void *data, const StorageInfo *info)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+// Callback to process files/links/paths for a list of queued paths
+typedef struct ManifestBuildQueueData
+{
+    List *pathQueue;                                                // Queue of paths being listed
+    unsigned int pathQueueIdx;                                      // Queue index of the first path in the list
+} ManifestBuildQueueData;
+
+static void
+manifestBuildQueueCallback(void *data, unsigned int pathIdx, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, pathIdx);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(info != NULL);
+
+    const ManifestBuildQueueData *queueData = data;
+
+    // manifestBuildCallback() copies the build data before queueing any paths so the pointer stays valid if the queue grows
+    manifestBuildCallback(lstGet(queueData->pathQueue, queueData->pathQueueIdx + pathIdx), info);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 // Regular expression constants
 #define RELATION_EXP                                                "[0-9]+(_(fsm|vm)){0,1}(\\.[0-9]+){0,1}"
 #define DB_PATH_EXP                                                                                                                \
@@ -962,10 +994,27 @@ manifestNewBuild(
 
         manifestTargetAdd(this, &target);
 
-        // Gather info for the rest of the files/links/paths
+        // Gather info for the rest of the files/links/paths. Paths are queued by the callback rather than listed as they are found
+        // so all the paths at each level of recursion can be listed together. When PostgreSQL is remote this requires one round
+        // trip per level rather than one per path.
+        buildData.pathQueue = lstNewP(sizeof(ManifestBuildData));
+
         storageInfoListP(
             storagePg, buildData.pgPath, manifestBuildCallback, &buildData, .errorOnMissing = true, .sortOrder = sortOrderAsc);
 
+        unsigned int pathQueueIdx = 0;
+
+        while (pathQueueIdx < lstSize(buildData.pathQueue))
+        {
+            ManifestBuildQueueData queueData = {.pathQueue = buildData.pathQueue, .pathQueueIdx = pathQueueIdx};
+            StringList *pathList = strLstNew();
+
+            for (; pathQueueIdx < lstSize(buildData.pathQueue); pathQueueIdx++)
+                strLstAdd(pathList, ((ManifestBuildData *)lstGet(buildData.pathQueue, pathQueueIdx))->pgPath);
+
+            storageInfoListMultiP(storagePg, pathList, manifestBuildQueueCallback, &queueData, .sortOrder = sortOrderAsc);
+        }
+
         // These may not be in order even if the incoming data was sorted
         lstSort(this->fileList, sortOrderAsc);
         lstSort(this->linkList, sortOrderAsc);
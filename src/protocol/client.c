@@ -10,7 +10,9 @@ Protocol Client
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
 #include "common/type/object.h"
+#include "common/type/pack.h"
 #include "protocol/client.h"
+#include "protocol/frame.h"
 #include "version.h"
 
 /***********************************************************************************************************************************
@@ -139,41 +141,36 @@ protocolClientNew(const String *name, const String *service, IoRead *read, IoWri
 /**********************************************************************************************************************************/
 // Helper to process errors
 static void
-protocolClientProcessError(ProtocolClient *this, KeyValue *errorKv)
+protocolClientProcessError(ProtocolClient *this, const Buffer *errorData)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, this);
-        FUNCTION_LOG_PARAM(KEY_VALUE, errorKv);
+        FUNCTION_LOG_PARAM(BUFFER, errorData);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(errorKv != NULL);
+    ASSERT(errorData != NULL);
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Process error if any
-        const Variant *error = kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STR));
-
-        if (error != NULL)
+        // The error frame contains the error code, message, and stack trace in that order
+        size_t errorPos = 0;
+        const ErrorType *type = errorTypeFromCode(varInt(packReadVar(errorData, &errorPos)));
+        const String *message = varStr(packReadVar(errorData, &errorPos));
+        const String *stack = varStr(packReadVar(errorData, &errorPos));
+
+        // Required part of the message
+        String *throwMessage = strNewFmt(
+            "%s: %s", strPtr(this->errorPrefix), message == NULL ? "no details available" : strPtr(message));
+
+        // Add stack trace if the error is an assertion or debug-level logging is enabled
+        if (type == &AssertError || logAny(logLevelDebug))
         {
-            const ErrorType *type = errorTypeFromCode(varIntForce(error));
-            const String *message = varStr(kvGet(errorKv, VARSTR(PROTOCOL_OUTPUT_STR)));
-
-            // Required part of the message
-            String *throwMessage = strNewFmt(
-                "%s: %s", strPtr(this->errorPrefix), message == NULL ? "no details available" : strPtr(message));
-
-            // Add stack trace if the error is an assertion or debug-level logging is enabled
-            if (type == &AssertError || logAny(logLevelDebug))
-            {
-                const String *stack = varStr(kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STACK_STR)));
-
-                strCat(throwMessage, "\n");
-                strCat(throwMessage, stack == NULL ? "no stack trace available" : strPtr(stack));
-            }
-
-            THROWP(type, strPtr(throwMessage));
+            strCat(throwMessage, "\n");
+            strCat(throwMessage, stack == NULL ? "no stack trace available" : strPtr(stack));
         }
+
+        THROWP(type, strPtr(throwMessage));
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -190,27 +187,29 @@ protocolClientReadOutput(ProtocolClient *this, bool outputRequired)
 
     ASSERT(this != NULL);
 
-    const Variant *result = NULL;
+    Variant *result = NULL;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
         // Read the response
-        String *response = ioReadLine(this->read);
-        KeyValue *responseKv = varKv(jsonToVar(response));
+        ProtocolFrame frame = protocolFrameRead(this->read);
 
         // Process error if any
-        protocolClientProcessError(this, responseKv);
+        if (frame.type == protocolFrameTypeError)
+            protocolClientProcessError(this, frame.data);
 
-        // Get output
-        result = kvGet(responseKv, VARSTR(PROTOCOL_OUTPUT_STR));
+        if (frame.type != protocolFrameTypeResponse)
+            THROW_FMT(ProtocolError, "expected response frame but got frame type %u", frame.type);
 
-        if (outputRequired)
+        // Get output
+        MEM_CONTEXT_PRIOR_BEGIN()
         {
-            // Just move the entire response kv since the output is the largest part if it
-            kvMove(responseKv, memContextPrior());
+            result = packToVar(frame.data);
         }
-        // Else if no output is required then there should not be any
-        else if (result != NULL)
+        MEM_CONTEXT_PRIOR_END();
+
+        // If no output is required then there should not be any
+        if (!outputRequired && result != NULL)
             THROW(AssertError, "no output required by command");
 
         // Reset the keep alive time
@@ -234,8 +233,12 @@ protocolClientWriteCommand(ProtocolClient *this, const ProtocolCommand *command)
     ASSERT(command != NULL);
 
     // Write out the command
-    ioWriteStrLine(this->write, protocolCommandJson(command));
-    ioWriteFlush(this->write);
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        protocolFrameWrite(this->write, protocolFrameTypeCommand, protocolCommandPack(command));
+        ioWriteFlush(this->write);
+    }
+    MEM_CONTEXT_TEMP_END();
 
     // Reset the keep alive time
     this->keepAliveTime = timeMSec();
@@ -294,23 +297,25 @@ protocolClientReadLine(ProtocolClient *this)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        result = ioReadLine(this->read);
-
-        if (strSize(result) == 0)
+        // If a frame is next then it should be an error
+        if (protocolFrameNext(this->read))
         {
-            THROW(FormatError, "unexpected empty line");
-        }
-        else if (strPtr(result)[0] == '{')
-        {
-            KeyValue *responseKv = varKv(jsonToVar(result));
+            ProtocolFrame frame = protocolFrameRead(this->read);
 
             // Process expected error
-            protocolClientProcessError(this, responseKv);
+            if (frame.type == protocolFrameTypeError)
+                protocolClientProcessError(this, frame.data);
 
             // If not an error then there is probably a protocol bug
             THROW(FormatError, "expected error but got output");
         }
-        else if (strPtr(result)[0] != '.')
+
+        result = ioReadLine(this->read);
+
+        if (strSize(result) == 0)
+            THROW(FormatError, "unexpected empty line");
+
+        if (strPtr(result)[0] != '.')
             THROW_FMT(FormatError, "invalid prefix in '%s'", strPtr(result));
 
         MEM_CONTEXT_PRIOR_BEGIN()
@@ -324,6 +329,19 @@ protocolClientReadLine(ProtocolClient *this)
     FUNCTION_LOG_RETURN(STRING, result);
 }
 
+/**********************************************************************************************************************************/
+bool
+protocolClientReadReady(ProtocolClient *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(BOOL, protocolFrameReady(this->read));
+}
+
 /**********************************************************************************************************************************/
 IoRead *
 protocolClientIoRead(const ProtocolClient *this)
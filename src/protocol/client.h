@@ -60,6 +60,10 @@ String *protocolClientReadLine(ProtocolClient *this);
 // Read the command output
 const Variant *protocolClientReadOutput(ProtocolClient *this, bool outputRequired);
 
+// Has the command output already been buffered? If so, the next protocolClientReadOutput() will not need to wait on the server.
+// This is useful after poll() since poll() will not report data that has already been read from the handle.
+bool protocolClientReadReady(ProtocolClient *this);
+
 // Write the protocol command
 void protocolClientWriteCommand(ProtocolClient *this, const ProtocolCommand *command);
 
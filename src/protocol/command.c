@@ -6,9 +6,8 @@ Protocol Command
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
-#include "common/type/json.h"
-#include "common/type/keyValue.h"
 #include "common/type/object.h"
+#include "common/type/pack.h"
 #include "protocol/command.h"
 
 /***********************************************************************************************************************************
@@ -83,8 +82,8 @@ protocolCommandParamAdd(ProtocolCommand *this, const Variant *param)
 }
 
 /**********************************************************************************************************************************/
-String *
-protocolCommandJson(const ProtocolCommand *this)
+Buffer *
+protocolCommandPack(const ProtocolCommand *this)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(PROTOCOL_COMMAND, this);
@@ -92,22 +91,12 @@ protocolCommandJson(const ProtocolCommand *this)
 
     ASSERT(this != NULL);
 
-    String *result = NULL;
-
-    MEM_CONTEXT_TEMP_BEGIN()
-    {
-        KeyValue *command = kvPut(kvNew(), VARSTR(PROTOCOL_KEY_COMMAND_STR), VARSTR(this->command));
-
-        if (this->parameterList != NULL)
-            kvPut(command, VARSTR(PROTOCOL_KEY_PARAMETER_STR), this->parameterList);
+    Buffer *result = bufNew(0);
 
-        MEM_CONTEXT_PRIOR_BEGIN()
-        {
-            result = jsonFromKv(command);
-        }
-        MEM_CONTEXT_PRIOR_END();
-    }
-    MEM_CONTEXT_TEMP_END();
+    // Pack the command and the parameter list (which may be NULL) directly rather than building a container since this is done for
+    // every command
+    packCatVar(result, VARSTR(this->command));
+    packCatVar(result, this->parameterList);
 
     FUNCTION_TEST_RETURN(result);
 }
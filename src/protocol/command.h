@@ -12,6 +12,7 @@ Object type
 
 typedef struct ProtocolCommand ProtocolCommand;
 
+#include "common/type/buffer.h"
 #include "common/type/variant.h"
 
 /***********************************************************************************************************************************
@@ -39,8 +40,8 @@ ProtocolCommand *protocolCommandParamAdd(ProtocolCommand *this, const Variant *p
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
-// Command JSON
-String *protocolCommandJson(const ProtocolCommand *this);
+// Command and parameters in pack format, used as the data of a command frame
+Buffer *protocolCommandPack(const ProtocolCommand *this);
 
 /***********************************************************************************************************************************
 Destructor
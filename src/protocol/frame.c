@@ -0,0 +1,156 @@
+/***********************************************************************************************************************************
+Protocol Frame
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "protocol/frame.h"
+
+/**********************************************************************************************************************************/
+bool
+protocolFrameTypeValid(unsigned char type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, type);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(type >= protocolFrameTypeCommand && type <= protocolFrameTypeError);
+}
+
+/***********************************************************************************************************************************
+Get the size of the frame data from the header and check the frame type and size
+***********************************************************************************************************************************/
+static size_t
+protocolFrameHeaderSize(const Buffer *header)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, header);
+    FUNCTION_TEST_END();
+
+    ASSERT(header != NULL);
+    ASSERT(bufUsed(header) >= PROTOCOL_FRAME_HEADER_SIZE);
+
+    const unsigned char *headerPtr = bufPtrConst(header);
+
+    if (!protocolFrameTypeValid(headerPtr[0]))
+        THROW_FMT(ProtocolError, "invalid frame type %u", headerPtr[0]);
+
+    size_t result = (size_t)headerPtr[1] << 24 | (size_t)headerPtr[2] << 16 | (size_t)headerPtr[3] << 8 | (size_t)headerPtr[4];
+
+    if (result > PROTOCOL_FRAME_SIZE_MAX)
+        THROW_FMT(ProtocolError, "frame size %zu exceeds maximum of %zu", result, (size_t)PROTOCOL_FRAME_SIZE_MAX);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+ProtocolFrame
+protocolFrameRead(IoRead *read)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+
+    ProtocolFrame result = {0};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Peek the header rather than reading it directly so any data after it that is already available is buffered. This allows
+        // protocolFrameReady() to find frames that were sent together.
+        if (bufUsed(ioReadPeek(read, PROTOCOL_FRAME_HEADER_SIZE, true)) < PROTOCOL_FRAME_HEADER_SIZE)
+            THROW(ProtocolError, "unexpected eof while reading frame header");
+
+        Buffer *header = bufNew(PROTOCOL_FRAME_HEADER_SIZE);
+        ioRead(read, header);
+
+        size_t size = protocolFrameHeaderSize(header);
+
+        // Read the data
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result.type = (ProtocolFrameType)bufPtr(header)[0];
+            result.data = bufNew(size);
+        }
+        MEM_CONTEXT_PRIOR_END();
+
+        if (ioRead(read, result.data) != size)
+            THROW_FMT(ProtocolError, "unexpected eof while reading %zu byte frame", size);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(PROTOCOL_FRAME, result);
+}
+
+/**********************************************************************************************************************************/
+bool
+protocolFrameNext(IoRead *read)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+
+    const Buffer *buffer = ioReadPeek(read, 1, true);
+
+    FUNCTION_LOG_RETURN(BOOL, bufUsed(buffer) > 0 && protocolFrameTypeValid(bufPtrConst(buffer)[0]));
+}
+
+/**********************************************************************************************************************************/
+bool
+protocolFrameReady(IoRead *read)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+
+    bool result = false;
+    const Buffer *buffer = ioReadPeek(read, PROTOCOL_FRAME_HEADER_SIZE, false);
+
+    if (bufUsed(buffer) >= PROTOCOL_FRAME_HEADER_SIZE)
+    {
+        size_t size = PROTOCOL_FRAME_HEADER_SIZE + protocolFrameHeaderSize(buffer);
+
+        // If the frame will not fit in the buffer then it cannot be peeked. The sender has already started sending it so consider
+        // it ready and let the read wait for the remainder.
+        if (size > bufSize(buffer))
+            result = true;
+        else
+            result = bufUsed(ioReadPeek(read, size, false)) >= size;
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+void
+protocolFrameWrite(IoWrite *write, ProtocolFrameType type, const Buffer *data)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+        FUNCTION_LOG_PARAM(ENUM, type);
+        FUNCTION_LOG_PARAM(BUFFER, data);
+    FUNCTION_LOG_END();
+
+    ASSERT(write != NULL);
+    ASSERT(protocolFrameTypeValid((unsigned char)type));
+    ASSERT(data != NULL);
+    ASSERT(bufUsed(data) <= PROTOCOL_FRAME_SIZE_MAX);
+
+    uint32_t size = (uint32_t)bufUsed(data);
+    unsigned char header[PROTOCOL_FRAME_HEADER_SIZE] =
+    {
+        (unsigned char)type, (unsigned char)(size >> 24), (unsigned char)(size >> 16), (unsigned char)(size >> 8),
+        (unsigned char)size,
+    };
+
+    ioWrite(write, BUF(header, sizeof(header)));
+    ioWrite(write, data);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
@@ -0,0 +1,76 @@
+/***********************************************************************************************************************************
+Protocol Frame
+
+Commands, responses, and errors are sent between the client and the server as frames. Each frame begins with a header containing the
+frame type (one byte) and the size of the frame data (four bytes, big-endian) so the receiver knows exactly how many bytes to read
+without scanning for a terminator. The frame data is in pack format (see common/type/pack.h) so values are read back with the same
+type they were sent with.
+
+Frame type values are not printable characters so they cannot be confused with the lines and block headers that are also sent on the
+protocol connection.
+***********************************************************************************************************************************/
+#ifndef PROTOCOL_FRAME_H
+#define PROTOCOL_FRAME_H
+
+#include "common/io/read.h"
+#include "common/io/write.h"
+#include "common/type/buffer.h"
+
+/***********************************************************************************************************************************
+Frame type
+***********************************************************************************************************************************/
+typedef enum
+{
+    protocolFrameTypeCommand = 1,                                   // Command sent from the client to the server
+    protocolFrameTypeResponse = 2,                                  // Response to a command
+    protocolFrameTypeError = 3,                                     // Error raised while processing a command
+} ProtocolFrameType;
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+// Size of the frame header
+#define PROTOCOL_FRAME_HEADER_SIZE                                  5
+
+// Maximum size of the frame data. The size in the header is checked against this before the data is allocated so a corrupt or
+// malicious header cannot cause a large allocation. Frames carry commands and their results while file content is sent separately,
+// so frames are normally much smaller than this.
+#define PROTOCOL_FRAME_SIZE_MAX                                     (64 * 1024 * 1024)
+
+/***********************************************************************************************************************************
+Frame
+***********************************************************************************************************************************/
+typedef struct ProtocolFrame
+{
+    ProtocolFrameType type;                                         // Frame type
+    Buffer *data;                                                   // Frame data
+} ProtocolFrame;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Is the byte a valid frame type? Frame types are not printable so they cannot be confused with the first byte of a line.
+bool protocolFrameTypeValid(unsigned char type);
+
+// Is a frame (rather than a line) next on the connection? Waits for data when none is buffered and returns false at eof.
+bool protocolFrameNext(IoRead *read);
+
+// Read a frame
+ProtocolFrame protocolFrameRead(IoRead *read);
+
+// Is a frame ready to be read without waiting on the driver? Frames larger than the read buffer are reported ready as soon as the
+// header has been received.
+bool protocolFrameReady(IoRead *read);
+
+// Write a frame. The caller is responsible for flushing.
+void protocolFrameWrite(IoWrite *write, ProtocolFrameType type, const Buffer *data);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_PROTOCOL_FRAME_TYPE                                                                                           \
+    ProtocolFrame
+#define FUNCTION_LOG_PROTOCOL_FRAME_FORMAT(value, buffer, bufferSize)                                                              \
+    typeToLog("ProtocolFrame", buffer, bufferSize)
+
+#endif
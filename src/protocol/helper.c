@@ -8,7 +8,10 @@ Protocol Helper
 #include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/exec.h"
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
 #include "common/memContext.h"
+#include "common/type/json.h"
 #include "config/config.h"
 #include "config/exec.h"
 #include "config/protocol.h"
@@ -25,12 +28,16 @@ STRING_EXTERN(PROTOCOL_SERVICE_REMOTE_STR,                          PROTOCOL_SER
 STRING_STATIC(PROTOCOL_REMOTE_TYPE_PG_STR,                          PROTOCOL_REMOTE_TYPE_PG);
 STRING_STATIC(PROTOCOL_REMOTE_TYPE_REPO_STR,                        PROTOCOL_REMOTE_TYPE_REPO);
 
+STRING_STATIC(PROTOCOL_REMOTE_HOST_TYPE_TLS_STR,                    PROTOCOL_REMOTE_HOST_TYPE_TLS);
+
 /***********************************************************************************************************************************
 Local variables
 ***********************************************************************************************************************************/
 typedef struct ProtocolHelperClient
 {
     Exec *exec;                                                     // Executed client
+    TlsClient *tlsClient;                                           // TLS client when the remote is reached over TLS
+    TlsSession *tlsSession;                                         // TLS session when the remote is reached over TLS
     ProtocolClient *client;                                         // Protocol client
 } ProtocolHelperClient;
 
@@ -43,6 +50,8 @@ static struct
 
     unsigned int clientLocalSize;                                   // Local clients
     ProtocolHelperClient *clientLocal;
+
+    StringList *sshMasterList;                                      // Hosts with an ssh master connection opened by this process
 } protocolHelper;
 
 /***********************************************************************************************************************************
@@ -112,6 +121,125 @@ pgIsLocalVerify(void)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Get the ssh parameters required to connect to a remote host. The control master setting is only added when a control path is
+configured.
+***********************************************************************************************************************************/
+static StringList *
+protocolRemoteSshParam(ProtocolStorageType protocolStorageType, unsigned int hostIdx, const char *controlMaster)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+        FUNCTION_LOG_PARAM(STRINGZ, controlMaster);
+    FUNCTION_LOG_END();
+
+    ASSERT(controlMaster != NULL);
+
+    // Is this a repo remote?
+    bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+    // Fixed parameters for ssh command
+    StringList *result = strLstNew();
+    strLstAddZ(result, "-o");
+    strLstAddZ(result, "LogLevel=error");
+    strLstAddZ(result, "-o");
+    strLstAddZ(result, "Compression=no");
+    strLstAddZ(result, "-o");
+    strLstAddZ(result, "PasswordAuthentication=no");
+
+    // Share one connection per host between processes when a control path is configured
+    if (cfgOptionTest(cfgOptCmdSshControlPath))
+    {
+        strLstAddZ(result, "-o");
+        strLstAdd(result, strNewFmt("ControlMaster=%s", controlMaster));
+        strLstAddZ(result, "-o");
+        strLstAdd(result, strNewFmt("ControlPath=%s", strPtr(cfgOptionStr(cfgOptCmdSshControlPath))));
+    }
+
+    // Append port if specified
+    ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort + hostIdx;
+
+    if (cfgOptionTest(optHostPort))
+    {
+        strLstAddZ(result, "-p");
+        strLstAdd(result, strNewFmt("%u", cfgOptionUInt(optHostPort)));
+    }
+
+    // Append user/host
+    strLstAdd(
+        result,
+        strNewFmt(
+            "%s@%s", strPtr(cfgOptionStr(isRepo ? cfgOptRepoHostUser : cfgOptPgHostUser + hostIdx)),
+            strPtr(cfgOptionStr(isRepo ? cfgOptRepoHost : cfgOptPgHost + hostIdx))));
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/***********************************************************************************************************************************
+Open the ssh master connection for a remote host if a control path is configured and the master has not already been opened by this
+process
+
+Only the main (or async) process opens master connections and it does so before starting the locals and before connecting to the
+remote itself, so the locals find the master already running rather than racing to become the master. The master is opened by
+running a command that exits immediately and remains open in the background for cmd-ssh-control-persist seconds after the last
+connection using it closes. If a master is already running, e.g. from a prior command, then it is used and no new master is opened.
+Errors are not reported here since the connection to the remote will report them.
+***********************************************************************************************************************************/
+static void
+protocolRemoteSshMaster(ProtocolStorageType protocolStorageType, unsigned int hostIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+    FUNCTION_LOG_END();
+
+    // Is this a repo remote?
+    bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+    if (cfgOptionTest(cfgOptCmdSshControlPath) && cfgCommandRole() != cfgCmdRoleLocal &&
+        !strEq(cfgOptionStr(isRepo ? cfgOptRepoHostType : cfgOptPgHostType + hostIdx), PROTOCOL_REMOTE_HOST_TYPE_TLS_STR))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            StringList *param = protocolRemoteSshParam(protocolStorageType, hostIdx, "auto");
+
+            // The connection parameters identify the host
+            const String *host = strLstJoin(param, " ");
+
+            if (protocolHelper.sshMasterList == NULL || !strLstExists(protocolHelper.sshMasterList, host))
+            {
+                strLstInsert(param, 0, STRDEF("-o"));
+                strLstInsert(param, 1, strNewFmt("ControlPersist=%u", cfgOptionUInt(cfgOptCmdSshControlPersist)));
+                strLstAddZ(param, "true");
+
+                Exec *exec = execNew(
+                    cfgOptionStr(cfgOptCmdSsh), param,
+                    strNewFmt("ssh master on '%s'", strPtr(cfgOptionStr(isRepo ? cfgOptRepoHost : cfgOptPgHost + hostIdx))),
+                    (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
+
+                // Wait for the command to exit. The master continues in the background.
+                execOpen(exec);
+                execFree(exec);
+
+                protocolHelperInit();
+
+                MEM_CONTEXT_BEGIN(protocolHelper.memContext)
+                {
+                    if (protocolHelper.sshMasterList == NULL)
+                        protocolHelper.sshMasterList = strLstNew();
+
+                    strLstAdd(protocolHelper.sshMasterList, host);
+                }
+                MEM_CONTEXT_END();
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Get the command line required for local protocol execution
 ***********************************************************************************************************************************/
@@ -160,9 +288,11 @@ protocolLocalParam(ProtocolStorageType protocolStorageType, unsigned int hostId,
     FUNCTION_LOG_RETURN(STRING_LIST, result);
 }
 
-/**********************************************************************************************************************************/
-ProtocolClient *
-protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int hostId, unsigned int protocolId)
+/***********************************************************************************************************************************
+Execute a local process if it is not already running
+***********************************************************************************************************************************/
+static ProtocolHelperClient *
+protocolLocalExec(ProtocolStorageType protocolStorageType, unsigned int hostId, unsigned int protocolId)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
@@ -190,11 +320,17 @@ protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int hostId, u
 
     ASSERT(protocolId <= protocolHelper.clientLocalSize);
 
-    // Create protocol object
     ProtocolHelperClient *protocolHelperClient = &protocolHelper.clientLocal[protocolId - 1];
 
-    if (protocolHelperClient->client == NULL)
+    if (protocolHelperClient->exec == NULL)
     {
+        // Open the ssh master connections to the remote hosts the local will connect to
+        if (!repoIsLocal())
+            protocolRemoteSshMaster(protocolStorageTypeRepo, 0);
+
+        if (protocolStorageType == protocolStorageTypePg && !pgIsLocal(hostId))
+            protocolRemoteSshMaster(protocolStorageTypePg, hostId - 1);
+
         MEM_CONTEXT_BEGIN(protocolHelper.memContext)
         {
             // Execute the protocol command
@@ -203,7 +339,49 @@ protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int hostId, u
                 strNewFmt(PROTOCOL_SERVICE_LOCAL "-%u process", protocolId),
                 (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
             execOpen(protocolHelperClient->exec);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_LOG_RETURN_P(VOID, protocolHelperClient);
+}
+
+/**********************************************************************************************************************************/
+void
+protocolLocalStart(ProtocolStorageType protocolStorageType, unsigned int hostId, unsigned int protocolId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostId);
+        FUNCTION_LOG_PARAM(UINT, protocolId);
+    FUNCTION_LOG_END();
+
+    ASSERT(hostId > 0);
+
+    protocolLocalExec(protocolStorageType, hostId, protocolId);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+ProtocolClient *
+protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int hostId, unsigned int protocolId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostId);
+        FUNCTION_LOG_PARAM(UINT, protocolId);
+    FUNCTION_LOG_END();
 
+    ASSERT(hostId > 0);
+
+    // Execute the local process (if it was not already started) and create the protocol object
+    ProtocolHelperClient *protocolHelperClient = protocolLocalExec(protocolStorageType, hostId, protocolId);
+
+    if (protocolHelperClient->client == NULL)
+    {
+        MEM_CONTEXT_BEGIN(protocolHelper.memContext)
+        {
             // Create protocol object
             protocolHelperClient->client = protocolClientNew(
                 strNewFmt(PROTOCOL_SERVICE_LOCAL "-%u protocol", protocolId),
@@ -232,30 +410,9 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protoc
     // Is this a repo remote?
     bool isRepo = protocolStorageType == protocolStorageTypeRepo;
 
-    // Fixed parameters for ssh command
-    StringList *result = strLstNew();
-    strLstAddZ(result, "-o");
-    strLstAddZ(result, "LogLevel=error");
-    strLstAddZ(result, "-o");
-    strLstAddZ(result, "Compression=no");
-    strLstAddZ(result, "-o");
-    strLstAddZ(result, "PasswordAuthentication=no");
-
-    // Append port if specified
-    ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort + hostIdx;
-
-    if (cfgOptionTest(optHostPort))
-    {
-        strLstAddZ(result, "-p");
-        strLstAdd(result, strNewFmt("%u", cfgOptionUInt(optHostPort)));
-    }
-
-    // Append user/host
-    strLstAdd(
-        result,
-        strNewFmt(
-            "%s@%s", strPtr(cfgOptionStr(isRepo ? cfgOptRepoHostUser : cfgOptPgHostUser + hostIdx)),
-            strPtr(cfgOptionStr(isRepo ? cfgOptRepoHost : cfgOptPgHost + hostIdx))));
+    // Parameters for ssh command. Use the master connection for the host if there is one but never become the master, since
+    // processes connecting at the same time would race to do so.
+    StringList *result = protocolRemoteSshParam(protocolStorageType, hostIdx, "no");
 
     // Option replacements
     KeyValue *optionReplace = kvNew();
@@ -277,6 +434,10 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protoc
         optionReplace, VARSTR(CFGOPT_CONFIG_PATH_STR),
         cfgOptionSource(optConfigPath) != cfgSourceDefault ? cfgOption(optConfigPath) : NULL);
 
+    // The control options are only meaningful for the ssh client so don't pass them to the remote
+    kvPut(optionReplace, VARSTR(CFGOPT_CMD_SSH_CONTROL_PATH_STR), NULL);
+    kvPut(optionReplace, VARSTR(CFGOPT_CMD_SSH_CONTROL_PERSIST_STR), NULL);
+
     // Set local so host settings configured on the remote will not accidentally be picked up
     kvPut(
         optionReplace,
@@ -388,6 +549,67 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protoc
     FUNCTION_LOG_RETURN(STRING_LIST, result);
 }
 
+/***********************************************************************************************************************************
+Connect to a remote served by the server command over TLS. The server expects the remote parameters as a JSON array on the first
+line and then runs the remote protocol over the session. Options other than those that select the remote are configured on the
+server.
+***********************************************************************************************************************************/
+static void
+protocolRemoteTlsOpen(
+    ProtocolHelperClient *protocolHelperClient, ProtocolStorageType protocolStorageType, unsigned int protocolId,
+    unsigned int hostIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, protocolHelperClient);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, protocolId);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(protocolHelperClient != NULL);
+
+    // Is this a repo remote?
+    bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+    ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort + hostIdx;
+    TimeMSec timeout = (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000);
+
+    // Create the client. It must live as long as the session since it stores the session ticket sent by the server after the
+    // handshake. The server certificate is always verified and the client certificate is presented for verification.
+    protocolHelperClient->tlsClient = tlsClientNew(
+        sckClientNew(
+            cfgOptionStr(isRepo ? cfgOptRepoHost : cfgOptPgHost + hostIdx),
+            cfgOptionTest(optHostPort) ? cfgOptionUInt(optHostPort) : PROTOCOL_REMOTE_TLS_PORT, timeout),
+        timeout, true, cfgOptionStr(isRepo ? cfgOptRepoHostCaFile : cfgOptPgHostCaFile + hostIdx), NULL,
+        cfgOptionStr(isRepo ? cfgOptRepoHostCertFile : cfgOptPgHostCertFile + hostIdx),
+        cfgOptionStr(isRepo ? cfgOptRepoHostKeyFile : cfgOptPgHostKeyFile + hostIdx));
+
+    protocolHelperClient->tlsSession = tlsClientOpen(protocolHelperClient->tlsClient);
+
+    // Send the remote parameters. The remote uses the configuration of the server so only the parameters that select the remote are
+    // sent.
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StringList *paramList = strLstNew();
+
+        if (cfgOptionTest(cfgOptStanza))
+            strLstAdd(paramList, strNewFmt("--" CFGOPT_STANZA "=%s", strPtr(cfgOptionStr(cfgOptStanza))));
+
+        strLstAdd(
+            paramList,
+            strNewFmt("--" CFGOPT_PROCESS "=%d", cfgOptionTest(cfgOptProcess) ? cfgOptionInt(cfgOptProcess) : (int)protocolId));
+        strLstAdd(paramList, strNewFmt("--" CFGOPT_REMOTE_TYPE "=%s", strPtr(protocolStorageTypeStr(protocolStorageType))));
+        strLstAdd(paramList, cfgCommandRoleNameParam(cfgCommand(), cfgCmdRoleRemote, COLON_STR));
+
+        ioWriteStrLine(
+            tlsSessionIoWrite(protocolHelperClient->tlsSession), jsonFromVar(varNewVarLst(varLstNewStrLst(paramList))));
+        ioWriteFlush(tlsSessionIoWrite(protocolHelperClient->tlsSession));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 ProtocolClient *
 protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostId)
@@ -444,18 +666,35 @@ protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostId)
         MEM_CONTEXT_BEGIN(protocolHelper.memContext)
         {
             unsigned int optHost = isRepo ? cfgOptRepoHost : cfgOptPgHost + hostId - 1;
+            const String *protocolName = strNewFmt(
+                PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", protocolId, strPtr(cfgOptionStr(optHost)));
 
-            // Execute the protocol command
-            protocolHelperClient->exec = execNew(
-                cfgOptionStr(cfgOptCmdSsh), protocolRemoteParam(protocolStorageType, protocolId, hostId - 1),
-                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", protocolId, strPtr(cfgOptionStr(optHost))),
-                (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
-            execOpen(protocolHelperClient->exec);
+            // Connect to the server command over TLS
+            if (strEq(cfgOptionStr(isRepo ? cfgOptRepoHostType : cfgOptPgHostType + hostId - 1), PROTOCOL_REMOTE_HOST_TYPE_TLS_STR))
+            {
+                protocolRemoteTlsOpen(protocolHelperClient, protocolStorageType, protocolId, hostId - 1);
 
-            // Create protocol object
-            protocolHelperClient->client = protocolClientNew(
-                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", protocolId, strPtr(cfgOptionStr(optHost))),
-                PROTOCOL_SERVICE_REMOTE_STR, execIoRead(protocolHelperClient->exec), execIoWrite(protocolHelperClient->exec));
+                // Create protocol object
+                protocolHelperClient->client = protocolClientNew(
+                    protocolName, PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(protocolHelperClient->tlsSession),
+                    tlsSessionIoWrite(protocolHelperClient->tlsSession));
+            }
+            // Else execute the protocol command over ssh
+            else
+            {
+                protocolRemoteSshMaster(protocolStorageType, hostId - 1);
+
+                protocolHelperClient->exec = execNew(
+                    cfgOptionStr(cfgOptCmdSsh), protocolRemoteParam(protocolStorageType, protocolId, hostId - 1),
+                    strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", protocolId, strPtr(cfgOptionStr(optHost))),
+                    (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
+                execOpen(protocolHelperClient->exec);
+
+                // Create protocol object
+                protocolHelperClient->client = protocolClientNew(
+                    protocolName, PROTOCOL_SERVICE_REMOTE_STR, execIoRead(protocolHelperClient->exec),
+                    execIoWrite(protocolHelperClient->exec));
+            }
 
             // Get cipher options from the remote if none are locally configured
             if (isRepo && strEq(cfgOptionStr(cfgOptRepoCipherType), CIPHER_TYPE_NONE_STR))
@@ -474,7 +713,8 @@ protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostId)
                 }
             }
 
-            protocolClientMove(protocolHelperClient->client, execMemContext(protocolHelperClient->exec));
+            if (protocolHelperClient->exec != NULL)
+                protocolClientMove(protocolHelperClient->client, execMemContext(protocolHelperClient->exec));
         }
         MEM_CONTEXT_END();
     }
@@ -500,9 +740,10 @@ protocolRemoteFree(unsigned int hostId)
         {
             protocolClientFree(protocolHelperClient->client);
             execFree(protocolHelperClient->exec);
+            tlsSessionFree(protocolHelperClient->tlsSession);
+            tlsClientFree(protocolHelperClient->tlsClient);
 
-            protocolHelperClient->client = NULL;
-            protocolHelperClient->exec = NULL;
+            *protocolHelperClient = (ProtocolHelperClient){.exec = NULL};
         }
     }
 
@@ -583,9 +824,12 @@ protocolFree(void)
         {
             ProtocolHelperClient *protocolHelperClient = &protocolHelper.clientLocal[clientIdx];
 
-            if (protocolHelperClient->client != NULL)
+            // The local may have been started without a protocol client being created
+            if (protocolHelperClient->exec != NULL)
             {
-                protocolClientFree(protocolHelperClient->client);
+                if (protocolHelperClient->client != NULL)
+                    protocolClientFree(protocolHelperClient->client);
+
                 execFree(protocolHelperClient->exec);
 
                 *protocolHelperClient = (ProtocolHelperClient){.exec = NULL};
@@ -26,6 +26,12 @@ Constants
 #define PROTOCOL_REMOTE_TYPE_PG                                     "pg"
 #define PROTOCOL_REMOTE_TYPE_REPO                                   "repo"
 
+#define PROTOCOL_REMOTE_HOST_TYPE_SSH                               "ssh"
+#define PROTOCOL_REMOTE_HOST_TYPE_TLS                               "tls"
+
+// Default port for remotes reached over TLS, i.e. the default port of the server command
+#define PROTOCOL_REMOTE_TLS_PORT                                    8432
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -35,6 +41,10 @@ void protocolKeepAlive(void);
 // Local protocol client
 ProtocolClient *protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int hostId, unsigned int protocolId);
 
+// Start a local process without waiting for it to be ready. Locals started before protocolLocalGet() is called for any of them will
+// initialize concurrently rather than one after another.
+void protocolLocalStart(ProtocolStorageType protocolStorageType, unsigned int hostId, unsigned int protocolId);
+
 // Remote protocol client
 ProtocolClient *protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostId);
 
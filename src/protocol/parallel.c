@@ -3,8 +3,8 @@ Protocol Parallel Executor
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <poll.h>
 #include <string.h>
-#include <sys/select.h>
 
 #include "common/debug.h"
 #include "common/log.h"
@@ -19,17 +19,29 @@ Protocol Parallel Executor
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
+typedef struct ProtocolParallelClientData
+{
+    List *jobList;                                                  // Jobs being processed by the client (in the order sent)
+    unsigned int jobTotal;                                          // Total jobs sent to the client
+    TimeMSec busyBegin;                                             // When the client last went from idle to busy
+    TimeMSec busyTime;                                              // Total time the client had jobs to process
+} ProtocolParallelClientData;
+
 struct ProtocolParallel
 {
     MemContext *memContext;
     TimeMSec timeout;                                               // Max time to wait for jobs before returning
+    unsigned int queueMax;                                          // Max jobs sent to each client before a response is required
     ParallelJobCallback *callbackFunction;                          // Function to get new jobs
     void *callbackData;                                             // Data to pass to callback function
 
     List *clientList;                                               // List of clients to process jobs
     List *jobList;                                                  // List of jobs to be processed
 
-    ProtocolParallelJob **clientJobList;                            // Jobs being processing by each client
+    ProtocolParallelClientData *clientData;                         // Jobs and statistics for each client
+    struct pollfd *pollList;                                        // Client handles to poll (negative when the client is idle)
+    TimeMSec timeBegin;                                             // When processing began
+    TimeMSec waitTime;                                              // Total time spent waiting for results
 
     ProtocolParallelJobState state;                                 // Overall state of job processing
 };
@@ -38,14 +50,16 @@ OBJECT_DEFINE_FREE(PROTOCOL_PARALLEL);
 
 /**********************************************************************************************************************************/
 ProtocolParallel *
-protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, void *callbackData)
+protocolParallelNew(TimeMSec timeout, unsigned int queueMax, ParallelJobCallback *callbackFunction, void *callbackData)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(UINT64, timeout);
+        FUNCTION_LOG_PARAM(UINT, queueMax);
         FUNCTION_LOG_PARAM(FUNCTIONP, callbackFunction);
         FUNCTION_LOG_PARAM_P(VOID, callbackData);
     FUNCTION_LOG_END();
 
+    ASSERT(queueMax > 0);
     ASSERT(callbackFunction != NULL);
     ASSERT(callbackData != NULL);
 
@@ -59,6 +73,7 @@ protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, voi
         {
             .memContext = MEM_CONTEXT_NEW(),
             .timeout = timeout,
+            .queueMax = queueMax,
             .callbackFunction = callbackFunction,
             .callbackData = callbackData,
             .clientList = lstNew(sizeof(ProtocolClient *)),
@@ -110,88 +125,103 @@ protocolParallelProcess(ProtocolParallel *this)
     {
         MEM_CONTEXT_BEGIN(this->memContext)
         {
-            this->clientJobList = memNewPtrArray(lstSize(this->clientList));
+            this->clientData = memNew(lstSize(this->clientList) * sizeof(ProtocolParallelClientData));
+            this->pollList = memNew(lstSize(this->clientList) * sizeof(struct pollfd));
+
+            for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+            {
+                this->clientData[clientIdx] = (ProtocolParallelClientData){.jobList = lstNew(sizeof(ProtocolParallelJob *))};
+
+                // Register the client handle once. The handle is negated while the client is idle so poll() will ignore it.
+                this->pollList[clientIdx] = (struct pollfd)
+                {
+                    .fd = -1 - ioReadHandle(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx))),
+                    .events = POLLIN,
+                };
+            }
         }
         MEM_CONTEXT_END();
 
+        this->timeBegin = timeMSec();
         this->state = protocolParallelJobStateRunning;
     }
 
-    // Initialize the file descriptor set used for select
-    fd_set selectSet;
-    FD_ZERO(&selectSet);
-    int handleMax = -1;
-
     // Find clients that are running jobs
     unsigned int clientRunningTotal = 0;
 
     for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
     {
-        if (this->clientJobList[clientIdx] != NULL)
-        {
-            int handle = ioReadHandle(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx)));
-            FD_SET((unsigned int)handle, &selectSet);
-
-            // Find the max file handle needed for select()
-            MAX_ASSIGN(handleMax, handle);
-
+        if (lstSize(this->clientData[clientIdx].jobList) > 0)
             clientRunningTotal++;
-        }
     }
 
     // If clients are running then wait for one to finish
     if (clientRunningTotal > 0)
     {
-        // Initialize timeout struct used for select.  Recreate this structure each time since Linux (at least) will modify it.
-        struct timeval timeoutSelect;
-        timeoutSelect.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
-        timeoutSelect.tv_usec = (time_t)(this->timeout % MSEC_PER_SEC * 1000);
-
         // Determine if there is data to be read
-        int completed = select(handleMax + 1, &selectSet, NULL, NULL, &timeoutSelect);
-        THROW_ON_SYS_ERROR(completed == -1, AssertError, "unable to select from parallel client(s)");
+        TimeMSec waitBegin = timeMSec();
+        int completed = poll(this->pollList, lstSize(this->clientList), (int)this->timeout);
+        THROW_ON_SYS_ERROR(completed == -1, AssertError, "unable to poll from parallel client(s)");
+
+        this->waitTime += timeMSec() - waitBegin;
 
         // If any jobs have completed then get the results
         if (completed > 0)
         {
             for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
             {
-                ProtocolParallelJob *job = this->clientJobList[clientIdx];
+                ProtocolClient *client = *(ProtocolClient **)lstGet(this->clientList, clientIdx);
+                ProtocolParallelClientData *clientData = &this->clientData[clientIdx];
 
-                if (job != NULL &&
-                    FD_ISSET(
-                        (unsigned int)ioReadHandle(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx))),
-                        &selectSet))
+                // Error and hangup are also reported so the read below can report why the client failed
+                if (this->pollList[clientIdx].fd >= 0 && this->pollList[clientIdx].revents != 0)
                 {
-                    MEM_CONTEXT_TEMP_BEGIN()
+                    // The server processes commands in the order they were sent, so each response belongs to the oldest job. More
+                    // than one response may have arrived, so keep reading while complete responses are buffered since poll() will
+                    // not report data that has already been read from the handle.
+                    do
                     {
-                        TRY_BEGIN()
-                        {
-                            protocolParallelJobResultSet(
-                                job, protocolClientReadOutput(*(ProtocolClient **)lstGet(this->clientList, clientIdx), true));
-                        }
-                        CATCH_ANY()
+                        ProtocolParallelJob *job = *(ProtocolParallelJob **)lstGet(clientData->jobList, 0);
+
+                        MEM_CONTEXT_TEMP_BEGIN()
                         {
-                            protocolParallelJobErrorSet(job, errorCode(), STR(errorMessage()));
+                            TRY_BEGIN()
+                            {
+                                protocolParallelJobResultSet(job, protocolClientReadOutput(client, true));
+                            }
+                            CATCH_ANY()
+                            {
+                                protocolParallelJobErrorSet(job, errorCode(), STR(errorMessage()));
+                            }
+                            TRY_END();
+
+                            protocolParallelJobStateSet(job, protocolParallelJobStateDone);
+                            lstRemoveIdx(clientData->jobList, 0);
                         }
-                        TRY_END();
+                        MEM_CONTEXT_TEMP_END();
 
-                        protocolParallelJobStateSet(job, protocolParallelJobStateDone);
-                        this->clientJobList[clientIdx] = NULL;
+                        result++;
+                    }
+                    while (lstSize(clientData->jobList) > 0 && protocolClientReadReady(client));
+
+                    // If the client is now idle then stop polling it and add to the time it was busy
+                    if (lstSize(clientData->jobList) == 0)
+                    {
+                        this->pollList[clientIdx].fd = -1 - this->pollList[clientIdx].fd;
+                        clientData->busyTime += timeMSec() - clientData->busyBegin;
                     }
-                    MEM_CONTEXT_TEMP_END();
                 }
             }
-
-            result = (unsigned int)completed;
         }
     }
 
     // Find new jobs to be run
     for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
     {
-        // If nothing is running for this client
-        if (this->clientJobList[clientIdx] == NULL)
+        ProtocolParallelClientData *clientData = &this->clientData[clientIdx];
+
+        // Send jobs until the client queue is full or there are no more jobs for this client
+        while (lstSize(clientData->jobList) < this->queueMax)
         {
             // Get a new job
             ProtocolParallelJob *job = NULL;
@@ -202,21 +232,29 @@ protocolParallelProcess(ProtocolParallel *this)
             }
             MEM_CONTEXT_END();
 
-            // If a new job was found
-            if (job != NULL)
-            {
-                // Add to the job list
-                lstAdd(this->jobList, &job);
+            // Stop if no new job was found
+            if (job == NULL)
+                break;
+
+            // Add to the job list
+            lstAdd(this->jobList, &job);
 
-                // Send the job to the client
-                protocolClientWriteCommand(
-                    *(ProtocolClient **)lstGet(this->clientList, clientIdx), protocolParallelJobCommand(job));
+            // Send the job to the client
+            protocolClientWriteCommand(*(ProtocolClient **)lstGet(this->clientList, clientIdx), protocolParallelJobCommand(job));
 
-                // Set client id and running state
-                protocolParallelJobProcessIdSet(job, clientIdx + 1);
-                protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
-                this->clientJobList[clientIdx] = job;
+            // Set client id and running state
+            protocolParallelJobProcessIdSet(job, clientIdx + 1);
+            protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
+
+            // If the client was idle then start polling it
+            if (lstSize(clientData->jobList) == 0)
+            {
+                this->pollList[clientIdx].fd = -1 - this->pollList[clientIdx].fd;
+                clientData->busyBegin = timeMSec();
             }
+
+            lstAdd(clientData->jobList, &job);
+            clientData->jobTotal++;
         }
     }
 
@@ -251,8 +289,25 @@ protocolParallelResult(ProtocolParallel *this)
 
     // If all jobs have been returned then we are done
     if (lstSize(this->jobList) == 0)
+    {
         this->state = protocolParallelJobStateDone;
 
+        // Log how much time each client spent processing jobs versus waiting for jobs to be sent. A client that is often idle while
+        // the executor is mostly waiting may benefit from a higher process-queue-max.
+        TimeMSec timeTotal = timeMSec() - this->timeBegin;
+
+        for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+        {
+            const ProtocolParallelClientData *clientData = &this->clientData[clientIdx];
+
+            LOG_DEBUG_PID_FMT(
+                clientIdx + 1, "parallel jobs %u, busy %" PRIu64 "ms, idle %" PRIu64 "ms", clientData->jobTotal,
+                clientData->busyTime, timeTotal - clientData->busyTime);
+        }
+
+        LOG_DEBUG_FMT("parallel wait %" PRIu64 "ms, total %" PRIu64 "ms", this->waitTime, timeTotal);
+    }
+
     FUNCTION_LOG_RETURN(PROTOCOL_PARALLEL_JOB, result);
 }
 
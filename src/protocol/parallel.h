@@ -27,7 +27,10 @@ typedef ProtocolParallelJob *ParallelJobCallback(void *data, unsigned int client
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-ProtocolParallel *protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, void *callbackData);
+// Up to queueMax jobs are sent to each client before a response is required. Servers process jobs in the order they are sent, so a
+// queue hides the round trip between jobs, which matters most when jobs are small and clients are remote.
+ProtocolParallel *protocolParallelNew(
+    TimeMSec timeout, unsigned int queueMax, ParallelJobCallback *callbackFunction, void *callbackData);
 
 /***********************************************************************************************************************************
 Functions
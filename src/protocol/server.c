@@ -13,7 +13,9 @@ Protocol Server
 #include "common/type/keyValue.h"
 #include "common/type/list.h"
 #include "common/type/object.h"
+#include "common/type/pack.h"
 #include "protocol/client.h"
+#include "protocol/frame.h"
 #include "protocol/helper.h"
 #include "protocol/server.h"
 #include "version.h"
@@ -112,13 +114,18 @@ protocolServerError(ProtocolServer *this, int code, const String *message, const
     ASSERT(message != NULL);
     ASSERT(stack != NULL);
 
-    KeyValue *error = kvNew();
-    kvPut(error, VARSTR(PROTOCOL_ERROR_STR), VARINT(code));
-    kvPut(error, VARSTR(PROTOCOL_OUTPUT_STR), VARSTR(message));
-    kvPut(error, VARSTR(PROTOCOL_ERROR_STACK_STR), VARSTR(stack));
+    // Pack the error code, message, and stack trace in the order expected by the client
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Buffer *errorData = bufNew(0);
+        packCatVar(errorData, VARINT(code));
+        packCatVar(errorData, VARSTR(message));
+        packCatVar(errorData, VARSTR(stack));
 
-    ioWriteStrLine(this->write, jsonFromKv(error));
-    ioWriteFlush(this->write);
+        protocolFrameWrite(this->write, protocolFrameTypeError, errorData);
+        ioWriteFlush(this->write);
+    }
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -141,9 +148,24 @@ protocolServerProcess(ProtocolServer *this)
             MEM_CONTEXT_TEMP_BEGIN()
             {
                 // Read command
-                KeyValue *commandKv = jsonToKv(ioReadLine(this->read));
-                const String *command = varStr(kvGet(commandKv, VARSTR(PROTOCOL_KEY_COMMAND_STR)));
-                VariantList *paramList = varVarLst(kvGet(commandKv, VARSTR(PROTOCOL_KEY_PARAMETER_STR)));
+                ProtocolFrame frame = protocolFrameRead(this->read);
+
+                if (frame.type != protocolFrameTypeCommand)
+                    THROW_FMT(ProtocolError, "expected command frame but got frame type %u", frame.type);
+
+                // The command frame contains the command and the parameter list (which may be NULL) in that order
+                size_t framePos = 0;
+                const Variant *commandVar = packReadVar(frame.data, &framePos);
+                const Variant *paramVar = packReadVar(frame.data, &framePos);
+
+                if (commandVar == NULL || varType(commandVar) != varTypeString ||
+                    (paramVar != NULL && varType(paramVar) != varTypeVariantList) || framePos != bufUsed(frame.data))
+                {
+                    THROW(ProtocolError, "invalid command frame");
+                }
+
+                const String *command = varStr(commandVar);
+                VariantList *paramList = varVarLst(paramVar);
 
                 // Process command
                 bool found = false;
@@ -204,13 +226,12 @@ protocolServerResponse(ProtocolServer *this, const Variant *output)
         FUNCTION_LOG_PARAM(VARIANT, output);
     FUNCTION_LOG_END();
 
-    KeyValue *result = kvNew();
-
-    if (output != NULL)
-        kvAdd(result, VARSTR(PROTOCOL_OUTPUT_STR), output);
-
-    ioWriteStrLine(this->write, jsonFromKv(result));
-    ioWriteFlush(this->write);
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        protocolFrameWrite(this->write, protocolFrameTypeResponse, packFromVar(output));
+        ioWriteFlush(this->write);
+    }
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -5,6 +5,7 @@ Storage Helper
 
 #include <string.h>
 
+#include "common/compress/helper.h"
 #include "common/debug.h"
 #include "common/io/io.h"
 #include "common/memContext.h"
@@ -177,7 +178,8 @@ storagePgGet(unsigned int hostId, bool write)
     {
         result = storageRemoteNew(
             STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, write, NULL,
-            protocolRemoteGet(protocolStorageTypePg, hostId), cfgOptionUInt(cfgOptCompressLevelNetwork));
+            protocolRemoteGet(protocolStorageTypePg, hostId), compressTypeEnum(cfgOptionStr(cfgOptCompressTypeNetwork)),
+            cfgOptionUInt(cfgOptCompressLevelNetwork));
     }
     // Use Posix storage
     else
@@ -348,7 +350,8 @@ storageRepoGet(const String *type, bool write)
     {
         result = storageRemoteNew(
             STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, write, storageRepoPathExpression,
-            protocolRemoteGet(protocolStorageTypeRepo, 1), cfgOptionUInt(cfgOptCompressLevelNetwork));
+            protocolRemoteGet(protocolStorageTypeRepo, 1), compressTypeEnum(cfgOptionStr(cfgOptCompressTypeNetwork)),
+            cfgOptionUInt(cfgOptCompressLevelNetwork));
     }
     // Use CIFS storage
     else if (strEqZ(type, STORAGE_TYPE_CIFS))
@@ -380,8 +383,10 @@ storageRepoGet(const String *type, bool write)
             cfgOptionStr(cfgOptRepoPath), write, storageRepoPathExpression, cfgOptionStr(cfgOptRepoS3Bucket), endPoint,
             strEqZ(cfgOptionStr(cfgOptRepoS3UriStyle), STORAGE_S3_URI_STYLE_HOST) ? storageS3UriStyleHost : storageS3UriStylePath,
             cfgOptionStr(cfgOptRepoS3Region), cfgOptionStr(cfgOptRepoS3Key), cfgOptionStr(cfgOptRepoS3KeySecret),
-            cfgOptionStrNull(cfgOptRepoS3Token), STORAGE_S3_PARTSIZE_MIN, STORAGE_S3_DELETE_MAX, host, port, ioTimeoutMs(),
-            cfgOptionBool(cfgOptRepoS3VerifyTls), cfgOptionStrNull(cfgOptRepoS3CaFile), cfgOptionStrNull(cfgOptRepoS3CaPath));
+            cfgOptionStrNull(cfgOptRepoS3Token), STORAGE_S3_PARTSIZE_MIN, cfgOptionUInt(cfgOptRepoS3UploadMax),
+            cfgOptionUInt(cfgOptRepoS3DownloadMax), cfgOptionUInt(cfgOptRepoS3ListMax), STORAGE_S3_DELETE_MAX, host, port,
+            ioTimeoutMs(), cfgOptionBool(cfgOptRepoS3Tls), cfgOptionBool(cfgOptRepoS3VerifyTls),
+            cfgOptionStrNull(cfgOptRepoS3CaFile), cfgOptionStrNull(cfgOptRepoS3CaPath));
     }
     else
         THROW_FMT(AssertError, "invalid storage type '%s'", strPtr(type));
@@ -86,6 +86,15 @@ storageReadPosixOpen(THIS_VOID)
     if (this->handle != -1)
     {
         memContextCallbackSet(this->memContext, storageReadPosixFreeResource, this);
+
+        // Seek to offset
+        if (this->interface.offset != 0)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                lseek(this->handle, (off_t)this->interface.offset, SEEK_SET) == -1, FileOpenError, STORAGE_ERROR_READ_SEEK,
+                this->interface.offset, strPtr(this->interface.name));
+        }
+
         result = true;
     }
 
@@ -197,11 +206,12 @@ storageReadPosixHandle(const THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissing, const Variant *limit)
+storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
         FUNCTION_LOG_PARAM(VARIANT, limit);
     FUNCTION_LOG_END();
 
@@ -229,6 +239,7 @@ storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissin
                 .type = STORAGE_POSIX_TYPE_STR,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
                 .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
@@ -1,6 +1,12 @@
 /***********************************************************************************************************************************
 Posix Storage
 ***********************************************************************************************************************************/
+// copy_file_range() is only declared when _GNU_SOURCE is defined. Define it here rather than for the entire build since it also
+// changes the behavior of other functions, e.g. strerror_r().
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
 #include "build.auto.h"
 
 #include <dirent.h>
@@ -13,6 +19,7 @@ Posix Storage
 #include <unistd.h>
 
 #include "common/debug.h"
+#include "common/io/io.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
@@ -33,6 +40,13 @@ Define PATH_MAX if it is not defined
     #define PATH_MAX                                                (4 * 1024)
 #endif
 
+/***********************************************************************************************************************************
+Maximum bytes to request from each call to copy_file_range()
+***********************************************************************************************************************************/
+#ifdef HAVE_COPY_FILE_RANGE
+    #define STORAGE_POSIX_COPY_SIZE                                 ((size_t)1024 * 1024 * 1024)
+#endif
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -42,6 +56,79 @@ struct StoragePosix
     MemContext *memContext;                                         // Object memory context
 };
 
+/**********************************************************************************************************************************/
+static void
+storagePosixCopy(THIS_VOID, StorageRead *source, StorageWrite *destination, StorageInterfaceCopyParam param)
+{
+    THIS(StoragePosix);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
+        FUNCTION_LOG_PARAM(STORAGE_READ, source);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, destination);
+        (void)param;                                                // No parameters are used
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(source != NULL);
+    ASSERT(destination != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        IoRead *read = storageReadIo(source);
+        IoWrite *write = storageWriteIo(destination);
+
+        // Open the source first so the destination is not created when the source is missing
+        ioReadOpen(read);
+        ioWriteOpen(write);
+
+        bool done = false;
+
+#ifdef HAVE_COPY_FILE_RANGE
+        // Let the kernel copy the file so the data does not pass through user space. This also allows the filesystem to clone the
+        // file or copy it on the server (e.g. NFS) when supported.
+        bool started = false;
+        ssize_t copySize;
+
+        while ((copySize = copy_file_range(
+                    ioReadHandle(read), NULL, ioWriteHandle(write), NULL, STORAGE_POSIX_COPY_SIZE, 0)) > 0)
+        {
+            started = true;
+        }
+
+        if (copySize == 0)
+            done = true;
+        // Fall back to copying through user space when the kernel or filesystem does not support copy_file_range() for these files,
+        // but only if nothing has been copied yet
+        else if (started || (errno != ENOSYS && errno != EXDEV && errno != EINVAL && errno != EOPNOTSUPP))         // {vm_covered}
+        {
+            THROW_SYS_ERROR_FMT(                                                                                    // {vm_covered}
+                FileWriteError, "unable to copy '%s' to '%s'", strPtr(storageReadName(source)),                     // {vm_covered}
+                strPtr(storageWriteName(destination)));                                                             // {vm_covered}
+        }
+#endif
+
+        if (!done)                                                                                                  // {vm_covered}
+        {
+            Buffer *buffer = bufNew(ioBufferSize());                                                                // {vm_covered}
+
+            do
+            {
+                ioRead(read, buffer);                                                                               // {vm_covered}
+                ioWrite(write, buffer);                                                                             // {vm_covered}
+                bufUsedZero(buffer);                                                                                // {vm_covered}
+            }
+            while (!ioReadEof(read));                                                                               // {vm_covered}
+        }
+
+        ioReadClose(read);
+        ioWriteClose(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 static StorageInfo
 storagePosixInfo(THIS_VOID, const String *file, StorageInfoLevel level, StorageInterfaceInfoParam param)
@@ -315,13 +402,14 @@ storagePosixNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageIn
         FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadPosixNew(this, file, ignoreMissing, param.limit));
+    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadPosixNew(this, file, ignoreMissing, param.offset, param.limit));
 }
 
 /**********************************************************************************************************************************/
@@ -552,6 +640,7 @@ static const StorageInterface storageInterfacePosix =
 {
     .feature = 1 << storageFeaturePath | 1 << storageFeatureCompress | 1 << storageFeatureLimitRead,
 
+    .copy = storagePosixCopy,
     .info = storagePosixInfo,
     .infoList = storagePosixInfoList,
     .move = storagePosixMove,
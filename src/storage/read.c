@@ -110,6 +110,19 @@ storageReadName(const StorageRead *this)
     FUNCTION_TEST_RETURN(this->interface->name);
 }
 
+/**********************************************************************************************************************************/
+uint64_t
+storageReadOffset(const StorageRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->interface->offset);
+}
+
 /**********************************************************************************************************************************/
 const String *
 storageReadType(const StorageRead *this)
@@ -34,6 +34,9 @@ const Variant *storageReadLimit(const StorageRead *this);
 // File name
 const String *storageReadName(const StorageRead *this);
 
+// Offset where reading starts
+uint64_t storageReadOffset(const StorageRead *this);
+
 // Get file type
 const String *storageReadType(const StorageRead *this);
 
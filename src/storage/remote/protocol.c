@@ -3,6 +3,15 @@ Remote Storage Protocol Handler
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <limits.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+    #include <sys/sendfile.h>
+#endif
+
 #include "command/backup/pageChecksum.h"
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
@@ -13,7 +22,6 @@ Remote Storage Protocol Handler
 #include "common/io/io.h"
 #include "common/log.h"
 #include "common/memContext.h"
-#include "common/regExp.h"
 #include "common/type/json.h"
 #include "config/config.h"
 #include "protocol/helper.h"
@@ -27,6 +35,7 @@ Constants
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_FEATURE_STR,                 PROTOCOL_COMMAND_STORAGE_FEATURE);
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_INFO_STR,                    PROTOCOL_COMMAND_STORAGE_INFO);
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_INFO_LIST_STR,               PROTOCOL_COMMAND_STORAGE_INFO_LIST);
+STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_INFO_LIST_MULTI_STR,         PROTOCOL_COMMAND_STORAGE_INFO_LIST_MULTI);
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR,               PROTOCOL_COMMAND_STORAGE_OPEN_READ);
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_OPEN_WRITE_STR,              PROTOCOL_COMMAND_STORAGE_OPEN_WRITE);
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_PATH_CREATE_STR,             PROTOCOL_COMMAND_STORAGE_PATH_CREATE);
@@ -34,20 +43,6 @@ STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_PATH_REMOVE_STR,             PROTOCOL_COM
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_PATH_SYNC_STR,               PROTOCOL_COMMAND_STORAGE_PATH_SYNC);
 STRING_EXTERN(PROTOCOL_COMMAND_STORAGE_REMOVE_STR,                  PROTOCOL_COMMAND_STORAGE_REMOVE);
 
-/***********************************************************************************************************************************
-Regular expressions
-***********************************************************************************************************************************/
-STRING_STATIC(BLOCK_REG_EXP_STR,                                    PROTOCOL_BLOCK_HEADER "-1|[0-9]+");
-
-/***********************************************************************************************************************************
-Local variables
-***********************************************************************************************************************************/
-static struct
-{
-    MemContext *memContext;                                         // Mem context
-    RegExp *blockRegExp;                                            // Regular expression to check block messages
-} storageRemoteProtocolLocal;
-
 /***********************************************************************************************************************************
 Set filter group based on passed filters
 ***********************************************************************************************************************************/
@@ -179,6 +174,97 @@ storageRemoteProtocolInfoListCallback(void *server, const StorageInfo *info)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Send a file directly from its handle to the protocol handle
+
+When no filters need to be applied the data does not need to pass through user space buffers, so sendfile() is used to copy it in
+the kernel. The file is sent in blocks no larger than the buffer size, the same as a buffered copy, so block sizes always fit in a
+size_t on the client. Returns false when either side does not have a handle (or sendfile() is not available) so the caller can fall
+back to a buffered copy.
+***********************************************************************************************************************************/
+static bool
+storageRemoteProtocolSendFile(IoRead *fileRead, IoWrite *write, const String *name, const Variant *limit)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, fileRead);
+        FUNCTION_TEST_PARAM(IO_WRITE, write);
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM(VARIANT, limit);
+    FUNCTION_TEST_END();
+
+    ASSERT(fileRead != NULL);
+    ASSERT(write != NULL);
+    ASSERT(name != NULL);
+
+    bool result = false;
+
+#ifdef __linux__
+    int fileHandle = ioReadHandle(fileRead);
+    int writeHandle = ioWriteHandle(write);
+
+    if (fileHandle != -1 && writeHandle != -1)
+    {
+        // Determine the bytes remaining after the current position (the offset was applied when the file was opened)
+        struct stat statFile;
+        off_t position = lseek(fileHandle, 0, SEEK_CUR);
+
+        THROW_ON_SYS_ERROR_FMT(
+            fstat(fileHandle, &statFile) == -1 || position == -1, FileReadError, "unable to get size of file '%s'", strPtr(name));
+
+        uint64_t remaining = statFile.st_size > position ? (uint64_t)(statFile.st_size - position) : 0;
+
+        if (limit != NULL && varUInt64(limit) < remaining)
+            remaining = varUInt64(limit);
+
+        while (remaining > 0)
+        {
+            size_t blockSize = remaining > ioBufferSize() ? ioBufferSize() : (size_t)remaining;
+            size_t blockSent = 0;
+
+            // Send the block header and flush so the header is written before the file data
+            ioWriteStrLine(write, strNewFmt(PROTOCOL_BLOCK_HEADER "%zu", blockSize));
+            ioWriteFlush(write);
+
+            TRY_BEGIN()
+            {
+                do
+                {
+                    ssize_t sendBytes = sendfile(writeHandle, fileHandle, NULL, blockSize - blockSent);
+
+                    THROW_ON_SYS_ERROR_FMT(sendBytes == -1, FileReadError, "unable to send file '%s'", strPtr(name));
+
+                    if (sendBytes == 0)
+                        THROW_FMT(FileReadError, "unexpected eof while sending file '%s'", strPtr(name));
+
+                    blockSent += (size_t)sendBytes;
+                }
+                while (blockSent < blockSize);
+            }
+            CATCH_ANY()
+            {
+                // The block size has already been sent so fill the rest of the block to keep the client in sync. The error is then
+                // sent in place of the next block header where the client expects it.
+                Buffer *fill = bufNew(blockSize - blockSent);
+                memset(bufPtr(fill), 0, bufSize(fill));
+                bufUsedSet(fill, bufSize(fill));
+
+                ioWrite(write, fill);
+                ioWriteFlush(write);
+
+                RETHROW();
+            }
+            TRY_END();
+
+            remaining -= blockSize;
+        }
+
+        result = true;
+    }
+#endif
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 bool
 storageRemoteProtocol(const String *command, const VariantList *paramList, ProtocolServer *server)
@@ -232,15 +318,44 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
             protocolServerWriteLine(server, NULL);
             protocolServerResponse(server, VARBOOL(result));
         }
+        else if (strEq(command, PROTOCOL_COMMAND_STORAGE_INFO_LIST_MULTI_STR))
+        {
+            // Read the path list, which follows the command since it may be too large for the command line. All paths are read
+            // before any info is written so the client is never blocked sending paths while info is waiting to be read.
+            StringList *pathList = strLstNew();
+            const String *path = ioReadLine(protocolServerIoRead(server));
+
+            while (strSize(path) != 0)
+            {
+                strLstAdd(pathList, jsonToStr(path));
+                path = ioReadLine(protocolServerIoRead(server));
+            }
+
+            // Write info for each path. The info for each path ends with a blank line.
+            for (unsigned int pathIdx = 0; pathIdx < strLstSize(pathList); pathIdx++)
+            {
+                storageInterfaceInfoListP(
+                    driver, strLstGet(pathList, pathIdx), (StorageInfoLevel)varUIntForce(varLstGet(paramList, 0)),
+                    storageRemoteProtocolInfoListCallback, server);
+
+                protocolServerWriteLine(server, NULL);
+            }
+
+            protocolServerResponse(server, NULL);
+        }
         else if (strEq(command, PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR))
         {
             // Create the read object
             IoRead *fileRead = storageReadIo(
                 storageInterfaceNewReadP(
-                    driver, varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)), .limit = varLstGet(paramList, 2)));
+                    driver, varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)),
+                    .offset = varUInt64(varLstGet(paramList, 2)), .limit = varLstGet(paramList, 3)));
 
             // Set filter group based on passed filters
-            storageRemoteFilterGroup(ioReadFilterGroup(fileRead), varLstGet(paramList, 3));
+            storageRemoteFilterGroup(ioReadFilterGroup(fileRead), varLstGet(paramList, 4));
+
+            // The file can be sent directly from its handle when there are no filters to apply
+            bool sendFile = ioFilterGroupSize(ioReadFilterGroup(fileRead)) == 0;
 
             // Check if the file exists
             bool exists = ioReadOpen(fileRead);
@@ -249,23 +364,29 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
             // Transfer the file if it exists
             if (exists)
             {
-                Buffer *buffer = bufNew(ioBufferSize());
-
-                // Write file out to protocol layer
-                do
+                if (!sendFile ||
+                    !storageRemoteProtocolSendFile(
+                        fileRead, protocolServerIoWrite(server), varStr(varLstGet(paramList, 0)), varLstGet(paramList, 3)))
                 {
-                    ioRead(fileRead, buffer);
+                    Buffer *buffer = bufNew(ioBufferSize());
 
-                    if (bufUsed(buffer) > 0)
+                    // Write file out to protocol layer
+                    do
                     {
-                        ioWriteStrLine(protocolServerIoWrite(server), strNewFmt(PROTOCOL_BLOCK_HEADER "%zu", bufUsed(buffer)));
-                        ioWrite(protocolServerIoWrite(server), buffer);
-                        ioWriteFlush(protocolServerIoWrite(server));
+                        ioRead(fileRead, buffer);
 
-                        bufUsedZero(buffer);
+                        if (bufUsed(buffer) > 0)
+                        {
+                            ioWriteStrLine(
+                                protocolServerIoWrite(server), strNewFmt(PROTOCOL_BLOCK_HEADER "%zu", bufUsed(buffer)));
+                            ioWrite(protocolServerIoWrite(server), buffer);
+                            ioWriteFlush(protocolServerIoWrite(server));
+
+                            bufUsedZero(buffer);
+                        }
                     }
+                    while (!ioReadEof(fileRead));
                 }
-                while (!ioReadEof(fileRead));
 
                 ioReadClose(fileRead);
 
@@ -383,24 +504,33 @@ storageRemoteProtocolBlockSize(const String *message)
 
     ASSERT(message != NULL);
 
-    // Create block regular expression if it has not been created yet
-    if (storageRemoteProtocolLocal.memContext == NULL)
+    // Validate the header block size message. This is done without a regular expression since it is called for every block. The
+    // size must be -1 or an unsigned integer.
+    const char *size = NULL;
+
+    if (strBeginsWithZ(message, PROTOCOL_BLOCK_HEADER))
     {
-        MEM_CONTEXT_BEGIN(memContextTop())
-        {
-            MEM_CONTEXT_NEW_BEGIN("StorageRemoteFileReadLocal")
-            {
-                storageRemoteProtocolLocal.memContext = memContextCurrent();
-                storageRemoteProtocolLocal.blockRegExp = regExpNew(BLOCK_REG_EXP_STR);
-            }
-            MEM_CONTEXT_NEW_END();
-        }
-        MEM_CONTEXT_END();
+        size = strPtr(message) + sizeof(PROTOCOL_BLOCK_HEADER) - 1;
+
+        if (strcmp(size, "-1") != 0 && (size[0] == '\0' || strspn(size, "0123456789") != strlen(size)))
+            size = NULL;
     }
 
-    // Validate the header block size message
-    if (!regExpMatch(storageRemoteProtocolLocal.blockRegExp, message))
+    if (size == NULL)
         THROW_FMT(ProtocolError, "'%s' is not a valid block size message", strPtr(message));
 
-    FUNCTION_LOG_RETURN(SSIZE, (ssize_t)cvtZToInt(strPtr(message) + sizeof(PROTOCOL_BLOCK_HEADER) - 1));
+    ssize_t result = -1;
+
+    if (strcmp(size, "-1") != 0)
+    {
+        // Blocks are never larger than the buffer size but make sure the size cannot be truncated, e.g. on a 32-bit system
+        uint64_t blockSize = cvtZToUInt64(size);
+
+        if (blockSize > SSIZE_MAX)
+            THROW_FMT(ProtocolError, "block size in '%s' is too large", strPtr(message));
+
+        result = (ssize_t)blockSize;
+    }
+
+    FUNCTION_LOG_RETURN(SSIZE, result);
 }
@@ -4,6 +4,8 @@ Remote Storage Protocol Handler
 #ifndef STORAGE_REMOTE_PROTOCOL_H
 #define STORAGE_REMOTE_PROTOCOL_H
 
+#include <sys/types.h>
+
 #include "common/type/string.h"
 #include "common/type/variantList.h"
 #include "protocol/server.h"
@@ -19,6 +21,8 @@ Constants
     STRING_DECLARE(PROTOCOL_COMMAND_STORAGE_INFO_STR);
 #define PROTOCOL_COMMAND_STORAGE_INFO_LIST                          "storageInfoList"
     STRING_DECLARE(PROTOCOL_COMMAND_STORAGE_INFO_LIST_STR);
+#define PROTOCOL_COMMAND_STORAGE_INFO_LIST_MULTI                    "storageInfoListMulti"
+    STRING_DECLARE(PROTOCOL_COMMAND_STORAGE_INFO_LIST_MULTI_STR);
 #define PROTOCOL_COMMAND_STORAGE_OPEN_READ                          "storageOpenRead"
     STRING_DECLARE(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR);
 #define PROTOCOL_COMMAND_STORAGE_OPEN_WRITE                         "storageOpenWrite"
@@ -13,6 +13,7 @@ Remote Storage Read
 #include "common/memContext.h"
 #include "common/type/convert.h"
 #include "common/type/object.h"
+#include "protocol/frame.h"
 #include "storage/remote/protocol.h"
 #include "storage/remote/read.h"
 #include "storage/read.intern.h"
@@ -28,6 +29,7 @@ typedef struct StorageReadRemote
     StorageRead *read;                                              // Storage read interface
 
     ProtocolClient *client;                                         // Protocol client for requests
+    CompressType compressType;                                      // Protocol compression type
     size_t remaining;                                               // Bytes remaining to be read in block
     bool eof;                                                       // Has the file reached eof?
 
@@ -62,27 +64,38 @@ storageReadRemoteOpen(THIS_VOID)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // If the file is compressible add compression filter on the remote
-        if (this->interface.compressible)
+        IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(this->read));
+        unsigned int filterTotal = ioFilterGroupSize(filterGroup);
+        const IoFilter *filterLast = filterTotal == 0 ? NULL : ioFilterGroupFilter(filterGroup, filterTotal - 1);
+        IoFilter *decompress = NULL;
+
+        // If the last filter would decompress on the remote then run it locally instead so the compressed bytes are sent unchanged
+        if (filterLast != NULL && decompressFilterIs(filterLast))
+        {
+            decompress = ioFilterGroupRemove(filterGroup, filterTotal - 1);
+        }
+        // Else if the file is compressible add compression filter on the remote, unless the output is already compressed
+        else if (this->interface.compressible && (filterLast == NULL || !compressFilterIs(filterLast)))
         {
-            ioFilterGroupAdd(
-                ioReadFilterGroup(storageReadIo(this->read)), compressFilter(compressTypeGz, (int)this->interface.compressLevel));
+            ioFilterGroupAdd(filterGroup, compressFilter(this->compressType, (int)this->interface.compressLevel));
+            decompress = decompressFilter(this->compressType);
         }
 
         ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR);
         protocolCommandParamAdd(command, VARSTR(this->interface.name));
         protocolCommandParamAdd(command, VARBOOL(this->interface.ignoreMissing));
+        protocolCommandParamAdd(command, VARUINT64(this->interface.offset));
         protocolCommandParamAdd(command, this->interface.limit);
-        protocolCommandParamAdd(command, ioFilterGroupParamAll(ioReadFilterGroup(storageReadIo(this->read))));
+        protocolCommandParamAdd(command, ioFilterGroupParamAll(filterGroup));
 
         result = varBool(protocolClientExecute(this->client, command, true));
 
         // Clear filters since they will be run on the remote side
-        ioFilterGroupClear(ioReadFilterGroup(storageReadIo(this->read)));
+        ioFilterGroupClear(filterGroup);
 
-        // If the file is compressible add decompression filter locally
-        if (this->interface.compressible)
-            ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(this->read)), decompressFilter(compressTypeGz));
+        // Add decompression filter locally
+        if (decompress != NULL)
+            ioFilterGroupAdd(filterGroup, decompress);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -118,6 +131,13 @@ storageReadRemote(THIS_VOID, Buffer *buffer, bool block)
             {
                 MEM_CONTEXT_TEMP_BEGIN()
                 {
+                    // If the remote failed while sending the file then an error frame is sent in place of the block header
+                    if (protocolFrameNext(protocolClientIoRead(this->client)))
+                    {
+                        protocolClientReadOutput(this->client, false);
+                        THROW(ProtocolError, "expected block header but got response");
+                    }
+
                     this->remaining = (size_t)storageRemoteProtocolBlockSize(ioReadLine(protocolClientIoRead(this->client)));
 
                     if (this->remaining == 0)
@@ -177,7 +197,7 @@ storageReadRemoteEof(THIS_VOID)
 StorageRead *
 storageReadRemoteNew(
     StorageRemote *storage, ProtocolClient *client, const String *name, bool ignoreMissing, bool compressible,
-    unsigned int compressLevel, const Variant *limit)
+    CompressType compressType, unsigned int compressLevel, uint64_t offset, const Variant *limit)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_REMOTE, storage);
@@ -185,7 +205,9 @@ storageReadRemoteNew(
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
         FUNCTION_LOG_PARAM(BOOL, compressible);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(UINT, compressLevel);
+        FUNCTION_LOG_PARAM(UINT64, offset);
         FUNCTION_LOG_PARAM(VARIANT, limit);
     FUNCTION_LOG_END();
 
@@ -204,6 +226,7 @@ storageReadRemoteNew(
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
             .client = client,
+            .compressType = compressType,
 
             .interface = (StorageReadInterface)
             {
@@ -212,6 +235,7 @@ storageReadRemoteNew(
                 .compressible = compressible,
                 .compressLevel = compressLevel,
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
                 .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
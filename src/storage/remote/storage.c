@@ -26,6 +26,7 @@ struct StorageRemote
     STORAGE_COMMON_MEMBER;
     MemContext *memContext;
     ProtocolClient *client;                                         // Protocol client
+    CompressType compressType;                                      // Protocol compression type
     unsigned int compressLevel;                                     // Protocol compression level
 };
 
@@ -136,6 +137,41 @@ storageRemoteInfo(THIS_VOID, const String *file, StorageInfoLevel level, Storage
 }
 
 /**********************************************************************************************************************************/
+// Helper to parse an info list from the protocol output. The list ends when there is a blank line -- this is safe even for file
+// systems that allow blank filenames since the filename is json-encoded so will always include quotes.
+static void
+storageRemoteInfoListParse(ProtocolClient *client, StorageInfoLevel level, StorageInfoListCallback callback, void *callbackData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_CLIENT, client);
+        FUNCTION_TEST_PARAM(ENUM, level);
+        FUNCTION_TEST_PARAM(FUNCTIONP, callback);
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+    FUNCTION_TEST_END();
+
+    MEM_CONTEXT_TEMP_RESET_BEGIN()
+    {
+        const String *name = protocolClientReadLine(client);
+
+        while (strSize(name) != 0)
+        {
+            StorageInfo info = {.exists = true, .level = level, .name = jsonToStr(name)};
+
+            storageRemoteInfoParse(client, &info);
+            callback(callbackData, &info);
+
+            // Reset the memory context occasionally so we don't use too much memory or slow down processing
+            MEM_CONTEXT_TEMP_RESET(1000);
+
+            // Read the next item
+            name = protocolClientReadLine(client);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 static bool
 storageRemoteInfoList(
     THIS_VOID, const String *path, StorageInfoLevel level, StorageInfoListCallback callback, void *callbackData,
@@ -167,34 +203,87 @@ storageRemoteInfoList(
         // Send command
         protocolClientWriteCommand(this->client, command);
 
-        // Read list.  The list ends when there is a blank line -- this is safe even for file systems that allow blank filenames
-        // since the filename is json-encoded so will always include quotes.
-        MEM_CONTEXT_TEMP_RESET_BEGIN()
-        {
-            const String *name = protocolClientReadLine(this->client);
+        // Read list
+        storageRemoteInfoListParse(this->client, level, callback, callbackData);
 
-            while (strSize(name) != 0)
-            {
-                StorageInfo info = {.exists = true, .level = level, .name = jsonToStr(name)};
+        // Acknowledge command completed
+        result = varBool(protocolClientReadOutput(this->client, true));
+    }
+    MEM_CONTEXT_TEMP_END();
 
-                storageRemoteInfoParse(this->client, &info);
-                callback(callbackData, &info);
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
 
-                // Reset the memory context occasionally so we don't use too much memory or slow down processing
-                MEM_CONTEXT_TEMP_RESET(1000);
+/**********************************************************************************************************************************/
+typedef struct StorageRemoteInfoListMultiData
+{
+    StorageInfoListMultiCallback callback;                          // Original callback function
+    void *callbackData;                                             // Original callback data
+    unsigned int pathIdx;                                           // Index of the path currently being parsed
+} StorageRemoteInfoListMultiData;
 
-                // Read the next item
-                name = protocolClientReadLine(this->client);
-            }
-        }
-        MEM_CONTEXT_TEMP_END();
+static void
+storageRemoteInfoListMultiCallback(void *data, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    StorageRemoteInfoListMultiData *multiData = data;
+
+    multiData->callback(multiData->callbackData, multiData->pathIdx, info);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static void
+storageRemoteInfoListMulti(
+    THIS_VOID, const StringList *pathList, StorageInfoLevel level, StorageInfoListMultiCallback callback, void *callbackData,
+    StorageInterfaceInfoListMultiParam param)
+{
+    THIS(StorageRemote);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_REMOTE, this);
+        FUNCTION_LOG_PARAM(STRING_LIST, pathList);
+        FUNCTION_LOG_PARAM(ENUM, level);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+        (void)param;                                                // No parameters are used
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(pathList != NULL);
+    ASSERT(callback != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_STORAGE_INFO_LIST_MULTI_STR);
+        protocolCommandParamAdd(command, VARUINT(level));
+
+        // Send command followed by the path list. The paths are not sent as command parameters since there may be too many to fit
+        // in a single line. The path list ends with a blank line.
+        protocolClientWriteCommand(this->client, command);
+
+        for (unsigned int pathIdx = 0; pathIdx < strLstSize(pathList); pathIdx++)
+            ioWriteStrLine(protocolClientIoWrite(this->client), jsonFromStr(strLstGet(pathList, pathIdx)));
+
+        ioWriteStrLine(protocolClientIoWrite(this->client), EMPTY_STR);
+        ioWriteFlush(protocolClientIoWrite(this->client));
+
+        // Read the list for each path in the order the paths were sent
+        StorageRemoteInfoListMultiData data = {.callback = callback, .callbackData = callbackData};
+
+        for (; data.pathIdx < strLstSize(pathList); data.pathIdx++)
+            storageRemoteInfoListParse(this->client, level, storageRemoteInfoListMultiCallback, &data);
 
         // Acknowledge command completed
-        result = varBool(protocolClientReadOutput(this->client, true));
+        protocolClientReadOutput(this->client, false);
     }
     MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_LOG_RETURN(BOOL, result);
+    FUNCTION_LOG_RETURN_VOID();
 }
 
 /**********************************************************************************************************************************/
@@ -208,6 +297,7 @@ storageRemoteNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageI
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
@@ -217,8 +307,8 @@ storageRemoteNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageI
     FUNCTION_LOG_RETURN(
         STORAGE_READ,
         storageReadRemoteNew(
-            this, this->client, file, ignoreMissing, this->compressLevel > 0 ? param.compressible : false, this->compressLevel,
-            param.limit));
+            this, this->client, file, ignoreMissing, this->compressLevel > 0 ? param.compressible : false, this->compressType,
+            this->compressLevel, param.offset, param.limit));
 }
 
 /**********************************************************************************************************************************/
@@ -251,7 +341,7 @@ storageRemoteNewWrite(
         storageWriteRemoteNew(
             this, this->client, file, param.modeFile, param.modePath, param.user, param.group, param.timeModified, param.createPath,
             param.syncFile, param.syncPath, param.atomic, this->compressLevel > 0 ? param.compressible : false,
-            this->compressLevel));
+            this->compressType, this->compressLevel));
 }
 
 /**********************************************************************************************************************************/
@@ -379,6 +469,7 @@ static const StorageInterface storageInterfaceRemote =
 {
     .info = storageRemoteInfo,
     .infoList = storageRemoteInfoList,
+    .infoListMulti = storageRemoteInfoListMulti,
     .newRead = storageRemoteNewRead,
     .newWrite = storageRemoteNewWrite,
     .pathCreate = storageRemotePathCreate,
@@ -390,7 +481,7 @@ static const StorageInterface storageInterfaceRemote =
 Storage *
 storageRemoteNew(
     mode_t modeFile, mode_t modePath, bool write, StoragePathExpressionCallback pathExpressionFunction, ProtocolClient *client,
-    unsigned int compressLevel)
+    CompressType compressType, unsigned int compressLevel)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MODE, modeFile);
@@ -398,6 +489,7 @@ storageRemoteNew(
         FUNCTION_LOG_PARAM(BOOL, write);
         FUNCTION_LOG_PARAM(FUNCTIONP, pathExpressionFunction);
         FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, client);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(UINT, compressLevel);
     FUNCTION_LOG_END();
 
@@ -415,6 +507,7 @@ storageRemoteNew(
         {
             .memContext = MEM_CONTEXT_NEW(),
             .client = client,
+            .compressType = compressType,
             .compressLevel = compressLevel,
             .interface = storageInterfaceRemote,
         };
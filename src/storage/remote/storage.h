@@ -4,6 +4,7 @@ Remote Storage
 #ifndef STORAGE_REMOTE_STORAGE_H
 #define STORAGE_REMOTE_STORAGE_H
 
+#include "common/compress/helper.h"
 #include "protocol/client.h"
 #include "storage/storage.intern.h"
 
@@ -18,6 +19,6 @@ Constructors
 ***********************************************************************************************************************************/
 Storage *storageRemoteNew(
     mode_t modeFile, mode_t modePath, bool write, StoragePathExpressionCallback pathExpressionFunction, ProtocolClient *client,
-    unsigned int compressLevel);
+    CompressType compressType, unsigned int compressLevel);
 
 #endif
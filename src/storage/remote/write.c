@@ -26,6 +26,7 @@ typedef struct StorageWriteRemote
     StorageRemote *storage;                                         // Storage that created this object
     StorageWrite *write;                                            // Storage write interface
     ProtocolClient *client;                                         // Protocol client to make requests with
+    CompressType compressType;                                      // Protocol compression type
 
 #ifdef DEBUG
     uint64_t protocolWriteBytes;                                    // How many bytes were written to the protocol layer?
@@ -67,9 +68,21 @@ storageWriteRemoteOpen(THIS_VOID)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // If the file is compressible add decompression filter on the remote
-        if (this->interface.compressible)
-            ioFilterGroupInsert(ioWriteFilterGroup(storageWriteIo(this->write)), 0, decompressFilter(compressTypeGz));
+        IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(this->write));
+        const IoFilter *filterFirst = ioFilterGroupSize(filterGroup) == 0 ? NULL : ioFilterGroupFilter(filterGroup, 0);
+        IoFilter *compress = NULL;
+
+        // If the first filter would compress on the remote then run it locally instead so the compressed bytes are sent unchanged
+        if (filterFirst != NULL && compressFilterIs(filterFirst))
+        {
+            compress = ioFilterGroupRemove(filterGroup, 0);
+        }
+        // Else if the file is compressible add decompression filter on the remote, unless the input is already compressed
+        else if (this->interface.compressible && (filterFirst == NULL || !decompressFilterIs(filterFirst)))
+        {
+            ioFilterGroupInsert(filterGroup, 0, decompressFilter(this->compressType));
+            compress = compressFilter(this->compressType, (int)this->interface.compressLevel);
+        }
 
         ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_STORAGE_OPEN_WRITE_STR);
         protocolCommandParamAdd(command, VARSTR(this->interface.name));
@@ -82,20 +95,16 @@ storageWriteRemoteOpen(THIS_VOID)
         protocolCommandParamAdd(command, VARBOOL(this->interface.syncFile));
         protocolCommandParamAdd(command, VARBOOL(this->interface.syncPath));
         protocolCommandParamAdd(command, VARBOOL(this->interface.atomic));
-        protocolCommandParamAdd(command, ioFilterGroupParamAll(ioWriteFilterGroup(storageWriteIo(this->write))));
+        protocolCommandParamAdd(command, ioFilterGroupParamAll(filterGroup));
 
         protocolClientExecute(this->client, command, false);
 
         // Clear filters since they will be run on the remote side
-        ioFilterGroupClear(ioWriteFilterGroup(storageWriteIo(this->write)));
+        ioFilterGroupClear(filterGroup);
 
-        // If the file is compressible add compression filter locally
-        if (this->interface.compressible)
-        {
-            ioFilterGroupAdd(
-                ioWriteFilterGroup(storageWriteIo(this->write)),
-                compressFilter(compressTypeGz, (int)this->interface.compressLevel));
-        }
+        // Add compression filter locally
+        if (compress != NULL)
+            ioFilterGroupAdd(filterGroup, compress);
 
         // Set free callback to ensure remote file is freed
         memContextCallbackSet(this->memContext, storageWriteRemoteFreeResource, this);
@@ -165,7 +174,7 @@ StorageWrite *
 storageWriteRemoteNew(
     StorageRemote *storage, ProtocolClient *client, const String *name, mode_t modeFile, mode_t modePath, const String *user,
     const String *group, time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool compressible,
-    unsigned int compressLevel)
+    CompressType compressType, unsigned int compressLevel)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_REMOTE, storage);
@@ -180,6 +189,7 @@ storageWriteRemoteNew(
         FUNCTION_LOG_PARAM(BOOL, syncPath);
         FUNCTION_LOG_PARAM(BOOL, atomic);
         FUNCTION_LOG_PARAM(BOOL, compressible);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(UINT, compressLevel);
     FUNCTION_LOG_END();
 
@@ -200,6 +210,7 @@ storageWriteRemoteNew(
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
             .client = client,
+            .compressType = compressType,
 
             .interface = (StorageWriteInterface)
             {
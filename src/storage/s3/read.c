@@ -11,23 +11,57 @@ S3 Storage Read
 #include "common/io/read.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/type/convert.h"
+#include "common/type/list.h"
 #include "common/type/object.h"
 #include "storage/s3/read.h"
 #include "storage/read.intern.h"
 
+/***********************************************************************************************************************************
+S3 http headers
+***********************************************************************************************************************************/
+#define S3_HEADER_CONTENT_RANGE                                     "content-range"
+    STRING_STATIC(S3_HEADER_CONTENT_RANGE_STR,                      S3_HEADER_CONTENT_RANGE);
+#define S3_HEADER_IF_MATCH                                          "if-match"
+    STRING_STATIC(S3_HEADER_IF_MATCH_STR,                           S3_HEADER_IF_MATCH);
+#define S3_HEADER_RANGE                                             "range"
+    STRING_STATIC(S3_HEADER_RANGE_STR,                              S3_HEADER_RANGE);
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
 #define STORAGE_READ_S3_TYPE                                        StorageReadS3
 #define STORAGE_READ_S3_PREFIX                                      storageReadS3
 
+// Range of the file being downloaded on a separate connection
+typedef struct StorageReadS3Range
+{
+    MemContext *memContext;                                         // Mem context for the range
+    uint64_t size;                                                  // Expected size of the range
+    HttpHeader *header;                                             // Range and if-match headers
+    StorageS3RequestAsync request;                                  // Request for the range
+    Buffer *content;                                                // Content once the response has been read
+} StorageReadS3Range;
+
 typedef struct StorageReadS3
 {
     MemContext *memContext;                                         // Object mem context
     StorageReadInterface interface;                                 // Interface
     StorageS3 *storage;                                             // Storage that created this object
-
-    HttpClient *httpClient;                                         // Http client for requests
+    size_t rangeSize;                                               // Size of ranges when downloading in parallel
+    unsigned int downloadMax;                                       // Maximum ranges downloaded concurrently
+
+    HttpClient *httpClient;                                         // Http client for the streamed request
+    bool rangeFirst;                                                // Was only the first range of the file requested?
+    bool streamLimit;                                               // Is the amount read from the stream limited?
+    uint64_t streamRemains;                                         // Bytes remaining in the stream when limited
+
+    uint64_t size;                                                  // Size of the file when downloading ranges
+    const String *etag;                                             // ETag used to ensure the file does not change between ranges
+    uint64_t rangeNext;                                             // Offset of the next range to request
+    List *rangeList;                                                // Ranges in flight (oldest first)
+    StorageReadS3Range *range;                                      // Range currently being copied out
+    size_t rangeOffset;                                             // Offset in the current range content
 } StorageReadS3;
 
 /***********************************************************************************************************************************
@@ -39,14 +73,69 @@ Macros for function logging
     objToLog(value, "StorageReadS3", buffer, bufferSize)
 
 /***********************************************************************************************************************************
-Mark http client as done so it can be reused
+Mark http clients as done so they can be reused
 ***********************************************************************************************************************************/
 OBJECT_DEFINE_FREE_RESOURCE_BEGIN(STORAGE_READ_S3, LOG, logLevelTrace)
 {
-    httpClientDone(this->httpClient);
+    if (this->httpClient != NULL)
+        httpClientDone(this->httpClient);
+
+    // Abandon ranges that are still in flight
+    if (this->rangeList != NULL)
+    {
+        for (unsigned int rangeIdx = 0; rangeIdx < lstSize(this->rangeList); rangeIdx++)
+            httpClientDone((*(StorageReadS3Range **)lstGet(this->rangeList, rangeIdx))->request.httpClient);
+    }
 }
 OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
 
+/***********************************************************************************************************************************
+Request the next range of the file
+***********************************************************************************************************************************/
+static void
+storageReadS3RangeSend(StorageReadS3 *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_S3, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->rangeNext < this->size);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(this->rangeList))
+    {
+        MEM_CONTEXT_NEW_BEGIN("StorageReadS3Range")
+        {
+            StorageReadS3Range *range = memNew(sizeof(StorageReadS3Range));
+
+            *range = (StorageReadS3Range)
+            {
+                .memContext = MEM_CONTEXT_NEW(),
+                .size = this->size - this->rangeNext < this->rangeSize ? this->size - this->rangeNext : this->rangeSize,
+                .header = httpHeaderNew(NULL),
+            };
+
+            httpHeaderAdd(
+                range->header, S3_HEADER_RANGE_STR,
+                strNewFmt("bytes=%" PRIu64 "-%" PRIu64, this->rangeNext, this->rangeNext + range->size - 1));
+
+            // Make sure the file has not changed since the first request
+            if (this->etag != NULL)
+                httpHeaderAdd(range->header, S3_HEADER_IF_MATCH_STR, this->etag);
+
+            range->request = storageS3RequestAsync(
+                this->storage, HTTP_VERB_GET_STR, this->interface.name, NULL, range->header, NULL);
+
+            lstAdd(this->rangeList, &range);
+            this->rangeNext += range->size;
+        }
+        MEM_CONTEXT_NEW_END();
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -64,17 +153,108 @@ storageReadS3Open(THIS_VOID)
 
     bool result = false;
 
-    // Request the file
-    this->httpClient = storageS3Request(this->storage, HTTP_VERB_GET_STR, this->interface.name, NULL, NULL, false, true).httpClient;
-
-    if (httpClientResponseCodeOk(this->httpClient))
+    MEM_CONTEXT_TEMP_BEGIN()
     {
-        memContextCallbackSet(this->memContext, storageReadS3FreeResource, this);
-        result = true;
+        // If a range was requested then add the range header. A zero limit cannot be expressed as a range so no content is read.
+        uint64_t limit = this->interface.limit == NULL ? 0 : varUInt64(this->interface.limit);
+        HttpHeader *header = httpHeaderNew(NULL);
+
+        if (this->interface.offset != 0 || limit > 0)
+        {
+            httpHeaderAdd(
+                header, S3_HEADER_RANGE_STR,
+                limit > 0 ?
+                    strNewFmt("bytes=%" PRIu64 "-%" PRIu64, this->interface.offset, this->interface.offset + limit - 1) :
+                    strNewFmt("bytes=%" PRIu64 "-", this->interface.offset));
+        }
+        // Else if the entire file was requested and ranges may be downloaded in parallel then request only the first range. The
+        // size of the file is returned in the response so the remaining ranges can be requested. Requesting the entire file and
+        // abandoning the stream after the first range would close the connection.
+        else if (this->interface.limit == NULL && this->downloadMax > 1)
+        {
+            httpHeaderAdd(header, S3_HEADER_RANGE_STR, strNewFmt("bytes=0-%zu", this->rangeSize - 1));
+            this->rangeFirst = true;
+        }
+
+        // Request the file
+        StorageS3RequestResult response = storageS3Request(
+            this->storage, HTTP_VERB_GET_STR, this->interface.name, NULL, header, NULL, false, true);
+
+        this->httpClient = response.httpClient;
+
+        // If the range starts past the end of the file, e.g. the file is zero-length, then there is no content to read
+        if (httpClientResponseCode(this->httpClient) == HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE)
+        {
+            memContextCallbackSet(this->memContext, storageReadS3FreeResource, this);
+            result = true;
+
+            this->streamLimit = true;
+        }
+        else if (httpClientResponseCodeOk(this->httpClient))
+        {
+            memContextCallbackSet(this->memContext, storageReadS3FreeResource, this);
+            result = true;
+
+            // If the limit is zero then no content will be read
+            if (this->interface.limit != NULL && limit == 0)
+            {
+                this->streamLimit = true;
+            }
+            // Else if the first range was returned (the server may ignore the range and return the entire file) then get the size
+            // of the file from the content range, e.g. bytes 0-1023/4096. If the file is larger than the first range then download
+            // the remaining ranges in parallel.
+            else if (this->rangeFirst && httpClientResponseCode(this->httpClient) == HTTP_RESPONSE_CODE_PARTIAL_CONTENT)
+            {
+                const String *contentRange = httpHeaderGet(response.responseHeader, S3_HEADER_CONTENT_RANGE_STR);
+                int sizeIdx = contentRange == NULL ? -1 : strChr(contentRange, '/');
+
+                if (sizeIdx == -1)
+                {
+                    httpClientDone(this->httpClient);
+                    this->httpClient = NULL;
+
+                    THROW_FMT(
+                        FormatError, "'%s' header is missing or invalid in response for '%s'", S3_HEADER_CONTENT_RANGE,
+                        strPtr(this->interface.name));
+                }
+
+                uint64_t size = cvtZToUInt64(strPtr(strSub(contentRange, (size_t)sizeIdx + 1)));
+
+                if (size > this->rangeSize)
+                {
+                    // Only the first range is read from the stream
+                    this->streamLimit = true;
+                    this->streamRemains = this->rangeSize;
+                    this->rangeNext = this->rangeSize;
+                    this->size = size;
+
+                    MEM_CONTEXT_BEGIN(this->memContext)
+                    {
+                        this->etag = strDup(httpHeaderGet(response.responseHeader, HTTP_HEADER_ETAG_STR));
+                        this->rangeList = lstNew(sizeof(StorageReadS3Range *));
+                    }
+                    MEM_CONTEXT_END();
+
+                    // Request ranges while the first range is being read. One connection is in use by the stream.
+                    while (
+                        lstSize(this->rangeList) < storageS3ConcurrencyMax(this->storage, this->downloadMax) - 1 &&
+                        this->rangeNext < this->size)
+                        storageReadS3RangeSend(this);
+                }
+            }
+        }
+        // Else error unless ignore missing
+        else if (!this->interface.ignoreMissing)
+            THROW_FMT(FileMissingError, "unable to open '%s': No such file or directory", strPtr(this->interface.name));
+
+        // If nothing will be read from the stream then mark the client as done
+        if (result && this->streamLimit && this->streamRemains == 0)
+        {
+            httpClientDone(this->httpClient);
+            this->httpClient = NULL;
+        }
     }
-    // Else error unless ignore missing
-    else if (!this->interface.ignoreMissing)
-        THROW_FMT(FileMissingError, "unable to open '%s': No such file or directory", strPtr(this->interface.name));
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN(BOOL, result);
 }
@@ -93,11 +273,108 @@ storageReadS3(THIS_VOID, Buffer *buffer, bool block)
         FUNCTION_LOG_PARAM(BOOL, block);
     FUNCTION_LOG_END();
 
-    ASSERT(this != NULL && this->httpClient != NULL);
-    ASSERT(httpClientIoRead(this->httpClient) != NULL);
+    ASSERT(this != NULL);
     ASSERT(buffer != NULL && !bufFull(buffer));
 
-    FUNCTION_LOG_RETURN(SIZE, ioRead(httpClientIoRead(this->httpClient), buffer));
+    size_t result = bufUsed(buffer);
+
+    // Read from the stream
+    if (this->httpClient != NULL)
+    {
+        ASSERT(httpClientIoRead(this->httpClient) != NULL);
+
+        if (!this->streamLimit)
+            ioRead(httpClientIoRead(this->httpClient), buffer);
+        else
+        {
+            // Limit the read to the bytes remaining in the stream
+            size_t used = bufUsed(buffer);
+
+            if (bufRemains(buffer) > this->streamRemains)
+                bufLimitSet(buffer, used + (size_t)this->streamRemains);
+
+            ioRead(httpClientIoRead(this->httpClient), buffer);
+            bufLimitClear(buffer);
+
+            this->streamRemains -= bufUsed(buffer) - used;
+
+            if (this->streamRemains > 0 && ioReadEof(httpClientIoRead(this->httpClient)))
+                THROW_FMT(FileReadError, "unexpected eof while reading '%s'", strPtr(this->interface.name));
+
+            // Abandon the rest of the stream once all required bytes have been read
+            if (this->streamRemains == 0)
+            {
+                httpClientDone(this->httpClient);
+                this->httpClient = NULL;
+            }
+        }
+    }
+
+    // Copy from ranges once the stream is complete
+    if (this->httpClient == NULL && this->rangeList != NULL)
+    {
+        while (!bufFull(buffer))
+        {
+            // Get the next range when the current range has been copied
+            if (this->range == NULL || this->rangeOffset == this->range->size)
+            {
+                if (this->range != NULL)
+                {
+                    memContextFree(this->range->memContext);
+                    this->range = NULL;
+                }
+
+                // Request the next range if none are in flight, e.g. because requests were throttled when the stream was opened
+                if (lstSize(this->rangeList) == 0)
+                {
+                    if (this->rangeNext == this->size)
+                        break;
+
+                    storageReadS3RangeSend(this);
+                }
+
+                this->range = *(StorageReadS3Range **)lstGet(this->rangeList, 0);
+                this->rangeOffset = 0;
+
+                MEM_CONTEXT_BEGIN(this->range->memContext)
+                {
+                    StorageS3RequestResult response = storageS3Response(&this->range->request, true, false);
+
+                    if (bufUsed(response.response) != this->range->size)
+                    {
+                        THROW_FMT(
+                            FileReadError, "expected %" PRIu64 " bytes in range of '%s' but got %zu", this->range->size,
+                            strPtr(this->interface.name), bufUsed(response.response));
+                    }
+
+                    this->range->content = response.response;
+                }
+                MEM_CONTEXT_END();
+
+                lstRemoveIdx(this->rangeList, 0);
+
+                // Keep the maximum number of ranges in flight. The maximum may be lower than downloadMax while requests are being
+                // throttled.
+                while (
+                    this->rangeNext < this->size &&
+                    lstSize(this->rangeList) < storageS3ConcurrencyMax(this->storage, this->downloadMax))
+                {
+                    storageReadS3RangeSend(this);
+                }
+            }
+
+            // Copy as much of the range as will fit
+            size_t copySize = (size_t)this->range->size - this->rangeOffset;
+
+            if (copySize > bufRemains(buffer))
+                copySize = bufRemains(buffer);
+
+            bufCatSub(buffer, this->range->content, this->rangeOffset, copySize);
+            this->rangeOffset += copySize;
+        }
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, bufUsed(buffer) - result);
 }
 
 /***********************************************************************************************************************************
@@ -113,12 +390,18 @@ storageReadS3Close(THIS_VOID)
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(this->httpClient != NULL);
 
     memContextCallbackClear(this->memContext);
     storageReadS3FreeResource(this);
     this->httpClient = NULL;
 
+    if (this->rangeList != NULL)
+    {
+        lstFree(this->rangeList);
+        this->rangeList = NULL;
+        this->range = NULL;
+    }
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -134,24 +417,41 @@ storageReadS3Eof(THIS_VOID)
         FUNCTION_TEST_PARAM(STORAGE_READ_S3, this);
     FUNCTION_TEST_END();
 
-    ASSERT(this != NULL && this->httpClient != NULL);
-    ASSERT(httpClientIoRead(this->httpClient) != NULL);
+    ASSERT(this != NULL);
+
+    // If the stream is still being read then check it for eof
+    if (this->httpClient != NULL)
+    {
+        ASSERT(httpClientIoRead(this->httpClient) != NULL);
+        FUNCTION_TEST_RETURN(!this->streamLimit && ioReadEof(httpClientIoRead(this->httpClient)));
+    }
 
-    FUNCTION_TEST_RETURN(ioReadEof(httpClientIoRead(this->httpClient)));
+    // Else eof when all ranges have been copied
+    FUNCTION_TEST_RETURN(
+        this->rangeList == NULL ||
+        (lstSize(this->rangeList) == 0 && (this->range == NULL || this->rangeOffset == this->range->size)));
 }
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadS3New(StorageS3 *storage, const String *name, bool ignoreMissing)
+storageReadS3New(
+    StorageS3 *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit, size_t rangeSize,
+    unsigned int downloadMax)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_S3, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(SIZE, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, downloadMax);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(rangeSize > 0);
+    ASSERT(downloadMax > 0);
 
     StorageRead *this = NULL;
 
@@ -163,12 +463,16 @@ storageReadS3New(StorageS3 *storage, const String *name, bool ignoreMissing)
         {
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
+            .rangeSize = rangeSize,
+            .downloadMax = downloadMax,
 
             .interface = (StorageReadInterface)
             {
                 .type = STORAGE_S3_TYPE_STR,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
@@ -10,6 +10,9 @@ S3 Storage
 #include "common/debug.h"
 #include "common/io/http/cache.h"
 #include "common/io/http/common.h"
+#include "common/io/io.h"
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
@@ -28,6 +31,8 @@ STRING_EXTERN(STORAGE_S3_TYPE_STR,                                  STORAGE_S3_T
 S3 http headers
 ***********************************************************************************************************************************/
 STRING_STATIC(S3_HEADER_CONTENT_SHA256_STR,                         "x-amz-content-sha256");
+STRING_STATIC(S3_HEADER_COPY_SOURCE_STR,                            "x-amz-copy-source");
+STRING_STATIC(S3_HEADER_COPY_SOURCE_RANGE_STR,                      "x-amz-copy-source-range");
 STRING_STATIC(S3_HEADER_DATE_STR,                                   "x-amz-date");
 STRING_STATIC(S3_HEADER_TOKEN_STR,                                  "x-amz-security-token");
 
@@ -42,6 +47,10 @@ STRING_STATIC(S3_QUERY_PREFIX_STR,                                  "prefix");
 
 STRING_STATIC(S3_QUERY_VALUE_LIST_TYPE_2_STR,                       "2");
 
+STRING_EXTERN(S3_QUERY_PART_NUMBER_STR,                             S3_QUERY_PART_NUMBER);
+STRING_EXTERN(S3_QUERY_UPLOADS_STR,                                 S3_QUERY_UPLOADS);
+STRING_EXTERN(S3_QUERY_UPLOAD_ID_STR,                               S3_QUERY_UPLOAD_ID);
+
 /***********************************************************************************************************************************
 S3 errors
 ***********************************************************************************************************************************/
@@ -64,6 +73,17 @@ STRING_STATIC(S3_XML_TAG_PREFIX_STR,                                "Prefix");
 STRING_STATIC(S3_XML_TAG_QUIET_STR,                                 "Quiet");
 STRING_STATIC(S3_XML_TAG_SIZE_STR,                                  "Size");
 
+STRING_EXTERN(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR,             S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD);
+STRING_EXTERN(S3_XML_TAG_ETAG_STR,                                  S3_XML_TAG_ETAG);
+STRING_EXTERN(S3_XML_TAG_PART_STR,                                  S3_XML_TAG_PART);
+STRING_EXTERN(S3_XML_TAG_PART_NUMBER_STR,                           S3_XML_TAG_PART_NUMBER);
+STRING_EXTERN(S3_XML_TAG_UPLOAD_ID_STR,                             S3_XML_TAG_UPLOAD_ID);
+
+/***********************************************************************************************************************************
+Largest object that can be copied with a single request. Larger objects are copied in parts of this size.
+***********************************************************************************************************************************/
+#define S3_COPY_SIZE_MAX                                            ((uint64_t)5 * 1024 * 1024 * 1024)
+
 /***********************************************************************************************************************************
 AWS authentication v4 constants
 ***********************************************************************************************************************************/
@@ -73,6 +93,8 @@ AWS authentication v4 constants
 #define AWS4_REQUEST                                                "aws4_request"
     BUFFER_STRDEF_STATIC(AWS4_REQUEST_BUF,                          AWS4_REQUEST);
 #define AWS4_HMAC_SHA256                                            "AWS4-HMAC-SHA256"
+#define S3_UNSIGNED_PAYLOAD                                         "UNSIGNED-PAYLOAD"
+    STRING_STATIC(S3_UNSIGNED_PAYLOAD_STR,                          S3_UNSIGNED_PAYLOAD);
 
 /***********************************************************************************************************************************
 Starting date for signing string so it will be regenerated on the first request
@@ -95,10 +117,19 @@ struct StorageS3
     const String *secretAccessKey;                                  // Secret access key
     const String *securityToken;                                    // Security token, if any
     size_t partSize;                                                // Part size for multi-part upload
+    unsigned int uploadMax;                                         // Maximum parts uploaded concurrently for multi-part upload
+    unsigned int downloadMax;                                       // Maximum ranges downloaded concurrently
+    unsigned int listMax;                                           // Maximum list requests in flight for recursive lists
     unsigned int deleteMax;                                         // Maximum objects that can be deleted in one request
+    unsigned int concurrencyMax;                                    // Largest of uploadMax, downloadMax, and listMax
+    unsigned int concurrencyLimit;                                  // Current limit on requests in flight (adapts to throttling)
+    unsigned int concurrencySuccess;                                // Requests not throttled since the limit was last changed
+    uint64_t requestTotal;                                          // Requests sent
+    uint64_t requestThrottle;                                       // Requests sent when the limit was last reduced
     StorageS3UriStyle uriStyle;                                     // Path or host style URIs
     const String *bucketEndpoint;                                   // Set to {bucket}.{endpoint}
     unsigned int port;                                              // Host port
+    bool tls;                                                       // Are requests sent over TLS?
 
     // Current signing key and date it is valid for
     const String *signingKeyDate;                                   // Date of cached signing key (so we know when to regenerate)
@@ -232,71 +263,205 @@ storageS3Auth(
 }
 
 /***********************************************************************************************************************************
-Process S3 request
+Sign and send an S3 request
 ***********************************************************************************************************************************/
-StorageS3RequestResult
-storageS3Request(
-    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const Buffer *body, bool returnContent,
-    bool allowMissing)
+static void
+storageS3RequestSend(StorageS3RequestAsync *request)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(STORAGE_S3_REQUEST_ASYNC, request);
+    FUNCTION_LOG_END();
+
+    ASSERT(request != NULL);
+
+    StorageS3 *this = request->storage;
+
+    // Number the request so throttling of requests sent before the concurrency limit was reduced can be ignored
+    this->requestTotal++;
+    request->requestId = this->requestTotal;
+
+    // Free headers from a prior attempt
+    if (request->requestHeader != NULL)
+        httpHeaderFree(request->requestHeader);
+
+    // Create header list from the headers passed by the caller (if any)
+    MEM_CONTEXT_BEGIN(request->memContext)
+    {
+        request->requestHeader =
+            request->header == NULL ?
+                httpHeaderNew(this->headerRedactList) : httpHeaderDup(request->header, this->headerRedactList);
+    }
+    MEM_CONTEXT_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const Buffer *body = request->body;
+
+        // Set content length
+        httpHeaderAdd(
+            request->requestHeader, HTTP_HEADER_CONTENT_LENGTH_STR,
+            body == NULL || bufUsed(body) == 0 ? ZERO_STR : strNewFmt("%zu", bufUsed(body)));
+
+        // Calculate content-md5 header if there is content and the caller did not already calculate it
+        if (body != NULL && httpHeaderGet(request->requestHeader, HTTP_HEADER_CONTENT_MD5_STR) == NULL)
+        {
+            char md5Hash[HASH_TYPE_MD5_SIZE_HEX];
+            encodeToStr(encodeBase64, bufPtr(cryptoHashOne(HASH_TYPE_MD5_STR, body)), HASH_TYPE_M5_SIZE, md5Hash);
+            httpHeaderAdd(request->requestHeader, HTTP_HEADER_CONTENT_MD5_STR, STR(md5Hash));
+        }
+
+        // Generate authorization header. Over TLS the content is not included in the signature since that would require an extra
+        // pass over the content -- TLS protects the content in transit. Content-md5 is signed but only detects corruption, since
+        // anyone who can modify the content can also recalculate it, so the content is signed when TLS is disabled.
+        const String *payloadHash = HASH_TYPE_SHA256_ZERO_STR;
+
+        if (body != NULL && bufUsed(body) > 0)
+            payloadHash = this->tls ? S3_UNSIGNED_PAYLOAD_STR : bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR, body));
+
+        storageS3Auth(
+            this, request->verb, httpUriEncode(request->uri, true), request->query, storageS3DateTime(time(NULL)),
+            request->requestHeader, payloadHash);
+
+        // Send the request on a client that is not busy
+        request->httpClient = httpClientCacheGet(this->httpClientCache);
+        httpClientRequestAsync(
+            request->httpClient, request->verb, request->uri, request->query, request->requestHeader, request->body);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+StorageS3RequestAsync
+storageS3RequestAsync(
+    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *header, const Buffer *body)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STORAGE_S3, this);
         FUNCTION_LOG_PARAM(STRING, verb);
         FUNCTION_LOG_PARAM(STRING, uri);
         FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, header);
         FUNCTION_LOG_PARAM(BUFFER, body);
-        FUNCTION_LOG_PARAM(BOOL, returnContent);
-        FUNCTION_LOG_PARAM(BOOL, allowMissing);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(verb != NULL);
     ASSERT(uri != NULL);
 
+    StorageS3RequestAsync result =
+    {
+        .memContext = memContextCurrent(),
+        .storage = this,
+        .verb = verb,
+        // When using path-style URIs the bucket name needs to be prepended
+        .uri = this->uriStyle == storageS3UriStylePath ? strNewFmt("/%s%s", strPtr(this->bucket), strPtr(uri)) : uri,
+        .query = query,
+        .header = header,
+        .body = body,
+    };
+
+    storageS3RequestSend(&result);
+
+    FUNCTION_LOG_RETURN(STORAGE_S3_REQUEST_ASYNC, result);
+}
+
+/***********************************************************************************************************************************
+Adapt the concurrency limit to throttling
+
+Requests that required retries (usually because the server responded with 503 Slow Down) halve the limit and requests that did not
+raise the limit by one after a limit's worth of them have completed. This is additive increase/multiplicative decrease (AIMD) so the
+limit settles near the rate the server can sustain. Throttling of requests sent before the limit was last reduced is ignored since
+those requests were sent at the old rate and the limit has already been reduced in response.
+***********************************************************************************************************************************/
+static void
+storageS3ConcurrencyUpdate(StorageS3RequestAsync *request, bool throttled)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(STORAGE_S3_REQUEST_ASYNC, request);
+        FUNCTION_TEST_PARAM(BOOL, throttled);
+    FUNCTION_TEST_END();
+
+    ASSERT(request != NULL);
+
+    StorageS3 *this = request->storage;
+
+    if (throttled)
+    {
+        if (request->requestId > this->requestThrottle)
+        {
+            this->concurrencyLimit = this->concurrencyLimit > 1 ? this->concurrencyLimit / 2 : 1;
+            this->concurrencySuccess = 0;
+            this->requestThrottle = this->requestTotal;
+
+            LOG_DETAIL_FMT("requests throttled, reducing S3 concurrency to %u", this->concurrencyLimit);
+        }
+    }
+    else if (this->concurrencyLimit < this->concurrencyMax)
+    {
+        this->concurrencySuccess++;
+
+        if (this->concurrencySuccess >= this->concurrencyLimit)
+        {
+            this->concurrencyLimit++;
+            this->concurrencySuccess = 0;
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+storageS3ConcurrencyMax(const StorageS3 *this, unsigned int max)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_S3, this);
+        FUNCTION_TEST_PARAM(UINT, max);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(max > 0);
+
+    FUNCTION_TEST_RETURN(max < this->concurrencyLimit ? max : this->concurrencyLimit);
+}
+
+/**********************************************************************************************************************************/
+StorageS3RequestResult
+storageS3Response(StorageS3RequestAsync *request, bool returnContent, bool allowMissing)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(STORAGE_S3_REQUEST_ASYNC, request);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+    FUNCTION_LOG_END();
+
+    ASSERT(request != NULL);
+    ASSERT(request->httpClient != NULL);
+
     StorageS3RequestResult result = {0};
     unsigned int retryRemaining = 2;
     bool done;
 
-    // When using path-style URIs the bucket name needs to be prepended
-    if (this->uriStyle == storageS3UriStylePath)
-        uri = strNewFmt("/%s%s", strPtr(this->bucket), strPtr(uri));
-
     do
     {
         done = true;
 
         MEM_CONTEXT_TEMP_BEGIN()
         {
-            // Create header list and add content length
-            HttpHeader *requestHeader = httpHeaderNew(this->headerRedactList);
+            HttpClient *httpClient = request->httpClient;
 
-            // Set content length
-            httpHeaderAdd(
-                requestHeader, HTTP_HEADER_CONTENT_LENGTH_STR,
-                body == NULL || bufUsed(body) == 0 ? ZERO_STR : strNewFmt("%zu", bufUsed(body)));
+            // Read the response
+            Buffer *response = httpClientResponse(httpClient, returnContent);
+            storageS3ConcurrencyUpdate(request, httpClientRequestRetry(httpClient) > 0);
 
-            // Calculate content-md5 header if there is content
-            if (body != NULL)
-            {
-                char md5Hash[HASH_TYPE_MD5_SIZE_HEX];
-                encodeToStr(encodeBase64, bufPtr(cryptoHashOne(HASH_TYPE_MD5_STR, body)), HASH_TYPE_M5_SIZE, md5Hash);
-                httpHeaderAdd(requestHeader, HTTP_HEADER_CONTENT_MD5_STR, STR(md5Hash));
-            }
-
-            // Generate authorization header
-            storageS3Auth(
-                this, verb, httpUriEncode(uri, true), query, storageS3DateTime(time(NULL)), requestHeader,
-                body == NULL || bufUsed(body) == 0 ? HASH_TYPE_SHA256_ZERO_STR : bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR, body)));
-
-            // Get an http client
-            HttpClient *httpClient = httpClientCacheGet(this->httpClientCache);
-
-            // Process request
-            Buffer *response = httpClientRequest(httpClient, verb, uri, query, requestHeader, body, returnContent);
-
-            // Error if the request was not successful
+            // Error if the request was not successful. When missing files are allowed a range that is not satisfiable is also
+            // returned to the caller since it means the file is shorter than the range, e.g. a zero-length file.
             if (!httpClientResponseCodeOk(httpClient) &&
-                (!allowMissing || httpClientResponseCode(httpClient) != HTTP_RESPONSE_CODE_NOT_FOUND))
+                (!allowMissing ||
+                 (httpClientResponseCode(httpClient) != HTTP_RESPONSE_CODE_NOT_FOUND &&
+                  httpClientResponseCode(httpClient) != HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE)))
             {
                 // If there are retries remaining and a response parse it as XML to extract the S3 error code
                 if (response != NULL && retryRemaining > 0)
@@ -335,12 +500,13 @@ storageS3Request(
                     // Output uri/query
                     strCat(error, "\n*** URI/Query ***:");
 
-                    strCatFmt(error, "\n%s", strPtr(httpUriEncode(uri, true)));
+                    strCatFmt(error, "\n%s", strPtr(httpUriEncode(request->uri, true)));
 
-                    if (query != NULL)
-                        strCatFmt(error, "?%s", strPtr(httpQueryRender(query)));
+                    if (request->query != NULL)
+                        strCatFmt(error, "?%s", strPtr(httpQueryRender(request->query)));
 
                     // Output request headers
+                    const HttpHeader *requestHeader = request->requestHeader;
                     const StringList *requestHeaderList = httpHeaderList(requestHeader);
 
                     strCat(error, "\n*** Request Headers ***:");
@@ -386,22 +552,358 @@ storageS3Request(
                     httpHeaderDup(httpClientResponseHeader(httpClient), NULL), memContextPrior());
                 result.response = bufMove(response, memContextPrior());
             }
-
         }
         MEM_CONTEXT_TEMP_END();
+
+        // Sign and send the request again when retrying
+        if (!done)
+            storageS3RequestSend(request);
     }
     while (!done);
 
     FUNCTION_LOG_RETURN(STORAGE_S3_REQUEST_RESULT, result);
 }
 
+/***********************************************************************************************************************************
+Process S3 request
+***********************************************************************************************************************************/
+StorageS3RequestResult
+storageS3Request(
+    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *header, const Buffer *body,
+    bool returnContent, bool allowMissing)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, header);
+        FUNCTION_LOG_PARAM(BUFFER, body);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+
+    StorageS3RequestResult result = {0};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StorageS3RequestAsync request = storageS3RequestAsync(this, verb, uri, query, header, body);
+        result = storageS3Response(&request, returnContent, allowMissing);
+
+        // Move the response to the calling context
+        httpHeaderMove(result.responseHeader, memContextPrior());
+        bufMove(result.response, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_S3_REQUEST_RESULT, result);
+}
+
 /***********************************************************************************************************************************
 General function for listing files to be used by other list routines
 ***********************************************************************************************************************************/
+typedef void StorageS3ListCallback(
+    StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlStreamElement *xml);
+
+// Parse the xml content of a response as it is read rather than reading all the content first. Nothing is parsed when there is no
+// content. The client is done before the last part is parsed so requests made from the callback can reuse it, and is always done
+// when this function returns, even on error.
+static void
+storageS3ResponseXml(HttpClient *httpClient, XmlStreamCallback *callback, void *callbackData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(HTTP_CLIENT, httpClient);
+        FUNCTION_TEST_PARAM(FUNCTIONP, callback);
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+    FUNCTION_TEST_END();
+
+    ASSERT(httpClient != NULL);
+    ASSERT(callback != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        volatile bool done = false;                                 // Is the client done? Must be preserved even on error.
+
+        TRY_BEGIN()
+        {
+            IoRead *read = httpClientIoRead(httpClient);
+            XmlStream *xml = NULL;
+            Buffer *buffer = bufNew(ioBufferSize());
+
+            do
+            {
+                bufUsedZero(buffer);
+                ioRead(read, buffer);
+
+                if (ioReadEof(read))
+                {
+                    httpClientDone(httpClient);
+                    done = true;
+                }
+
+                if (bufUsed(buffer) > 0)
+                {
+                    if (xml == NULL)
+                        xml = xmlStreamNew(callback, callbackData);
+
+                    xmlStreamPush(xml, buffer);
+                }
+            }
+            while (!done);
+
+            if (xml != NULL)
+                xmlStreamEnd(xml);
+        }
+        FINALLY()
+        {
+            if (!done)
+                httpClientDone(httpClient);
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Build the query for a page of a list
+static HttpQuery *
+storageS3ListQuery(const String *queryPrefix, bool recurse, const String *continuationToken)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, queryPrefix);
+        FUNCTION_TEST_PARAM(BOOL, recurse);
+        FUNCTION_TEST_PARAM(STRING, continuationToken);
+    FUNCTION_TEST_END();
+
+    ASSERT(queryPrefix != NULL);
+
+    HttpQuery *result = httpQueryNew();
+
+    // Add continuation token from the prior page if any
+    if (continuationToken != NULL)
+        httpQueryAdd(result, S3_QUERY_CONTINUATION_TOKEN_STR, continuationToken);
+
+    // Add the delimiter to not recurse
+    if (!recurse)
+        httpQueryAdd(result, S3_QUERY_DELIMITER_STR, FSLASH_STR);
+
+    // Use list type 2
+    httpQueryAdd(result, S3_QUERY_LIST_TYPE_STR, S3_QUERY_VALUE_LIST_TYPE_2_STR);
+
+    // Don't specified empty prefix because it is the default
+    if (!strEmpty(queryPrefix))
+        httpQueryAdd(result, S3_QUERY_PREFIX_STR, queryPrefix);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Process each element of a page of a list as it is parsed
+typedef struct StorageS3ListPageData
+{
+    StorageS3 *storage;                                             // Storage being listed
+    MemContext *memContext;                                         // Mem context for the continuation token
+    const String *basePrefix;                                       // Prefix to strip from names
+    StringList *prefixList;                                         // Add subpaths to this list instead of the callback
+    StorageS3ListCallback *callback;                                // Callback for each file and subpath
+    void *callbackData;                                             // User data for callback
+    const String *continuationToken;                                // Token to get the next page, if any
+} StorageS3ListPageData;
+
+static void
+storageS3ListPageCallback(void *callbackData, const XmlStreamElement *element)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+        FUNCTION_TEST_PARAM(XML_STREAM_ELEMENT, element);
+    FUNCTION_TEST_END();
+
+    ASSERT(callbackData != NULL);
+    ASSERT(element != NULL);
+
+    StorageS3ListPageData *data = callbackData;
+    const String *name = xmlStreamElementName(element);
+
+    // Subpath
+    if (strEq(name, S3_XML_TAG_COMMON_PREFIXES_STR))
+    {
+        // Get subpath name
+        const String *subPath = xmlStreamElementChild(element, S3_XML_TAG_PREFIX_STR, true);
+
+        // Add the full subpath to the prefix list
+        if (data->prefixList != NULL)
+        {
+            strLstAdd(data->prefixList, subPath);
+        }
+        else
+        {
+            // Strip off base prefix and final /
+            subPath = strSubN(subPath, strSize(data->basePrefix), strSize(subPath) - strSize(data->basePrefix) - 1);
+
+            // Add to list
+            data->callback(data->storage, data->callbackData, subPath, storageTypePath, element);
+        }
+    }
+    // File
+    else if (strEq(name, S3_XML_TAG_CONTENTS_STR))
+    {
+        // Get file name
+        const String *file = xmlStreamElementChild(element, S3_XML_TAG_KEY_STR, true);
+
+        // Strip off the base prefix when present
+        file = strEmpty(data->basePrefix) ? file : strSub(file, strSize(data->basePrefix));
+
+        // Add to list
+        data->callback(data->storage, data->callbackData, file, storageTypeFile, element);
+    }
+    // Continuation token
+    else if (strEq(name, S3_XML_TAG_NEXT_CONTINUATION_TOKEN_STR))
+    {
+        MEM_CONTEXT_BEGIN(data->memContext)
+        {
+            data->continuationToken = strDup(xmlStreamElementContent(element));
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Process a page of a list as it is read and return the continuation token, if any. When prefixList is not NULL subpaths are added
+// to the list instead of being passed to the callback.
+static const String *
+storageS3ListPage(
+    StorageS3 *this, HttpClient *httpClient, const String *basePrefix, StringList *prefixList,
+    StorageS3ListCallback *callback, void *callbackData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_S3, this);
+        FUNCTION_TEST_PARAM(HTTP_CLIENT, httpClient);
+        FUNCTION_TEST_PARAM(STRING, basePrefix);
+        FUNCTION_TEST_PARAM(STRING_LIST, prefixList);
+        FUNCTION_TEST_PARAM(FUNCTIONP, callback);
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(httpClient != NULL);
+    ASSERT(basePrefix != NULL);
+    ASSERT(callback != NULL);
+
+    StorageS3ListPageData data =
+    {
+        .storage = this,
+        .memContext = memContextCurrent(),
+        .basePrefix = basePrefix,
+        .prefixList = prefixList,
+        .callback = callback,
+        .callbackData = callbackData,
+    };
+
+    storageS3ResponseXml(httpClient, storageS3ListPageCallback, &data);
+
+    FUNCTION_TEST_RETURN(data.continuationToken);
+}
+
+// List a prefix one page at a time. When prefixList is not NULL subpaths are added to the list instead of being passed to the
+// callback.
+static void
+storageS3ListPrefix(
+    StorageS3 *this, const String *queryPrefix, const String *basePrefix, bool recurse, StringList *prefixList,
+    StorageS3ListCallback *callback, void *callbackData)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, queryPrefix);
+        FUNCTION_LOG_PARAM(STRING, basePrefix);
+        FUNCTION_LOG_PARAM(BOOL, recurse);
+        FUNCTION_LOG_PARAM(STRING_LIST, prefixList);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *continuationToken = NULL;
+
+        // Loop as long as a continuation token returned
+        do
+        {
+            // Use an inner mem context here because we could potentially be retrieving millions of files so it is a good idea to
+            // free memory at regular intervals
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                const String *nextToken = storageS3ListPage(
+                    this,
+                    storageS3Request(
+                        this, HTTP_VERB_GET_STR, FSLASH_STR, storageS3ListQuery(queryPrefix, recurse, continuationToken), NULL,
+                        NULL, false, false).httpClient,
+                    basePrefix, prefixList, callback, callbackData);
+
+                // Store the continuation token in the outer temp context
+                MEM_CONTEXT_PRIOR_BEGIN()
+                {
+                    continuationToken = strDup(nextToken);
+                }
+                MEM_CONTEXT_PRIOR_END();
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+        while (continuationToken != NULL);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// List request for a page of a prefix that is in flight
+typedef struct StorageS3ListShard
+{
+    MemContext *memContext;                                         // Mem context for the request
+    const String *prefix;                                           // Prefix being listed
+    StorageS3RequestAsync request;                                  // Request for the page
+} StorageS3ListShard;
+
+static void
+storageS3ListShardSend(StorageS3 *this, List *shardList, const String *prefix, const String *continuationToken)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(LIST, shardList);
+        FUNCTION_LOG_PARAM(STRING, prefix);
+        FUNCTION_LOG_PARAM(STRING, continuationToken);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(shardList != NULL);
+    ASSERT(prefix != NULL);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(shardList))
+    {
+        MEM_CONTEXT_NEW_BEGIN("StorageS3ListShard")
+        {
+            StorageS3ListShard *shard = memNew(sizeof(StorageS3ListShard));
+            *shard = (StorageS3ListShard){.memContext = MEM_CONTEXT_NEW(), .prefix = strDup(prefix)};
+
+            shard->request = storageS3RequestAsync(
+                this, HTTP_VERB_GET_STR, FSLASH_STR, storageS3ListQuery(shard->prefix, true, continuationToken), NULL, NULL);
+
+            lstAdd(shardList, &shard);
+        }
+        MEM_CONTEXT_NEW_END();
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 static void
 storageS3ListInternal(
-    StorageS3 *this, const String *path, const String *expression, bool recurse,
-    void (*callback)(StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlNode *xml),
+    StorageS3 *this, const String *path, const String *expression, bool recurse, StorageS3ListCallback *callback,
     void *callbackData)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
@@ -418,8 +920,6 @@ storageS3ListInternal(
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        const String *continuationToken = NULL;
-
         // Build the base prefix by stripping off the initial /
         const String *basePrefix;
 
@@ -444,78 +944,164 @@ storageS3ListInternal(
                 queryPrefix = strNewFmt("%s%s", strPtr(basePrefix), strPtr(expressionPrefix));
         }
 
-        // Loop as long as a continuation token returned
-        do
+        // List with one request at a time when not recursing or only one list request is allowed in flight
+        if (!recurse || this->listMax == 1)
         {
-            // Use an inner mem context here because we could potentially be retrieving millions of files so it is a good idea to
-            // free memory at regular intervals
-            MEM_CONTEXT_TEMP_BEGIN()
+            storageS3ListPrefix(this, queryPrefix, basePrefix, recurse, NULL, callback, callbackData);
+        }
+        // Else shard the list by the prefixes directly below the query prefix and list the prefixes concurrently. Files directly
+        // below the query prefix are reported while the prefixes are found. Pages of each prefix are reported in order but pages
+        // of different prefixes may be interleaved.
+        else
+        {
+            StringList *prefixList = strLstNew();
+            storageS3ListPrefix(this, queryPrefix, basePrefix, false, prefixList, callback, callbackData);
+
+            List *shardList = lstNew(sizeof(StorageS3ListShard *));
+            unsigned int prefixIdx = 0;
+
+            while (prefixIdx < strLstSize(prefixList) || lstSize(shardList) > 0)
             {
-                HttpQuery *query = httpQueryNew();
+                // Keep the maximum list requests in flight (fewer while requests are being throttled)
+                while (prefixIdx < strLstSize(prefixList) && lstSize(shardList) < storageS3ConcurrencyMax(this, this->listMax))
+                {
+                    storageS3ListShardSend(this, shardList, strLstGet(prefixList, prefixIdx), NULL);
+                    prefixIdx++;
+                }
 
-                // Add continuation token from the prior loop if any
-                if (continuationToken != NULL)
-                    httpQueryAdd(query, S3_QUERY_CONTINUATION_TOKEN_STR, continuationToken);
+                // Process the oldest page and request the next page of the prefix, if any
+                StorageS3ListShard *shard = *(StorageS3ListShard **)lstGet(shardList, 0);
+                lstRemoveIdx(shardList, 0);
 
-                // Add the delimiter to not recurse
-                if (!recurse)
-                    httpQueryAdd(query, S3_QUERY_DELIMITER_STR, FSLASH_STR);
+                MEM_CONTEXT_BEGIN(shard->memContext)
+                {
+                    const String *continuationToken = storageS3ListPage(
+                        this, storageS3Response(&shard->request, false, false).httpClient, basePrefix, NULL, callback,
+                        callbackData);
 
-                // Use list type 2
-                httpQueryAdd(query, S3_QUERY_LIST_TYPE_STR, S3_QUERY_VALUE_LIST_TYPE_2_STR);
+                    if (continuationToken != NULL)
+                        storageS3ListShardSend(this, shardList, shard->prefix, continuationToken);
+                }
+                MEM_CONTEXT_END();
 
-                // Don't specified empty prefix because it is the default
-                if (!strEmpty(queryPrefix))
-                    httpQueryAdd(query, S3_QUERY_PREFIX_STR, queryPrefix);
+                memContextFree(shard->memContext);
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
 
-                XmlNode *xmlRoot = xmlDocumentRoot(
-                    xmlDocumentNewBuf(
-                        storageS3Request(this, HTTP_VERB_GET_STR, FSLASH_STR, query, NULL, true, false).response));
+    FUNCTION_LOG_RETURN_VOID();
+}
 
-                // Get subpath list
-                XmlNodeList *subPathList = xmlNodeChildList(xmlRoot, S3_XML_TAG_COMMON_PREFIXES_STR);
+/**********************************************************************************************************************************/
+// Helper to check the result of a copy request. S3 can return 200 and then report an error in the content because the response is
+// started before the copy is complete.
+static XmlNode *
+storageS3CopyResult(const Buffer *response)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, response);
+    FUNCTION_TEST_END();
 
-                for (unsigned int subPathIdx = 0; subPathIdx < xmlNodeLstSize(subPathList); subPathIdx++)
-                {
-                    const XmlNode *subPathNode = xmlNodeLstGet(subPathList, subPathIdx);
+    ASSERT(response != NULL);
 
-                    // Get subpath name
-                    const String *subPath = xmlNodeContent(xmlNodeChild(subPathNode, S3_XML_TAG_PREFIX_STR, true));
+    XmlNode *result = xmlDocumentRoot(xmlDocumentNewBuf(response));
+    const XmlNode *code = xmlNodeChild(result, S3_XML_TAG_CODE_STR, false);
 
-                    // Strip off base prefix and final /
-                    subPath = strSubN(subPath, strSize(basePrefix), strSize(subPath) - strSize(basePrefix) - 1);
+    if (code != NULL)
+    {
+        THROW_FMT(
+            ProtocolError, "S3 copy failed with %s: %s", strPtr(xmlNodeContent(code)),
+            strPtr(xmlNodeContent(xmlNodeChild(result, S3_XML_TAG_MESSAGE_STR, true))));
+    }
 
-                    // Add to list
-                    callback(this, callbackData, subPath, storageTypePath, subPathNode);
-                }
+    FUNCTION_TEST_RETURN(result);
+}
 
-                // Get file list
-                XmlNodeList *fileList = xmlNodeChildList(xmlRoot, S3_XML_TAG_CONTENTS_STR);
+static void
+storageS3Copy(THIS_VOID, StorageRead *source, StorageWrite *destination, StorageInterfaceCopyParam param)
+{
+    THIS(StorageS3);
 
-                for (unsigned int fileIdx = 0; fileIdx < xmlNodeLstSize(fileList); fileIdx++)
-                {
-                    const XmlNode *fileNode = xmlNodeLstGet(fileList, fileIdx);
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STORAGE_READ, source);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, destination);
+        (void)param;                                                // No parameters are used
+    FUNCTION_LOG_END();
 
-                    // Get file name
-                    const String *file = xmlNodeContent(xmlNodeChild(fileNode, S3_XML_TAG_KEY_STR, true));
+    ASSERT(this != NULL);
+    ASSERT(source != NULL);
+    ASSERT(destination != NULL);
 
-                    // Strip off the base prefix when present
-                    file = strEmpty(basePrefix) ? file : strSub(file, strSize(basePrefix));
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *sourceFile = storageReadName(source);
+        const String *destinationFile = storageWriteName(destination);
 
-                    // Add to list
-                    callback(this, callbackData, file, storageTypeFile, fileNode);
-                }
+        // Get the source size to determine if a multi-part copy is required
+        StorageInfo sourceInfo = storageInterfaceInfoP(this, sourceFile, storageInfoLevelBasic);
 
-                // Get the continuation token and store it in the outer temp context
-                MEM_CONTEXT_PRIOR_BEGIN()
-                {
-                    continuationToken = xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_NEXT_CONTINUATION_TOKEN_STR, false));
-                }
-                MEM_CONTEXT_PRIOR_END();
+        if (!sourceInfo.exists)
+            THROW_FMT(FileMissingError, STORAGE_ERROR_READ_MISSING, strPtr(sourceFile));
+
+        // The copy source is always specified with the bucket regardless of uri style
+        HttpHeader *header = httpHeaderNew(NULL);
+        httpHeaderAdd(
+            header, S3_HEADER_COPY_SOURCE_STR, httpUriEncode(strNewFmt("/%s%s", strPtr(this->bucket), strPtr(sourceFile)), true));
+
+        // Copy with a single request when possible
+        if (sourceInfo.size <= S3_COPY_SIZE_MAX)
+        {
+            storageS3CopyResult(
+                storageS3Request(this, HTTP_VERB_PUT_STR, destinationFile, NULL, header, NULL, true, false).response);
+        }
+        // Else copy ranges of the source into the parts of a multi-part upload
+        else
+        {
+            const String *uploadId = xmlNodeContent(
+                xmlNodeChild(
+                    xmlDocumentRoot(
+                        xmlDocumentNewBuf(
+                            storageS3Request(
+                                this, HTTP_VERB_POST_STR, destinationFile,
+                                httpQueryAdd(httpQueryNew(), S3_QUERY_UPLOADS_STR, EMPTY_STR), NULL, NULL, true, false).response)),
+                    S3_XML_TAG_UPLOAD_ID_STR, true));
+
+            XmlDocument *partList = xmlDocumentNew(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR);
+            unsigned int partNumber = 1;
+
+            for (uint64_t partStart = 0; partStart < sourceInfo.size; partStart += S3_COPY_SIZE_MAX)
+            {
+                uint64_t partEnd =
+                    sourceInfo.size - partStart > S3_COPY_SIZE_MAX ? partStart + S3_COPY_SIZE_MAX : sourceInfo.size;
+
+                HttpQuery *query = httpQueryNew();
+                httpQueryAdd(query, S3_QUERY_UPLOAD_ID_STR, uploadId);
+                httpQueryAdd(query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", partNumber));
+
+                httpHeaderPut(
+                    header, S3_HEADER_COPY_SOURCE_RANGE_STR, strNewFmt("bytes=%" PRIu64 "-%" PRIu64, partStart, partEnd - 1));
+
+                // Copy the part and add the etag to the part list
+                const String *eTag = xmlNodeContent(
+                    xmlNodeChild(
+                        storageS3CopyResult(
+                            storageS3Request(this, HTTP_VERB_PUT_STR, destinationFile, query, header, NULL, true, false).response),
+                        S3_XML_TAG_ETAG_STR, true));
+
+                XmlNode *partNode = xmlNodeAdd(xmlDocumentRoot(partList), S3_XML_TAG_PART_STR);
+                xmlNodeContentSet(xmlNodeAdd(partNode, S3_XML_TAG_PART_NUMBER_STR), strNewFmt("%u", partNumber));
+                xmlNodeContentSet(xmlNodeAdd(partNode, S3_XML_TAG_ETAG_STR), eTag);
+
+                partNumber++;
             }
-            MEM_CONTEXT_TEMP_END();
+
+            // Finalize the multi-part upload
+            storageS3Request(
+                this, HTTP_VERB_POST_STR, destinationFile, httpQueryAdd(httpQueryNew(), S3_QUERY_UPLOAD_ID_STR, uploadId), NULL,
+                xmlDocumentBuf(partList), true, false);
         }
-        while (continuationToken != NULL);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -539,7 +1125,7 @@ storageS3Info(THIS_VOID, const String *file, StorageInfoLevel level, StorageInte
     ASSERT(file != NULL);
 
     // Attempt to get file info
-    StorageS3RequestResult httpResult = storageS3Request(this, HTTP_VERB_HEAD_STR, file, NULL, NULL, true, true);
+    StorageS3RequestResult httpResult = storageS3Request(this, HTTP_VERB_HEAD_STR, file, NULL, NULL, NULL, true, true);
 
     // Does the file exist?
     StorageInfo result = {.level = level, .exists = httpClientResponseCodeOk(httpResult.httpClient)};
@@ -580,14 +1166,15 @@ storageS3CvtTime(const String *time)
 }
 
 static void
-storageS3InfoListCallback(StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlNode *xml)
+storageS3InfoListCallback(
+    StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlStreamElement *xml)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(STORAGE_S3, this);
         FUNCTION_TEST_PARAM_P(VOID, callbackData);
         FUNCTION_TEST_PARAM(STRING, name);
         FUNCTION_TEST_PARAM(ENUM, type);
-        FUNCTION_TEST_PARAM(XML_NODE, xml);
+        FUNCTION_TEST_PARAM(XML_STREAM_ELEMENT, xml);
     FUNCTION_TEST_END();
 
     (void)this;
@@ -608,9 +1195,9 @@ storageS3InfoListCallback(StorageS3 *this, void *callbackData, const String *nam
     {
         info.type = type;
         info.size = type == storageTypeFile ?
-            cvtZToUInt64(strPtr(xmlNodeContent(xmlNodeChild(xml, S3_XML_TAG_SIZE_STR, true)))) : 0;
+            cvtZToUInt64(strPtr(xmlStreamElementChild(xml, S3_XML_TAG_SIZE_STR, true))) : 0;
         info.timeModified = type == storageTypeFile ?
-            storageS3CvtTime(xmlNodeContent(xmlNodeChild(xml, S3_XML_TAG_LAST_MODIFIED_STR, true))) : 0;
+            storageS3CvtTime(xmlStreamElementChild(xml, S3_XML_TAG_LAST_MODIFIED_STR, true)) : 0;
     }
 
     data->callback(data->callbackData, &info);
@@ -658,13 +1245,16 @@ storageS3NewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageInter
         FUNCTION_LOG_PARAM(STORAGE_S3, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
+        FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadS3New(this, file, ignoreMissing));
+    FUNCTION_LOG_RETURN(
+        STORAGE_READ,
+        storageReadS3New(this, file, ignoreMissing, param.offset, param.limit, this->partSize, this->downloadMax));
 }
 
 /**********************************************************************************************************************************/
@@ -686,7 +1276,7 @@ storageS3NewWrite(THIS_VOID, const String *file, StorageInterfaceNewWriteParam p
     ASSERT(param.group == NULL);
     ASSERT(param.timeModified == 0);
 
-    FUNCTION_LOG_RETURN(STORAGE_WRITE, storageWriteS3New(this, file, this->partSize));
+    FUNCTION_LOG_RETURN(STORAGE_WRITE, storageWriteS3New(this, file, this->partSize, this->uploadMax));
 }
 
 /**********************************************************************************************************************************/
@@ -697,6 +1287,30 @@ typedef struct StorageS3PathRemoveData
     XmlDocument *xml;                                               // Delete request
 } StorageS3PathRemoveData;
 
+// Error on the first file that could not be deleted
+static void
+storageS3PathRemoveErrorCallback(void *callbackData, const XmlStreamElement *element)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+        FUNCTION_TEST_PARAM(XML_STREAM_ELEMENT, element);
+    FUNCTION_TEST_END();
+
+    (void)callbackData;
+    ASSERT(element != NULL);
+
+    if (strEq(xmlStreamElementName(element), S3_XML_TAG_ERROR_STR))
+    {
+        THROW_FMT(
+            FileRemoveError, STORAGE_ERROR_PATH_REMOVE_FILE ": [%s] %s",
+            strPtr(xmlStreamElementChild(element, S3_XML_TAG_KEY_STR, true)),
+            strPtr(xmlStreamElementChild(element, S3_XML_TAG_CODE_STR, true)),
+            strPtr(xmlStreamElementChild(element, S3_XML_TAG_MESSAGE_STR, true)));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 static void
 storageS3PathRemoveInternal(StorageS3 *this, XmlDocument *request)
 {
@@ -708,39 +1322,30 @@ storageS3PathRemoveInternal(StorageS3 *this, XmlDocument *request)
     ASSERT(this != NULL);
     ASSERT(request != NULL);
 
-    Buffer *response = storageS3Request(
-        this, HTTP_VERB_POST_STR, FSLASH_STR, httpQueryAdd(httpQueryNew(), S3_QUERY_DELETE_STR, EMPTY_STR),
-        xmlDocumentBuf(request), true, false).response;
-
-    // Nothing is returned when there are no errors
-    if (response != NULL)
+    MEM_CONTEXT_TEMP_BEGIN()
     {
-        XmlNodeList *errorList = xmlNodeChildList(xmlDocumentRoot(xmlDocumentNewBuf(response)), S3_XML_TAG_ERROR_STR);
-
-        if (xmlNodeLstSize(errorList) > 0)
-        {
-            XmlNode *error = xmlNodeLstGet(errorList, 0);
-
-            THROW_FMT(
-                FileRemoveError, STORAGE_ERROR_PATH_REMOVE_FILE ": [%s] %s",
-                strPtr(xmlNodeContent(xmlNodeChild(error, S3_XML_TAG_KEY_STR, true))),
-                strPtr(xmlNodeContent(xmlNodeChild(error, S3_XML_TAG_CODE_STR, true))),
-                strPtr(xmlNodeContent(xmlNodeChild(error, S3_XML_TAG_MESSAGE_STR, true))));
-        }
+        // Only errors are returned since the request is quiet, and nothing at all may be returned when there are no errors
+        storageS3ResponseXml(
+            storageS3Request(
+                this, HTTP_VERB_POST_STR, FSLASH_STR, httpQueryAdd(httpQueryNew(), S3_QUERY_DELETE_STR, EMPTY_STR), NULL,
+                xmlDocumentBuf(request), false, false).httpClient,
+            storageS3PathRemoveErrorCallback, NULL);
     }
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_TEST_RETURN_VOID();
 }
 
 static void
-storageS3PathRemoveCallback(StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlNode *xml)
+storageS3PathRemoveCallback(
+    StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlStreamElement *xml)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(STORAGE_S3, this);
         FUNCTION_TEST_PARAM_P(VOID, callbackData);
         FUNCTION_TEST_PARAM(STRING, name);
         FUNCTION_TEST_PARAM(ENUM, type);
-        FUNCTION_TEST_PARAM(XML_NODE, xml);
+        FUNCTION_TEST_PARAM(XML_STREAM_ELEMENT, xml);
     FUNCTION_TEST_END();
 
     ASSERT(this != NULL);
@@ -767,7 +1372,7 @@ storageS3PathRemoveCallback(StorageS3 *this, void *callbackData, const String *n
         // Add to delete list
         xmlNodeContentSet(
             xmlNodeAdd(xmlNodeAdd(xmlDocumentRoot(data->xml), S3_XML_TAG_OBJECT_STR), S3_XML_TAG_KEY_STR),
-            xmlNodeContent(xmlNodeChild(xml, S3_XML_TAG_KEY_STR, true)));
+            xmlStreamElementChild(xml, S3_XML_TAG_KEY_STR, true));
         data->size++;
 
         // Delete list when it is full
@@ -828,7 +1433,7 @@ storageS3Remove(THIS_VOID, const String *file, StorageInterfaceRemoveParam param
     ASSERT(file != NULL);
     ASSERT(!param.errorOnMissing);
 
-    storageS3Request(this, HTTP_VERB_DELETE_STR, file, NULL, NULL, true, false);
+    storageS3Request(this, HTTP_VERB_DELETE_STR, file, NULL, NULL, NULL, true, false);
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -836,6 +1441,9 @@ storageS3Remove(THIS_VOID, const String *file, StorageInterfaceRemoveParam param
 /**********************************************************************************************************************************/
 static const StorageInterface storageInterfaceS3 =
 {
+    .feature = 1 << storageFeatureLimitRead,
+
+    .copy = storageS3Copy,
     .info = storageS3Info,
     .infoList = storageS3InfoList,
     .newRead = storageS3NewRead,
@@ -848,8 +1456,9 @@ Storage *
 storageS3New(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *bucket,
     const String *endPoint, StorageS3UriStyle uriStyle, const String *region, const String *accessKey,
-    const String *secretAccessKey, const String *securityToken, size_t partSize, unsigned int deleteMax, const String *host,
-    unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+    const String *secretAccessKey, const String *securityToken, size_t partSize, unsigned int uploadMax,
+    unsigned int downloadMax, unsigned int listMax, unsigned int deleteMax, const String *host, unsigned int port, TimeMSec timeout,
+    bool tls, bool verifyPeer, const String *caFile, const String *caPath)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, path);
@@ -863,9 +1472,14 @@ storageS3New(
         FUNCTION_TEST_PARAM(STRING, secretAccessKey);
         FUNCTION_TEST_PARAM(STRING, securityToken);
         FUNCTION_LOG_PARAM(SIZE, partSize);
+        FUNCTION_LOG_PARAM(UINT, uploadMax);
+        FUNCTION_LOG_PARAM(UINT, downloadMax);
+        FUNCTION_LOG_PARAM(UINT, listMax);
+        FUNCTION_LOG_PARAM(UINT, deleteMax);
         FUNCTION_LOG_PARAM(STRING, host);
         FUNCTION_LOG_PARAM(UINT, port);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+        FUNCTION_LOG_PARAM(BOOL, tls);
         FUNCTION_LOG_PARAM(BOOL, verifyPeer);
         FUNCTION_LOG_PARAM(STRING, caFile);
         FUNCTION_LOG_PARAM(STRING, caPath);
@@ -877,6 +1491,9 @@ storageS3New(
     ASSERT(region != NULL);
     ASSERT(accessKey != NULL);
     ASSERT(secretAccessKey != NULL);
+    ASSERT(uploadMax > 0);
+    ASSERT(downloadMax > 0);
+    ASSERT(listMax > 0);
 
     Storage *this = NULL;
 
@@ -894,19 +1511,37 @@ storageS3New(
             .secretAccessKey = strDup(secretAccessKey),
             .securityToken = strDup(securityToken),
             .partSize = partSize,
+            .uploadMax = uploadMax,
+            .downloadMax = downloadMax,
+            .listMax = listMax,
             .deleteMax = deleteMax,
             .uriStyle = uriStyle,
             .bucketEndpoint = uriStyle == storageS3UriStyleHost ?
                 strNewFmt("%s.%s", strPtr(bucket), strPtr(endPoint)) : strDup(endPoint),
             .port = port,
+            .tls = tls,
 
             // Force the signing key to be generated on the first run
             .signingKeyDate = YYYYMMDD_STR,
         };
 
+        // Start at the largest configured concurrency. The limit will be reduced if requests are throttled.
+        driver->concurrencyMax = uploadMax > downloadMax ? uploadMax : downloadMax;
+
+        if (listMax > driver->concurrencyMax)
+            driver->concurrencyMax = listMax;
+
+        driver->concurrencyLimit = driver->concurrencyMax;
+
+        // Create the client used to open connections. TLS is layered over the socket unless it has been disabled, e.g. when the
+        // endpoint is local or reached through a Unix socket.
+        SocketClient *socketClient = sckClientNew(host == NULL ? driver->bucketEndpoint : host, driver->port, timeout);
+        IoClient *ioClient = tls ?
+            tlsClientIoClient(tlsClientNew(socketClient, timeout, verifyPeer, caFile, caPath, NULL, NULL)) :
+            sckClientIoClient(socketClient);
+
         // Create the http client cache used to service requests
-        driver->httpClientCache = httpClientCacheNew(
-            host == NULL ? driver->bucketEndpoint : host, driver->port, timeout, verifyPeer, caFile, caPath);
+        driver->httpClientCache = httpClientCacheNew(ioClient, timeout, driver->concurrencyMax, STORAGE_S3_SESSION_IDLE_TIMEOUT);
 
         // Create list of redacted headers
         driver->headerRedactList = strLstNew();
@@ -30,13 +30,18 @@ Defaults
 #define STORAGE_S3_PARTSIZE_MIN                                     ((size_t)5 * 1024 * 1024)
 #define STORAGE_S3_DELETE_MAX                                       1000
 
+// Sessions idle longer than this are closed rather than reused since the server or a firewall may have dropped them. This is less
+// than the keep-alive timeout of most servers.
+#define STORAGE_S3_SESSION_IDLE_TIMEOUT                             ((TimeMSec)15000)
+
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
 Storage *storageS3New(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *bucket,
     const String *endPoint, StorageS3UriStyle uriStyle, const String *region, const String *accessKey,
-    const String *secretAccessKey, const String *securityToken, size_t partSize, unsigned int deleteMax, const String *host,
-    unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+    const String *secretAccessKey, const String *securityToken, size_t partSize, unsigned int uploadMax,
+    unsigned int downloadMax, unsigned int listMax, unsigned int deleteMax, const String *host, unsigned int port, TimeMSec timeout,
+    bool tls, bool verifyPeer, const String *caFile, const String *caPath);
 
 #endif
@@ -12,6 +12,27 @@ typedef struct StorageS3 StorageS3;
 #include "common/io/http/client.h"
 #include "storage/s3/storage.h"
 
+/***********************************************************************************************************************************
+Multi-part upload query tokens and XML tags (shared by write and copy)
+***********************************************************************************************************************************/
+#define S3_QUERY_PART_NUMBER                                        "partNumber"
+    STRING_DECLARE(S3_QUERY_PART_NUMBER_STR);
+#define S3_QUERY_UPLOADS                                            "uploads"
+    STRING_DECLARE(S3_QUERY_UPLOADS_STR);
+#define S3_QUERY_UPLOAD_ID                                          "uploadId"
+    STRING_DECLARE(S3_QUERY_UPLOAD_ID_STR);
+
+#define S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD                        "CompleteMultipartUpload"
+    STRING_DECLARE(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR);
+#define S3_XML_TAG_ETAG                                             "ETag"
+    STRING_DECLARE(S3_XML_TAG_ETAG_STR);
+#define S3_XML_TAG_PART                                             "Part"
+    STRING_DECLARE(S3_XML_TAG_PART_STR);
+#define S3_XML_TAG_PART_NUMBER                                      "PartNumber"
+    STRING_DECLARE(S3_XML_TAG_PART_NUMBER_STR);
+#define S3_XML_TAG_UPLOAD_ID                                        "UploadId"
+    STRING_DECLARE(S3_XML_TAG_UPLOAD_ID_STR);
+
 /***********************************************************************************************************************************
 Perform an S3 Request
 ***********************************************************************************************************************************/
@@ -28,8 +49,43 @@ typedef struct StorageS3RequestResult
 } StorageS3RequestResult;
 
 StorageS3RequestResult storageS3Request(
-    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const Buffer *body, bool returnContent,
-    bool allowMissing);
+    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *header, const Buffer *body,
+    bool returnContent, bool allowMissing);
+
+/***********************************************************************************************************************************
+Perform an S3 request without waiting for the response
+
+The request is sent on a client that is not busy so other requests can be sent before the response is read with storageS3Response().
+The query, header, and body are not copied and must not be modified or freed until the response has been read.
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_S3_REQUEST_ASYNC_TYPE                                                                                 \
+    StorageS3RequestAsync
+#define FUNCTION_LOG_STORAGE_S3_REQUEST_ASYNC_FORMAT(value, buffer, bufferSize)                                                    \
+    objToLog(&value, "StorageS3RequestAsync", buffer, bufferSize)
+
+typedef struct StorageS3RequestAsync
+{
+    MemContext *memContext;                                         // Mem context the request was created in
+    StorageS3 *storage;                                             // Storage that sent the request
+    HttpClient *httpClient;                                         // Client the request was sent on
+    uint64_t requestId;                                             // Sequence of the request on the storage
+    const String *verb;                                             // Verb (GET, PUT, etc)
+    const String *uri;                                              // URI, with the bucket prepended for path-style URIs
+    const HttpQuery *query;                                         // Query, if any
+    const HttpHeader *header;                                       // Headers passed by the caller, if any
+    const Buffer *body;                                             // Body, if any
+    HttpHeader *requestHeader;                                      // Signed headers sent with the request
+} StorageS3RequestAsync;
+
+StorageS3RequestAsync storageS3RequestAsync(
+    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *header, const Buffer *body);
+StorageS3RequestResult storageS3Response(StorageS3RequestAsync *request, bool returnContent, bool allowMissing);
+
+/***********************************************************************************************************************************
+Get the number of requests that may be in flight given a configured maximum. This is less than the maximum while the server is
+throttling requests.
+***********************************************************************************************************************************/
+unsigned int storageS3ConcurrencyMax(const StorageS3 *this, unsigned int max);
 
 /***********************************************************************************************************************************
 Macros for function logging
@@ -3,30 +3,32 @@ S3 Storage File write
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <string.h>
+
+#include "common/crypto/hash.h"
 #include "common/debug.h"
+#include "common/encode.h"
+#include "common/io/filter/filter.intern.h"
 #include "common/io/write.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/type/list.h"
 #include "common/type/object.h"
 #include "common/type/xml.h"
 #include "storage/s3/write.h"
 #include "storage/write.intern.h"
 
 /***********************************************************************************************************************************
-S3 query tokens
+Part that has been sent but whose response has not been read yet
 ***********************************************************************************************************************************/
-STRING_STATIC(S3_QUERY_PART_NUMBER_STR,                             "partNumber");
-STRING_STATIC(S3_QUERY_UPLOADS_STR,                                 "uploads");
-STRING_STATIC(S3_QUERY_UPLOAD_ID_STR,                               "uploadId");
-
-/***********************************************************************************************************************************
-XML tags
-***********************************************************************************************************************************/
-STRING_STATIC(S3_XML_TAG_ETAG_STR,                                  "ETag");
-STRING_STATIC(S3_XML_TAG_UPLOAD_ID_STR,                             "UploadId");
-STRING_STATIC(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR,             "CompleteMultipartUpload");
-STRING_STATIC(S3_XML_TAG_PART_STR,                                  "Part");
-STRING_STATIC(S3_XML_TAG_PART_NUMBER_STR,                           "PartNumber");
+typedef struct StorageWriteS3Part
+{
+    MemContext *memContext;                                         // Part mem context
+    Buffer *buffer;                                                 // Part content, must remain valid until the response is read
+    HttpQuery *query;                                               // Upload id and part number
+    HttpHeader *header;                                             // Content md5
+    StorageS3RequestAsync request;                                  // Request
+} StorageWriteS3Part;
 
 /***********************************************************************************************************************************
 Object type
@@ -38,9 +40,13 @@ typedef struct StorageWriteS3
     StorageS3 *storage;                                             // Storage that created this object
 
     size_t partSize;
+    unsigned int uploadMax;                                         // Maximum parts in flight
     Buffer *partBuffer;
+    IoFilter *partHash;                                             // Md5 of the part buffer, calculated as the buffer is filled
     const String *uploadId;
-    StringList *uploadPartList;
+    StringList *uploadPartList;                                     // ETags of parts that have completed, in part order
+    List *uploadInFlightList;                                       // Parts in flight, oldest first
+    List *partBufferPool;                                           // Part buffers free for reuse after their part completed
 } StorageWriteS3;
 
 /***********************************************************************************************************************************
@@ -70,14 +76,85 @@ storageWriteS3Open(THIS_VOID)
     MEM_CONTEXT_BEGIN(this->memContext)
     {
         this->partBuffer = bufNew(this->partSize);
+        this->partHash = cryptoHashNew(HASH_TYPE_MD5_STR);
     }
     MEM_CONTEXT_END();
 
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Get the content-md5 header for the part buffer and reset the hash for the next part
+***********************************************************************************************************************************/
+static HttpHeader *
+storageWriteS3PartHeader(StorageWriteS3 *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_S3, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->partHash != NULL);
+
+    HttpHeader *result = httpHeaderNew(NULL);
+
+    char md5Hash[HASH_TYPE_MD5_SIZE_HEX];
+    encodeToStr(encodeBase64, bufPtrConst(cryptoHashBuf(this->partHash)), HASH_TYPE_M5_SIZE, md5Hash);
+    httpHeaderAdd(result, HTTP_HEADER_CONTENT_MD5_STR, STR(md5Hash));
+
+    ioFilterFree(this->partHash);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->partHash = cryptoHashNew(HASH_TYPE_MD5_STR);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN(HTTP_HEADER, result);
+}
+
+/***********************************************************************************************************************************
+Read the response for the oldest part in flight and add the etag to the part list
+***********************************************************************************************************************************/
+static void
+storageWriteS3PartComplete(StorageWriteS3 *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_S3, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(lstSize(this->uploadInFlightList) > 0);
+
+    StorageWriteS3Part *part = *(StorageWriteS3Part **)lstGet(this->uploadInFlightList, 0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        strLstAdd(
+            this->uploadPartList,
+            httpHeaderGet(storageS3Response(&part->request, true, false).responseHeader, HTTP_HEADER_ETAG_STR));
+
+        ASSERT(strLstGet(this->uploadPartList, strLstSize(this->uploadPartList) - 1) != NULL);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    // Return the part buffer to the pool so it can be reused for a later part rather than allocating a new buffer
+    Buffer *partBuffer = bufMove(part->buffer, this->memContext);
+    bufUsedZero(partBuffer);
+    lstAdd(this->partBufferPool, &partBuffer);
+
+    // Free the part now that the response has been read
+    lstRemoveIdx(this->uploadInFlightList, 0);
+    memContextFree(part->memContext);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Flush bytes to upload part
+
+The part is sent without waiting for the response so up to uploadMax parts can be uploaded concurrently, each on its own connection.
+Responses are read in part order so the part list is ordered correctly when the upload is completed.
 ***********************************************************************************************************************************/
 static void
 storageWriteS3Part(StorageWriteS3 *this)
@@ -100,32 +177,58 @@ storageWriteS3Part(StorageWriteS3 *this)
                 xmlDocumentNewBuf(
                     storageS3Request(
                         this->storage, HTTP_VERB_POST_STR, this->interface.name,
-                        httpQueryAdd(httpQueryNew(), S3_QUERY_UPLOADS_STR, EMPTY_STR), NULL, true, false).response));
+                        httpQueryAdd(httpQueryNew(), S3_QUERY_UPLOADS_STR, EMPTY_STR), NULL, NULL, true, false).response));
 
             // Store the upload id
             MEM_CONTEXT_BEGIN(this->memContext)
             {
                 this->uploadId = xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_UPLOAD_ID_STR, true));
                 this->uploadPartList = strLstNew();
+                this->uploadInFlightList = lstNew(sizeof(StorageWriteS3Part *));
+                this->partBufferPool = lstNew(sizeof(Buffer *));
             }
             MEM_CONTEXT_END();
         }
+    }
+    MEM_CONTEXT_TEMP_END();
 
-        // Upload the part and add etag to part list
-        HttpQuery *query = httpQueryNew();
-        httpQueryAdd(query, S3_QUERY_UPLOAD_ID_STR, this->uploadId);
-        httpQueryAdd(query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", strLstSize(this->uploadPartList) + 1));
+    // If the maximum parts are in flight then wait for the oldest to complete. The maximum may be lower than uploadMax while
+    // requests are being throttled.
+    while (lstSize(this->uploadInFlightList) >= storageS3ConcurrencyMax(this->storage, this->uploadMax))
+        storageWriteS3PartComplete(this);
 
-        strLstAdd(
-            this->uploadPartList,
-            httpHeaderGet(
-                storageS3Request(
-                    this->storage, HTTP_VERB_PUT_STR, this->interface.name, query, this->partBuffer, true, false).responseHeader,
-                HTTP_HEADER_ETAG_STR));
+    // Upload the part. The part buffer is moved to the part and a buffer from the pool (or a new buffer when the pool is empty) is
+    // used for the next part, so no more than one buffer more than the maximum parts in flight is ever allocated.
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        MEM_CONTEXT_NEW_BEGIN("StorageWriteS3Part")
+        {
+            StorageWriteS3Part *part = memNew(sizeof(StorageWriteS3Part));
+            *part = (StorageWriteS3Part){.memContext = MEM_CONTEXT_NEW(), .buffer = bufMove(this->partBuffer, MEM_CONTEXT_NEW())};
 
-        ASSERT(strLstGet(this->uploadPartList, strLstSize(this->uploadPartList) - 1) != NULL);
+            part->query = httpQueryNew();
+            httpQueryAdd(part->query, S3_QUERY_UPLOAD_ID_STR, this->uploadId);
+            httpQueryAdd(
+                part->query, S3_QUERY_PART_NUMBER_STR,
+                strNewFmt("%u", strLstSize(this->uploadPartList) + lstSize(this->uploadInFlightList) + 1));
+
+            part->header = storageWriteS3PartHeader(this);
+            part->request = storageS3RequestAsync(
+                this->storage, HTTP_VERB_PUT_STR, this->interface.name, part->query, part->header, part->buffer);
+
+            lstAdd(this->uploadInFlightList, &part);
+        }
+        MEM_CONTEXT_NEW_END();
+
+        if (lstSize(this->partBufferPool) > 0)
+        {
+            this->partBuffer = *(Buffer **)lstGet(this->partBufferPool, lstSize(this->partBufferPool) - 1);
+            lstRemoveIdx(this->partBufferPool, lstSize(this->partBufferPool) - 1);
+        }
+        else
+            this->partBuffer = bufNew(this->partSize);
     }
-    MEM_CONTEXT_TEMP_END();
+    MEM_CONTEXT_END();
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -155,6 +258,11 @@ storageWriteS3(THIS_VOID, const Buffer *buffer)
         size_t bytesNext = bufRemains(this->partBuffer) > bufUsed(buffer) - bytesTotal ?
             bufUsed(buffer) - bytesTotal : bufRemains(this->partBuffer);
         bufCatSub(this->partBuffer, buffer, bytesTotal, bytesNext);
+
+        // Update the part hash while the bytes are still in cache
+        if (bytesNext > 0)
+            ioFilterProcessIn(this->partHash, BUF(bufPtrConst(buffer) + bytesTotal, bytesNext));
+
         bytesTotal += bytesNext;
 
         // If the part buffer is full then write it
@@ -195,6 +303,10 @@ storageWriteS3Close(THIS_VOID)
                 if (bufUsed(this->partBuffer) > 0)
                     storageWriteS3Part(this);
 
+                // Wait for all parts in flight to complete
+                while (lstSize(this->uploadInFlightList) > 0)
+                    storageWriteS3PartComplete(this);
+
                 // Generate the xml part list
                 XmlDocument *partList = xmlDocumentNew(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR);
 
@@ -208,17 +320,21 @@ storageWriteS3Close(THIS_VOID)
                 // Finalize the multi-part upload
                 storageS3Request(
                     this->storage, HTTP_VERB_POST_STR, this->interface.name,
-                    httpQueryAdd(httpQueryNew(), S3_QUERY_UPLOAD_ID_STR, this->uploadId), xmlDocumentBuf(partList), true, false);
+                    httpQueryAdd(httpQueryNew(), S3_QUERY_UPLOAD_ID_STR, this->uploadId), NULL, xmlDocumentBuf(partList), true,
+                    false);
             }
             // Else upload all the data in a single put
             else
             {
                 storageS3Request(
-                    this->storage, HTTP_VERB_PUT_STR, this->interface.name, NULL, this->partBuffer, true, false);
+                    this->storage, HTTP_VERB_PUT_STR, this->interface.name, NULL, storageWriteS3PartHeader(this),
+                    this->partBuffer, true, false);
             }
 
             bufFree(this->partBuffer);
             this->partBuffer = NULL;
+            ioFilterFree(this->partHash);
+            this->partHash = NULL;
         }
         MEM_CONTEXT_TEMP_END();
     }
@@ -228,15 +344,18 @@ storageWriteS3Close(THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageWrite *
-storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
+storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize, unsigned int uploadMax)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_S3, storage);
         FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(SIZE, partSize);
+        FUNCTION_LOG_PARAM(UINT, uploadMax);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(uploadMax > 0);
 
     StorageWrite *this = NULL;
 
@@ -249,6 +368,7 @@ storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
             .partSize = partSize,
+            .uploadMax = uploadMax,
 
             .interface = (StorageWriteInterface)
             {
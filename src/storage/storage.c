@@ -135,6 +135,36 @@ storageCopy(StorageRead *source, StorageWrite *destination)
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/**********************************************************************************************************************************/
+void
+storageCopyServer(const Storage *this, StorageRead *source, StorageWrite *destination)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, this);
+        FUNCTION_LOG_PARAM(STORAGE_READ, source);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(source != NULL);
+    ASSERT(destination != NULL);
+    ASSERT(!storageReadIgnoreMissing(source));
+    ASSERT(strEq(this->type, storageReadType(source)));
+    ASSERT(strEq(storageReadType(source), storageWriteType(destination)));
+
+    // Copy on the storage only when the content will not be modified on the way, otherwise the data must pass through here
+    if (this->interface.copy != NULL && storageReadOffset(source) == 0 && storageReadLimit(source) == NULL &&
+        ioFilterGroupSize(ioReadFilterGroup(storageReadIo(source))) == 0 &&
+        ioFilterGroupSize(ioWriteFilterGroup(storageWriteIo(destination))) == 0)
+    {
+        storageInterfaceCopyP(this->driver, source, destination);
+    }
+    else
+        storageCopyP(source, destination);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 bool
 storageExists(const Storage *this, const String *pathExp, StorageExistsParam param)
@@ -499,6 +529,152 @@ storageInfoList(
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/**********************************************************************************************************************************/
+typedef struct StorageInfoListMultiData
+{
+    StorageInfoListMultiCallback callbackFunction;                  // Original callback function
+    void *callbackData;                                             // Original callback data
+    unsigned int pathIdx;                                           // Index of the path currently being listed
+    SortOrder sortOrder;                                            // Sort order
+    StorageInfoListSortData sortData;                               // Info for the current path when sorting
+} StorageInfoListMultiData;
+
+// Pass info for a single path to the original callback with the path index
+static void
+storageInfoListMultiPathCallback(void *data, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_LOG_PARAM_P(VOID, data);
+        FUNCTION_LOG_PARAM(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    StorageInfoListMultiData *multiData = data;
+
+    multiData->callbackFunction(multiData->callbackData, multiData->pathIdx, info);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Send the sorted info for the current path to the original callback
+static void
+storageInfoListMultiSortFlush(StorageInfoListMultiData *multiData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_LOG_PARAM_P(VOID, multiData);
+    FUNCTION_TEST_END();
+
+    lstSort(multiData->sortData.infoList, multiData->sortOrder);
+
+    for (unsigned int infoIdx = 0; infoIdx < lstSize(multiData->sortData.infoList); infoIdx++)
+        multiData->callbackFunction(multiData->callbackData, multiData->pathIdx, lstGet(multiData->sortData.infoList, infoIdx));
+
+    lstClear(multiData->sortData.infoList);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Collect info for each path so it can be sorted. The driver sends all the info for a path before moving on to the next path so the
+// info for the previous path can be sent when the path index changes.
+static void
+storageInfoListMultiSortCallback(void *data, unsigned int pathIdx, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_LOG_PARAM_P(VOID, data);
+        FUNCTION_LOG_PARAM(UINT, pathIdx);
+        FUNCTION_LOG_PARAM(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    StorageInfoListMultiData *multiData = data;
+
+    if (pathIdx != multiData->pathIdx)
+    {
+        storageInfoListMultiSortFlush(multiData);
+        multiData->pathIdx = pathIdx;
+    }
+
+    storageInfoListSortCallback(&multiData->sortData, info);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+storageInfoListMulti(
+    const Storage *this, const StringList *pathExpList, StorageInfoListMultiCallback callback, void *callbackData,
+    StorageInfoListMultiParam param)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, this);
+        FUNCTION_LOG_PARAM(STRING_LIST, pathExpList);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+        FUNCTION_LOG_PARAM(ENUM, param.level);
+        FUNCTION_LOG_PARAM(ENUM, param.sortOrder);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(pathExpList != NULL);
+    ASSERT(callback != NULL);
+    ASSERT(this->interface.infoList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Info level
+        if (param.level == storageInfoLevelDefault)
+            param.level = storageFeature(this, storageFeatureInfoDetail) ? storageInfoLevelDetail : storageInfoLevelBasic;
+
+        // Build the paths
+        StringList *pathList = strLstNew();
+
+        for (unsigned int pathIdx = 0; pathIdx < strLstSize(pathExpList); pathIdx++)
+            strLstAdd(pathList, storagePathP(this, strLstGet(pathExpList, pathIdx)));
+
+        StorageInfoListMultiData data =
+        {
+            .callbackFunction = callback,
+            .callbackData = callbackData,
+            .sortOrder = param.sortOrder,
+        };
+
+        // If the driver can batch requests then get info for all paths at once
+        if (this->interface.infoListMulti != NULL)
+        {
+            // If no sorting then use the callback directly
+            if (param.sortOrder == sortOrderNone)
+            {
+                storageInterfaceInfoListMultiP(this->driver, pathList, param.level, callback, callbackData);
+            }
+            // Else sort the info for each path before sending it to the callback
+            else
+            {
+                data.sortData = (StorageInfoListSortData)
+                {
+                    .memContext = MEM_CONTEXT_TEMP(),
+                    .ownerList = strLstNew(),
+                    .infoList = lstNewP(sizeof(StorageInfo), .comparator = lstComparatorStr),
+                };
+
+                storageInterfaceInfoListMultiP(this->driver, pathList, param.level, storageInfoListMultiSortCallback, &data);
+                storageInfoListMultiSortFlush(&data);
+            }
+        }
+        // Else list each path individually
+        else
+        {
+            for (unsigned int pathIdx = 0; pathIdx < strLstSize(pathList); pathIdx++)
+            {
+                data.pathIdx = pathIdx;
+
+                storageInfoListSort(
+                    this, strLstGet(pathList, pathIdx), param.level, NULL, param.sortOrder, storageInfoListMultiPathCallback,
+                    &data);
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 static void
 storageListCallback(void *data, const StorageInfo *info)
@@ -608,11 +784,12 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         FUNCTION_LOG_PARAM(STRING, fileExp);
         FUNCTION_LOG_PARAM(BOOL, param.ignoreMissing);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(storageFeature(this, storageFeatureLimitRead) || param.limit == NULL);
+    ASSERT(storageFeature(this, storageFeatureLimitRead) || (param.offset == 0 && param.limit == NULL));
     ASSERT(param.limit == NULL || varType(param.limit) == varTypeUInt64);
 
     StorageRead *result = NULL;
@@ -622,7 +799,7 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         result = storageReadMove(
             storageInterfaceNewReadP(
                 this->driver, storagePathP(this, fileExp), param.ignoreMissing, .compressible = param.compressible,
-                .limit = param.limit),
+                .offset = param.offset, .limit = param.limit),
             memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
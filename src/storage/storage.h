@@ -45,7 +45,7 @@ typedef enum
     // Does the storage support hardlinks?  Hardlinks allow the same file to be linked into multiple paths to save space.
     storageFeatureHardLink,
 
-    // Can the storage limit the amount of data read from a file?
+    // Can the storage read a range of a file, i.e. start reading at an offset and/or limit the amount of data read?
     storageFeatureLimitRead,
 
     // Does the storage support symlinks?  Symlinks allow paths/files/links to be accessed from another path.
@@ -64,6 +64,13 @@ Functions
 
 bool storageCopy(StorageRead *source, StorageWrite *destination);
 
+// Copy a file on the storage without moving the data through this process when the driver supports it. Falls back to storageCopy()
+// when the driver does not support copy or when the source/destination have filters or a read limit.
+#define storageCopyServerP(this, source, destination)                                                                              \
+    storageCopyServer(this, source, destination)
+
+void storageCopyServer(const Storage *this, StorageRead *source, StorageWrite *destination);
+
 // Does a file exist? This function is only for files, not paths.
 typedef struct StorageExistsParam
 {
@@ -122,6 +129,24 @@ typedef struct StorageInfoListParam
 bool storageInfoList(
     const Storage *this, const String *pathExp, StorageInfoListCallback callback, void *callbackData, StorageInfoListParam param);
 
+// Info for all files/paths in each path of a list (does not recurse). Storage that supports batching (e.g. remote) gets the info
+// for all paths in a single request. The index of the path in the list is passed to the callback. Missing paths are skipped.
+typedef void (*StorageInfoListMultiCallback)(void *callbackData, unsigned int pathIdx, const StorageInfo *info);
+
+typedef struct StorageInfoListMultiParam
+{
+    VAR_PARAM_HEADER;
+    StorageInfoLevel level;
+    SortOrder sortOrder;
+} StorageInfoListMultiParam;
+
+#define storageInfoListMultiP(this, pathExpList, callback, callbackData, ...)                                                      \
+    storageInfoListMulti(this, pathExpList, callback, callbackData, (StorageInfoListMultiParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+void storageInfoListMulti(
+    const Storage *this, const StringList *pathExpList, StorageInfoListMultiCallback callback, void *callbackData,
+    StorageInfoListMultiParam param);
+
 // Get a list of files from a directory
 typedef struct StorageListParam
 {
@@ -149,6 +174,9 @@ typedef struct StorageNewReadParam
     bool ignoreMissing;
     bool compressible;
 
+    // Offset to start reading the file at
+    uint64_t offset;
+
     // Limit bytes to read from the file (must be varTypeUInt64). NULL for no limit.
     const Variant *limit;
 } StorageNewReadParam;
@@ -5,7 +5,7 @@ Storage drivers are implemented using this interface.
 
 The interface has required and optional functions. Currently the optional functions are only implemented by the Posix driver which
 can store either a repository or a PostgreSQL cluster. Drivers that are intended to store repositories only need to implement the
-required functions.
+required functions, though they may also implement copy() when the storage can copy files without transferring the data.
 
 The behavior of required functions is further modified by storage features defined by the StorageFeature enum. Details are included
 in the description of each function.
@@ -30,6 +30,7 @@ Error messages
 #define STORAGE_ERROR_READ_CLOSE                                    "unable to close file '%s' after read"
 #define STORAGE_ERROR_READ_OPEN                                     "unable to open file '%s' for read"
 #define STORAGE_ERROR_READ_MISSING                                  "unable to open missing file '%s' for read"
+#define STORAGE_ERROR_READ_SEEK                                     "unable to seek to %" PRIu64 " in file '%s'"
 
 #define STORAGE_ERROR_INFO                                          "unable to get info for path/file '%s'"
 #define STORAGE_ERROR_INFO_MISSING                                  "unable to get info for missing path/file '%s'"
@@ -89,6 +90,9 @@ typedef struct StorageInterfaceNewReadParam
     // Is the file compressible? This is used when the file must be moved across a network and temporary compression is helpful.
     bool compressible;
 
+    // Offset to start reading the file at
+    uint64_t offset;
+
     // Limit bytes read from the file. NULL for no limit.
     const Variant *limit;
 } StorageInterfaceNewReadParam;
@@ -195,6 +199,39 @@ typedef void StorageInterfaceRemove(void *thisVoid, const String *file, StorageI
 /***********************************************************************************************************************************
 Optional interface functions
 ***********************************************************************************************************************************/
+// Copy a file without moving the data through the client, e.g. S3 CopyObject or copy_file_range(). The source and destination are
+// on the same storage and have no filters so the content must be copied exactly.
+typedef struct StorageInterfaceCopyParam
+{
+    VAR_PARAM_HEADER;
+} StorageInterfaceCopyParam;
+
+typedef void StorageInterfaceCopy(void *thisVoid, StorageRead *source, StorageWrite *destination, StorageInterfaceCopyParam param);
+
+#define storageInterfaceCopyP(thisVoid, source, destination, ...)                                                                  \
+    STORAGE_COMMON_INTERFACE(thisVoid).copy(                                                                                       \
+        thisVoid, source, destination, (StorageInterfaceCopyParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+// ---------------------------------------------------------------------------------------------------------------------------------
+// Get info for all paths/files in each path of a list (does not recurse). Drivers where each request has a high latency (e.g.
+// remote) should implement this so the info for all paths can be fetched at once. storageInterfaceInfoListP() is called for each
+// path when the driver does not implement this function.
+//
+// See storageInterfaceInfoP() for usage of the level parameter.
+typedef struct StorageInterfaceInfoListMultiParam
+{
+    VAR_PARAM_HEADER;
+} StorageInterfaceInfoListMultiParam;
+
+typedef void StorageInterfaceInfoListMulti(
+    void *thisVoid, const StringList *pathList, StorageInfoLevel level, StorageInfoListMultiCallback callback, void *callbackData,
+    StorageInterfaceInfoListMultiParam param);
+
+#define storageInterfaceInfoListMultiP(thisVoid, pathList, level, callback, callbackData, ...)                                     \
+    STORAGE_COMMON_INTERFACE(thisVoid).infoListMulti(                                                                              \
+        thisVoid, pathList, level, callback, callbackData, (StorageInterfaceInfoListMultiParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+// ---------------------------------------------------------------------------------------------------------------------------------
 // Move a path/file atomically
 typedef struct StorageInterfaceMoveParam
 {
@@ -251,6 +288,8 @@ typedef struct StorageInterface
     StorageInterfaceRemove *remove;
 
     // Optional functions
+    StorageInterfaceCopy *copy;
+    StorageInterfaceInfoListMulti *infoListMulti;
     StorageInterfaceMove *move;
     StorageInterfacePathCreate *pathCreate;
     StorageInterfacePathSync *pathSync;
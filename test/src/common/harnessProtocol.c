@@ -0,0 +1,188 @@
+/***********************************************************************************************************************************
+Protocol Test Harness
+***********************************************************************************************************************************/
+#include <string.h>
+
+#include "common/type/json.h"
+#include "common/type/keyValue.h"
+#include "common/type/pack.h"
+#include "protocol/client.h"
+#include "protocol/frame.h"
+#include "storage/remote/protocol.h"
+
+#include "common/harnessProtocol.h"
+
+/***********************************************************************************************************************************
+Render frame data as JSON
+***********************************************************************************************************************************/
+static String *
+hrnProtocolFrameRender(ProtocolFrame frame)
+{
+    KeyValue *kv = kvNew();
+    size_t dataPos = 0;
+
+    switch (frame.type)
+    {
+        case protocolFrameTypeCommand:
+        {
+            kvPut(kv, VARSTR(PROTOCOL_KEY_COMMAND_STR), packReadVar(frame.data, &dataPos));
+
+            const Variant *paramList = packReadVar(frame.data, &dataPos);
+
+            if (paramList != NULL)
+                kvPut(kv, VARSTR(PROTOCOL_KEY_PARAMETER_STR), paramList);
+
+            break;
+        }
+
+        case protocolFrameTypeResponse:
+        {
+            const Variant *output = packReadVar(frame.data, &dataPos);
+
+            if (output != NULL)
+                kvPut(kv, VARSTR(PROTOCOL_OUTPUT_STR), output);
+
+            break;
+        }
+
+        case protocolFrameTypeError:
+        {
+            kvPut(kv, VARSTR(PROTOCOL_ERROR_STR), packReadVar(frame.data, &dataPos));
+
+            const Variant *message = packReadVar(frame.data, &dataPos);
+            const Variant *stack = packReadVar(frame.data, &dataPos);
+
+            if (message != NULL)
+                kvPut(kv, VARSTR(PROTOCOL_OUTPUT_STR), message);
+
+            if (stack != NULL)
+                kvPut(kv, VARSTR(PROTOCOL_ERROR_STACK_STR), stack);
+
+            break;
+        }
+    }
+
+    if (dataPos != bufUsed(frame.data))
+        THROW_FMT(AssertError, "%zu byte(s) left over after rendering frame", bufUsed(frame.data) - dataPos);
+
+    return jsonFromKv(kv);
+}
+
+/**********************************************************************************************************************************/
+String *
+hrnProtocolRead(IoRead *read)
+{
+    return hrnProtocolFrameRender(protocolFrameRead(read));
+}
+
+/**********************************************************************************************************************************/
+String *
+hrnProtocolRender(const Buffer *buffer)
+{
+    String *result = strNew("");
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const unsigned char *bufferPtr = bufPtrConst(buffer);
+        size_t bufferPos = 0;
+
+        while (bufferPos < bufUsed(buffer))
+        {
+            // Render frames as JSON
+            if (protocolFrameTypeValid(bufferPtr[bufferPos]))
+            {
+                if (bufUsed(buffer) - bufferPos < PROTOCOL_FRAME_HEADER_SIZE)
+                    THROW(AssertError, "incomplete frame header");
+
+                const unsigned char *header = bufferPtr + bufferPos;
+                size_t size = (size_t)header[1] << 24 | (size_t)header[2] << 16 | (size_t)header[3] << 8 | (size_t)header[4];
+                bufferPos += PROTOCOL_FRAME_HEADER_SIZE;
+
+                if (bufUsed(buffer) - bufferPos < size)
+                    THROW(AssertError, "incomplete frame");
+
+                strCat(
+                    result,
+                    strPtr(
+                        hrnProtocolFrameRender(
+                            (ProtocolFrame){.type = (ProtocolFrameType)header[0], .data = bufNewC(bufferPtr + bufferPos, size)})));
+                strCat(result, "\n");
+
+                bufferPos += size;
+            }
+            // Else copy the line
+            else
+            {
+                const unsigned char *lineEnd = memchr(bufferPtr + bufferPos, '\n', bufUsed(buffer) - bufferPos);
+                size_t lineSize = lineEnd == NULL ? bufUsed(buffer) - bufferPos : (size_t)(lineEnd - bufferPtr) - bufferPos + 1;
+                const String *line = strNewN((const char *)bufferPtr + bufferPos, lineSize);
+
+                strCat(result, strPtr(line));
+                bufferPos += lineSize;
+
+                // Copy the block that follows a block header
+                if (lineEnd != NULL && strBeginsWithZ(line, PROTOCOL_BLOCK_HEADER))
+                {
+                    ssize_t blockSize = storageRemoteProtocolBlockSize(strSubN(line, 0, lineSize - 1));
+
+                    if (blockSize > 0)
+                    {
+                        if (bufUsed(buffer) - bufferPos < (size_t)blockSize)
+                            THROW(AssertError, "incomplete block");
+
+                        strCatZN(result, (const char *)bufferPtr + bufferPos, (size_t)blockSize);
+                        bufferPos += (size_t)blockSize;
+                    }
+                }
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    return result;
+}
+
+/**********************************************************************************************************************************/
+void
+hrnProtocolFrameWrite(IoWrite *write, const char *json)
+{
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        KeyValue *kv = jsonToKv(STR(json));
+        Buffer *data = bufNew(0);
+        ProtocolFrameType type;
+
+        // Command
+        if (kvGet(kv, VARSTR(PROTOCOL_KEY_COMMAND_STR)) != NULL)
+        {
+            type = protocolFrameTypeCommand;
+            packCatVar(data, kvGet(kv, VARSTR(PROTOCOL_KEY_COMMAND_STR)));
+            packCatVar(data, kvGet(kv, VARSTR(PROTOCOL_KEY_PARAMETER_STR)));
+        }
+        // Error
+        else if (kvGet(kv, VARSTR(PROTOCOL_ERROR_STR)) != NULL)
+        {
+            type = protocolFrameTypeError;
+            packCatVar(data, VARINT(varIntForce(kvGet(kv, VARSTR(PROTOCOL_ERROR_STR)))));
+            packCatVar(data, kvGet(kv, VARSTR(PROTOCOL_OUTPUT_STR)));
+            packCatVar(data, kvGet(kv, VARSTR(PROTOCOL_ERROR_STACK_STR)));
+        }
+        // Response
+        else
+        {
+            type = protocolFrameTypeResponse;
+            packCatVar(data, kvGet(kv, VARSTR(PROTOCOL_OUTPUT_STR)));
+        }
+
+        protocolFrameWrite(write, type, data);
+    }
+    MEM_CONTEXT_TEMP_END();
+}
+
+/**********************************************************************************************************************************/
+void
+hrnProtocolWrite(IoWrite *write, const char *json)
+{
+    hrnProtocolFrameWrite(write, json);
+    ioWriteFlush(write);
+}
@@ -0,0 +1,31 @@
+/***********************************************************************************************************************************
+Protocol Test Harness
+
+Helper functions for testing the protocol. Frames are binary so they are rendered as (and created from) JSON to make expected
+results readable, e.g. {"cmd":"noop"} for a command frame, {"out":true} for a response frame, and {"err":25,"out":"message"} for an
+error frame. A response frame with no output is rendered as {}.
+***********************************************************************************************************************************/
+#ifndef TEST_COMMON_HARNESS_PROTOCOL_H
+#define TEST_COMMON_HARNESS_PROTOCOL_H
+
+#include "common/io/read.h"
+#include "common/io/write.h"
+#include "common/type/buffer.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Read a frame and render it as JSON
+String *hrnProtocolRead(IoRead *read);
+
+// Render protocol output as text. Frames are rendered as lf-terminated JSON while lines and blocks are copied as is.
+String *hrnProtocolRender(const Buffer *buffer);
+
+// Create a frame from JSON and write it without flushing so several frames can be sent at once
+void hrnProtocolFrameWrite(IoWrite *write, const char *json);
+
+// Create a frame from JSON, write it, and flush
+void hrnProtocolWrite(IoWrite *write, const char *json);
+
+#endif
@@ -117,3 +117,18 @@ hrnStorageInfoListCallback(void *callbackData, const StorageInfo *info)
 
     strCat(data->content, "}\n");
 }
+
+/**********************************************************************************************************************************/
+void
+hrnStorageInfoListMultiCallback(void *callbackData, unsigned int pathIdx, const StorageInfo *info)
+{
+    HarnessStorageInfoListCallbackData *data = callbackData;
+
+    if (data->rootPathOmit && info->type == storageTypePath && strEq(info->name, DOT_STR))
+        return;
+
+    StorageInfo infoUpdate = *info;
+    infoUpdate.name = strNewFmt("%u:%s", pathIdx, strPtr(info->name));
+
+    hrnStorageInfoListCallback(callbackData, &infoUpdate);
+}
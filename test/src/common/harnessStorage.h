@@ -28,4 +28,7 @@ typedef struct HarnessStorageInfoListCallbackData
 
 void hrnStorageInfoListCallback(void *callbackData, const StorageInfo *info);
 
+// Prefixes each name with the path index, e.g. 1:file
+void hrnStorageInfoListMultiCallback(void *callbackData, unsigned int pathIdx, const StorageInfo *info);
+
 #endif
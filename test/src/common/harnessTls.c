@@ -11,6 +11,7 @@ TLS Test Harness
 
 #include "common/crypto/common.h"
 #include "common/error.h"
+#include "common/io/session.h"
 #include "common/io/socket/session.h"
 #include "common/io/tls/session.intern.h"
 #include "common/log.h"
@@ -29,10 +30,12 @@ typedef enum
 {
     hrnTlsCmdAbort,
     hrnTlsCmdAccept,
+    hrnTlsCmdAcceptPlain,
     hrnTlsCmdClose,
     hrnTlsCmdDone,
     hrnTlsCmdExpect,
     hrnTlsCmdReply,
+    hrnTlsCmdSession,
     hrnTlsCmdSleep,
 } HrnTlsCmd;
 
@@ -119,6 +122,16 @@ hrnTlsServerAccept(void)
     FUNCTION_HARNESS_RESULT_VOID();
 }
 
+void
+hrnTlsServerAcceptPlain(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    hrnTlsServerCommand(hrnTlsCmdAcceptPlain, NULL);
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
+
 void
 hrnTlsServerClose()
 {
@@ -185,6 +198,20 @@ hrnTlsServerReplyZ(const char *data)
     FUNCTION_HARNESS_RESULT_VOID();
 }
 
+void
+hrnTlsServerSession(unsigned int sessionIdx)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(UINT, sessionIdx);
+    FUNCTION_HARNESS_END();
+
+    ASSERT(sessionIdx < HRN_TLS_SESSION_MAX);
+
+    hrnTlsServerCommand(hrnTlsCmdSession, VARUINT(sessionIdx));
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
+
 void
 hrnTlsServerSleep(TimeMSec sleepMs)
 {
@@ -268,11 +295,12 @@ void hrnTlsServerRunParam(IoRead *read, const String *certificate, const String
         THROW_SYS_ERROR(AssertError, "unable to bind socket");
 
     // Listen for client connections
-    if (listen(serverSocket, 1) < 0)
+    if (listen(serverSocket, HRN_TLS_SESSION_MAX) < 0)
         THROW_SYS_ERROR(AssertError, "unable to listen on socket");
 
     // Loop until no more commands
-    TlsSession *serverSession = NULL;
+    IoSession *serverSessionList[HRN_TLS_SESSION_MAX] = {NULL};
+    unsigned int serverSessionIdx = 0;
     bool done = false;
 
     do
@@ -284,14 +312,14 @@ void hrnTlsServerRunParam(IoRead *read, const String *certificate, const String
         {
             case hrnTlsCmdAbort:
             {
-                tlsSessionClose(serverSession, false);
-                tlsSessionFree(serverSession);
-                serverSession = NULL;
+                ioSessionFree(serverSessionList[serverSessionIdx]);
+                serverSessionList[serverSessionIdx] = NULL;
 
                 break;
             }
 
             case hrnTlsCmdAccept:
+            case hrnTlsCmdAcceptPlain:
             {
                 struct sockaddr_in addr;
                 unsigned int len = sizeof(addr);
@@ -301,19 +329,25 @@ void hrnTlsServerRunParam(IoRead *read, const String *certificate, const String
                 if (testClientSocket < 0)
                     THROW_SYS_ERROR(AssertError, "unable to accept socket");
 
-                SSL *testClientSSL = SSL_new(serverContext);
+                SocketSession *socketSession = sckSessionNew(sckSessionTypeServer, testClientSocket, STRDEF("client"), 0, 5000);
 
-                serverSession = tlsSessionNew(
-                    testClientSSL, sckSessionNew(sckSessionTypeServer, testClientSocket, STRDEF("client"), 0, 5000), 5000);
+                // Plain sessions use the socket directly
+                if (cmd == hrnTlsCmdAcceptPlain)
+                    serverSessionList[serverSessionIdx] = sckSessionIoSession(socketSession);
+                else
+                {
+                    serverSessionList[serverSessionIdx] = tlsSessionIoSession(
+                        tlsSessionNew(SSL_new(serverContext), socketSession, 5000));
+                }
 
                 break;
             }
 
             case hrnTlsCmdClose:
             {
-                tlsSessionClose(serverSession, true);
-                tlsSessionFree(serverSession);
-                serverSession = NULL;
+                ioSessionClose(serverSessionList[serverSessionIdx]);
+                ioSessionFree(serverSessionList[serverSessionIdx]);
+                serverSessionList[serverSessionIdx] = NULL;
 
                 break;
             }
@@ -330,7 +364,7 @@ void hrnTlsServerRunParam(IoRead *read, const String *certificate, const String
                 const String *expected = varStr(data);
                 Buffer *buffer = bufNew(strSize(expected));
 
-                ioRead(tlsSessionIoRead(serverSession), buffer);
+                ioRead(ioSessionIoRead(serverSessionList[serverSessionIdx]), buffer);
 
                 // Treat any ? characters as wildcards so variable elements (e.g. auth hashes) can be ignored
                 String *actual = strNewBuf(buffer);
@@ -350,8 +384,15 @@ void hrnTlsServerRunParam(IoRead *read, const String *certificate, const String
 
             case hrnTlsCmdReply:
             {
-                ioWrite(tlsSessionIoWrite(serverSession), BUFSTR(varStr(data)));
-                ioWriteFlush(tlsSessionIoWrite(serverSession));
+                ioWrite(ioSessionIoWrite(serverSessionList[serverSessionIdx]), BUFSTR(varStr(data)));
+                ioWriteFlush(ioSessionIoWrite(serverSessionList[serverSessionIdx]));
+
+                break;
+            }
+
+            case hrnTlsCmdSession:
+            {
+                serverSessionIdx = varUIntForce(data);
 
                 break;
             }
@@ -20,6 +20,9 @@ TLS test defaults
 #define TLS_CERT_FAKE_PATH                                          "/etc/fake-cert"
 #define TLS_CERT_TEST_CERT                                          TLS_CERT_FAKE_PATH "/pgbackrest-test.crt"
 
+// Maximum concurrent server sessions
+#define HRN_TLS_SESSION_MAX                                         4
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -36,6 +39,9 @@ void hrnTlsServerAbort(void);
 // Accept new TLS connection
 void hrnTlsServerAccept(void);
 
+// Accept new plain socket connection (i.e. without TLS)
+void hrnTlsServerAcceptPlain(void);
+
 // Close the TLS connection
 void hrnTlsServerClose(void);
 
@@ -43,6 +49,9 @@ void hrnTlsServerClose(void);
 void hrnTlsServerExpect(const String *data);
 void hrnTlsServerExpectZ(const char *data);
 
+// Switch to the specified session. Commands apply to the current session so multiple concurrent connections can be tested.
+void hrnTlsServerSession(unsigned int sessionIdx);
+
 // Reply with the specfified string
 void hrnTlsServerReply(const String *data);
 void hrnTlsServerReplyZ(const char *data);
@@ -220,7 +220,7 @@ testRun(void)
     }
 
     // *****************************************************************************************************************************
-    if (testBegin("walSegmentFind()"))
+    if (testBegin("walSegmentFind() and walSegmentFindList()"))
     {
         // Load configuration to set repo-path and stanza
         StringList *argList = strLstNew();
@@ -282,6 +282,73 @@ testRun(void)
         TEST_RESULT_PTR(
             walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678.partial"), 0), NULL,
             "did not find partial segment");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("find a list of segments");
+
+        StringList *walSegmentList = strLstNew();
+        strLstAddZ(walSegmentList, "1234567812345678000000FE");
+        strLstAddZ(walSegmentList, "1234567812345678000000FF");
+        strLstAddZ(walSegmentList, "123456781234567900000000");
+        strLstAddZ(walSegmentList, "123456781234567900000001");
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(walSegmentFindList(storageRepo(), strNew("9.6-2"), walSegmentList, 0), "|"), "", "no segments");
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/1234567812345678000000FE-cccccccccccccccccccccccccccccccccccccccc.gz")),
+            NULL);
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/1234567812345678000000FF-dddddddddddddddddddddddddddddddddddddddd")),
+            NULL);
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345679/123456781234567900000001-ffffffffffffffffffffffffffffffffffffffff")),
+            NULL);
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(walSegmentFindList(storageRepo(), strNew("9.6-2"), walSegmentList, 0), "|"),
+            "1234567812345678000000FE-cccccccccccccccccccccccccccccccccccccccc.gz|"
+                "1234567812345678000000FF-dddddddddddddddddddddddddddddddddddddddd",
+            "leading segments found");
+
+        TEST_ERROR(
+            walSegmentFindList(storageRepo(), strNew("9.6-2"), walSegmentList, 100), ArchiveTimeoutError,
+            "WAL segment 123456781234567900000000 was not archived before the 100ms timeout\n"
+            "HINT: check the archive_command to ensure that all options are correct (especially --stanza).\n"
+            "HINT: check the PostgreSQL server log for errors.");
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345679/123456781234567900000000-eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee")),
+            NULL);
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(walSegmentFindList(storageRepo(), strNew("9.6-2"), walSegmentList, 100), "|"),
+            "1234567812345678000000FE-cccccccccccccccccccccccccccccccccccccccc.gz|"
+                "1234567812345678000000FF-dddddddddddddddddddddddddddddddddddddddd|"
+                "123456781234567900000000-eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee|"
+                "123456781234567900000001-ffffffffffffffffffffffffffffffffffffffff",
+            "all segments found");
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345679/123456781234567900000001-0000000000000000000000000000000000000000.gz")),
+            NULL);
+
+        TEST_ERROR(
+            walSegmentFindList(storageRepo(), strNew("9.6-2"), walSegmentList, 0), ArchiveDuplicateError,
+            "duplicates found in archive for WAL segment 123456781234567900000001:"
+                " 123456781234567900000001-0000000000000000000000000000000000000000.gz"
+                ", 123456781234567900000001-ffffffffffffffffffffffffffffffffffffffff"
+                "\nHINT: are multiple primaries archiving to this stanza?");
     }
 
     // *****************************************************************************************************************************
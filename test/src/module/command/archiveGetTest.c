@@ -2,15 +2,18 @@
 Test Archive Get Command
 ***********************************************************************************************************************************/
 #include "common/compress/helper.h"
+#include "common/compress/zst/common.h"
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/wait.h"
 #include "postgres/interface.h"
 #include "postgres/version.h"
 #include "storage/posix/storage.h"
 
 #include "common/harnessInfo.h"
+#include "common/harnessProtocol.h"
 
 /***********************************************************************************************************************************
 Test Run
@@ -212,6 +215,56 @@ testRun(void)
         TEST_RESULT_BOOL(storageExistsP(storageTest, walDestination), true, "  check exists");
         TEST_RESULT_UINT(storageInfoP(storageTest, walDestination).size, 16 * 1024 * 1024, "  check size");
 
+#ifdef HAVE_LIBZST
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("WAL segment compressed with a dictionary");
+
+        storageRemoveP(
+            storageTest,
+            strNew("repo/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.gz"),
+            .errorOnMissing = true);
+        storageRemoveP(storageTest, walDestination, .errorOnMissing = true);
+
+        // Train a dictionary from WAL-like content
+        Buffer *sample = bufNew(1024 * 1024);
+
+        while (bufUsed(sample) < bufSize(sample))
+        {
+            char record[128];
+            size_t recordSize = (size_t)snprintf(
+                record, sizeof(record), "rmgr: Heap len: %zu, tx: %zu, lsn: 0/%08zX, desc: INSERT off %zu\n",
+                bufUsed(sample) % 113, bufUsed(sample) / 7, bufUsed(sample), bufUsed(sample) % 17);
+
+            bufCat(sample, BUF(record, recordSize > bufRemains(sample) ? bufRemains(sample) : recordSize));
+        }
+
+        Buffer *dictionary = zstDictTrain(sample, ARCHIVE_DICT_SAMPLE_SIZE, ARCHIVE_DICT_SIZE);
+
+        destination = storageNewWriteP(
+            storageTest, strNewFmt("repo/archive/test1/" ARCHIVE_DICT_FILE_PREFIX "%u", zstDictId(dictionary)));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(destination)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("worstpassphraseever"), NULL));
+        storagePutP(destination, dictionary);
+
+        destination = storageNewWriteP(
+            storageTest,
+            strNew(
+                "repo/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.zst"));
+
+        filterGroup = ioWriteFilterGroup(storageWriteIo(destination));
+        ioFilterGroupAdd(filterGroup, compressFilterDict(compressTypeZst, 3, dictionary));
+        ioFilterGroupAdd(
+            filterGroup, cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("worstpassphraseever"), NULL));
+        storagePutP(destination, sample);
+
+        TEST_RESULT_INT(
+            archiveGetFile(
+                storageTest, archiveFile, walDestination, false, cipherTypeAes256Cbc, strNew("12345678")), 0, "WAL segment copied");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storageTest, walDestination)), sample), true, "  check contents");
+#endif // HAVE_LIBZST
+
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
@@ -232,7 +285,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             archiveGetProtocol(PROTOCOL_COMMAND_ARCHIVE_GET_STR, paramList, server), true, "protocol archive get");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":0}\n", "check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":0}\n", "check result");
         TEST_RESULT_BOOL(
             storageExistsP(storageTest, strNewFmt("spool/archive/test1/in/%s", strPtr(archiveFile))), true, "  check exists");
 
@@ -311,6 +364,17 @@ testRun(void)
         TEST_RESULT_STR_Z(
             strLstJoin(strLstSort(storageListP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_IN)), sortOrderAsc), "|"),
             "000000010000000A00000FFE|000000010000000A00000FFF", "check queue");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("prefetch queue total");
+
+        TEST_RESULT_UINT(queuePrefetchTotal(0, 500, 8), 0, "nothing consumed yet");
+        TEST_RESULT_UINT(queuePrefetchTotal(10000, 500, 8), 2, "slow consumption");
+        TEST_RESULT_UINT(queuePrefetchTotal(200, 500, 8), 7, "fast consumption");
+        TEST_RESULT_UINT(queuePrefetchTotal(10, 500, 8), 8, "consumption faster than queue max");
+
+        TEST_RESULT_UINT(queuePrefetchTimeAvg(0, 100), 100, "first sample");
+        TEST_RESULT_UINT(queuePrefetchTimeAvg(100, 300), 200, "average sample");
     }
 
 
@@ -359,9 +423,10 @@ testRun(void)
                 "[db:history]\n"
                 "1={\"db-id\":18072658121562454734,\"db-version\":\"10\"}\n"));
 
-        // Get a single segment
+        // Get a single segment. Nothing is consumed so prefetch stops at the first check of the queue.
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstDup(argCleanList);
+        strLstAddZ(argList, "--" CFGOPT_ARCHIVE_TIMEOUT "=0.1");
         strLstAddZ(argList, "000000010000000100000001");
         harnessCfgLoadRole(cfgCmdArchiveGet, cfgCmdRoleAsync, argList);
 
@@ -380,12 +445,156 @@ testRun(void)
         TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async");
         harnessLogResult(
             "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000001\n"
-            "P01 DETAIL: found 000000010000000100000001 in the archive");
+            "P01 DETAIL: found 000000010000000100000001 in the archive\n"
+            "P00 DETAIL: no WAL consumed from the queue, stop prefetch");
 
         TEST_RESULT_BOOL(
             storageExistsP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001")), true,
             "check 000000010000000100000001 in spool");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("prefetch WAL segments as they are consumed");
+
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/global.error"), .errorOnMissing = true);
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001"), .errorOnMissing = true);
+
+        argList = strLstDup(argCleanList);
+        strLstAddZ(argList, "--" CFGOPT_ARCHIVE_GET_QUEUE_MAX "=32MB");
+        strLstAddZ(argList, "000000010000000100000001");
+        harnessCfgLoadRole(cfgCmdArchiveGet, cfgCmdRoleAsync, argList);
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew(
+                    "repo/archive/test2/10-1/0000000100000001/"
+                        "000000010000000100000002-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                // Consume the WAL segment once it has been fetched by the async process
+                Wait *wait = waitNew(5000);
+
+                while (
+                    !storageExistsP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001")) &&
+                    waitMore(wait));
+
+                storageRemoveP(
+                    storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001"), .errorOnMissing = true);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        harnessLogResult(
+            "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000001\n"
+            "P01 DETAIL: found 000000010000000100000001 in the archive\n"
+            "P00   INFO: get 2 WAL file(s) from archive: 000000010000000100000002...000000010000000100000003\n"
+            "P01 DETAIL: found 000000010000000100000002 in the archive\n"
+            "P01 DETAIL: unable to find 000000010000000100000003 in the archive");
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(strLstSort(storageListP(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR), sortOrderAsc), "|"),
+            "000000010000000100000002|000000010000000100000003.ok", "check spool");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("stop prefetch when a WAL segment outside the queue is pending");
+
+        argList = strLstDup(argCleanList);
+        strLstAddZ(argList, "000000010000000100000002");
+        harnessCfgLoadRole(cfgCmdArchiveGet, cfgCmdRoleAsync, argList);
+
+        storageRemoveP(
+            storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000003.ok"), .errorOnMissing = true);
+        storagePutP(
+            storageNewWriteP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000003.pending")), NULL);
+        storagePutP(
+            storageNewWriteP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000020000000100000002.pending")), NULL);
+
+        TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async");
+        harnessLogResult(
+            "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000002\n"
+            "P01 DETAIL: found 000000010000000100000002 in the archive\n"
+            "P00 DETAIL: 000000020000000100000002 is not in the prefetch queue");
+
+        storageRemoveP(
+            storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000003.pending"), .errorOnMissing = true);
+        storageRemoveP(
+            storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000020000000100000002.pending"), .errorOnMissing = true);
+        storageRemoveP(
+            storageTest,
+            STRDEF("repo/archive/test2/10-1/0000000100000001/000000010000000100000002-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd"),
+            .errorOnMissing = true);
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000002"), .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("WAL segments kept in the spool are counted when consumed");
+
+        argList = strLstDup(argCleanList);
+        strLstAddZ(argList, "--" CFGOPT_ARCHIVE_GET_QUEUE_MAX "=32MB");
+        strLstAddZ(argList, "000000010000000100000002");
+        harnessCfgLoadRole(cfgCmdArchiveGet, cfgCmdRoleAsync, argList);
+
+        storagePutP(storageNewWriteP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001")), NULL);
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                STRDEF(
+                    "repo/archive/test2/10-1/0000000100000001/"
+                        "000000010000000100000002-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                // Consume the kept WAL segment once the requested WAL segment has been fetched
+                Wait *wait = waitNew(5000);
+
+                while (
+                    !storageExistsP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000002")) &&
+                    waitMore(wait));
+
+                storageRemoveP(
+                    storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001"), .errorOnMissing = true);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        harnessLogResult(
+            "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000002\n"
+            "P01 DETAIL: found 000000010000000100000002 in the archive\n"
+            "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000003\n"
+            "P01 DETAIL: unable to find 000000010000000100000003 in the archive");
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(strLstSort(storageListP(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR), sortOrderAsc), "|"),
+            "000000010000000100000002|000000010000000100000003.ok", "check spool");
+
+        storageRemoveP(
+            storageTest,
+            STRDEF("repo/archive/test2/10-1/0000000100000001/000000010000000100000002-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd"),
+            .errorOnMissing = true);
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000002"), .errorOnMissing = true);
+        storageRemoveP(
+            storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000003.ok"), .errorOnMissing = true);
+
         // Get multiple segments where some are missing or errored
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstDup(argCleanList);
@@ -719,6 +928,47 @@ testRun(void)
 
         harnessLogResult("P01   INFO: unable to find 000000010000000100000001 in the archive");
 
+        TEST_RESULT_BOOL(
+            storageExistsP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001.pending")), false,
+            "pending file was removed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("pending file is removed when the WAL segment arrives");
+
+        storageRemoveP(storageTest, walFile, .errorOnMissing = true);
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                TEST_RESULT_INT(cmdArchiveGet(), 0, "successful get after pending");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                // Write the WAL segment once archive-get has let the async process know it is waiting
+                Wait *wait = waitNew(5000);
+
+                while (
+                    !storageExistsP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001.pending")) &&
+                    waitMore(wait));
+
+                storagePutP(
+                    storageNewWriteP(storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s", strPtr(walSegment))),
+                    BUFSTRDEF("SHOULD-BE-A-REAL-WAL-FILE"));
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        harnessLogResult("P01   INFO: found 000000010000000100000001 in the archive");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001.pending")), false,
+            "pending file was removed");
+        TEST_RESULT_BOOL(storageExistsP(storageTest, walFile), true, "check WAL segment was moved");
+
         // -------------------------------------------------------------------------------------------------------------------------
         strLstAddZ(argList, BOGUS_STR);
         harnessCfgLoadRaw(strLstSize(argList), strLstPtr(argList));
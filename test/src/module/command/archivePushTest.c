@@ -12,6 +12,34 @@ Test Archive Push Command
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
 #include "common/harnessInfo.h"
+#include "common/harnessProtocol.h"
+
+#ifdef HAVE_LIBZST
+
+/***********************************************************************************************************************************
+Generate a WAL segment with repeated content that is suitable for training a compression dictionary
+***********************************************************************************************************************************/
+static Buffer *
+testWalDict(PgWal pgWal)
+{
+    Buffer *result = bufNew((size_t)16 * 1024 * 1024);
+
+    while (bufUsed(result) < bufSize(result))
+    {
+        char record[128];
+        size_t recordSize = (size_t)snprintf(
+            record, sizeof(record), "rmgr: Heap len: %zu, tx: %zu, lsn: 0/%08zX, desc: INSERT off %zu, blkref #0: blk %zu\n",
+            bufUsed(result) % 113, bufUsed(result) / 7, bufUsed(result), bufUsed(result) % 17, bufUsed(result) / 8192);
+
+        bufCat(result, BUF(record, recordSize > bufRemains(result) ? bufRemains(result) : recordSize));
+    }
+
+    pgWalTestToBuffer(pgWal, result);
+
+    return result;
+}
+
+#endif // HAVE_LIBZST
 
 /***********************************************************************************************************************************
 Test Run
@@ -35,7 +63,7 @@ testRun(void)
     bufUsedSet(serverWrite, 0);
 
     // *****************************************************************************************************************************
-    if (testBegin("archivePushReadyList(), archivePushProcessList(), and archivePushDrop()"))
+    if (testBegin("archivePushReadyList(), archivePushProcessList(), archivePushDrop(), and archivePushWatchReady()"))
     {
         StringList *argList = strLstNew();
         strLstAddZ(argList, "--stanza=db");
@@ -105,6 +133,53 @@ testRun(void)
         TEST_RESULT_BOOL(
             archivePushDrop(strNew("pg_wal"), archivePushProcessList(strNewFmt("%s/db/pg_wal", testPath()))), true,
             "wal is dropped");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("watch archive_status for ready files");
+
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argList);
+        const String *walPath = strNewFmt("%s/db/pg_wal", testPath());
+
+        TEST_RESULT_INT(archivePushWatchNew(strNewFmt("%s/db/bogus", testPath())), -1, "unable to watch missing path");
+
+        int watchHandle = -1;
+        TEST_ASSIGN(watchHandle, archivePushWatchNew(walPath), "watch archive_status");
+        TEST_RESULT_BOOL(watchHandle != -1, true, "watch is active");
+
+        TEST_RESULT_STR_Z(strLstJoin(archivePushWatchReady(watchHandle, walPath, 0), "|"), "", "no ready files");
+
+        // WAL 8 has already been pushed and WAL 9 is acknowledged before the events are read
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000008.ready")), NULL);
+        storagePutP(
+            storageNewWriteP(storageSpoolWrite(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000008.ok")), NULL);
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000007.ready")), NULL);
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000009.ready")), NULL);
+        storageRemoveP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000009.ready"), .errorOnMissing = true);
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000001.done")), NULL);
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(archivePushWatchReady(watchHandle, walPath, 1000), "|"), "000000010000000100000007", "ready files");
+
+        // PostgreSQL acknowledges WAL 8 so the ok file is removed
+        storageMoveP(
+            storagePgWrite(),
+            storageNewReadP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000008.ready")),
+            storageNewWriteP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000008.done")));
+
+        TEST_RESULT_STR_Z(strLstJoin(archivePushWatchReady(watchHandle, walPath, 1000), "|"), "", "no ready files");
+        TEST_RESULT_BOOL(
+            storageExistsP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000008.ok")), false,
+            "ok file removed");
+
+        close(watchHandle);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("list archive_status when watch is not available");
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(archivePushWatchReady(-1, walPath, 0), "|"),
+            "000000010000000100000002|000000010000000100000005|000000010000000100000006|000000010000000100000007",
+            "ready files");
     }
 
     // *****************************************************************************************************************************
@@ -362,11 +437,12 @@ testRun(void)
         varLstAdd(paramList, NULL);
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewInt(6));
+        varLstAdd(paramList, varNewBool(false));
 
         TEST_RESULT_BOOL(
             archivePushProtocol(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR, paramList, server), true, "protocol archive put");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             "{\"out\":\"WAL file '000000010000000100000002' already exists in the archive with the same checksum"
                 "\\nHINT: this is valid in some recovery scenarios but may also indicate a problem.\"}\n",
             "check result");
@@ -418,6 +494,128 @@ testRun(void)
                     "repo/archive/test/11-1/0000000100000001/000000010000000100000002-%s",
                     TEST_64BIT() ? "edad2f5a9d8a03ee3c09e8ce92c771e0d20232f5" : "e7c81f5513e0c6e3f19b9dbfc450019165994dda")),
             true, "check repo for WAL file");
+
+#ifdef HAVE_LIBZST
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL segment that is not suitable for training a compression dictionary");
+
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "pg_wal/000000010000000100000003");
+        strLstAddZ(argListTemp, "--repo1-cipher-type=aes-256-cbc");
+        strLstAddZ(argListTemp, "--compress-type=zst");
+        strLstAddZ(argListTemp, "--" CFGOPT_ARCHIVE_COMPRESS_DICT);
+        setenv("PGBACKREST_REPO1_CIPHER_PASS", "badpassphrase", true);
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+        unsetenv("PGBACKREST_REPO1_CIPHER_PASS");
+
+        Buffer *walBuffer3 = bufNew(ARCHIVE_DICT_SAMPLE_SIZE);
+        bufUsedSet(walBuffer3, bufSize(walBuffer3));
+        memset(bufPtr(walBuffer3), 0, bufSize(walBuffer3));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_11, .systemId = 0xFACEFACEFACEFACE}, walBuffer3);
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/000000010000000100000003")), walBuffer3);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000003' to the archive");
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(storageListP(storageTest, STRDEF("repo/archive/test"), .expression = ARCHIVE_DICT_FILE_REGEXP_STR), "|"), "",
+            "no dictionary");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL segment with a compression dictionary");
+
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "pg_wal/000000010000000100000004");
+        strLstAddZ(argListTemp, "--repo1-cipher-type=aes-256-cbc");
+        strLstAddZ(argListTemp, "--compress-type=zst");
+        strLstAddZ(argListTemp, "--" CFGOPT_ARCHIVE_COMPRESS_DICT);
+        setenv("PGBACKREST_REPO1_CIPHER_PASS", "badpassphrase", true);
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+        unsetenv("PGBACKREST_REPO1_CIPHER_PASS");
+
+        Buffer *walBuffer4 = testWalDict((PgWal){.version = PG_VERSION_11, .systemId = 0xFACEFACEFACEFACE});
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/000000010000000100000004")), walBuffer4);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000004' to the archive");
+
+        const Buffer *dictionary = NULL;
+        TEST_ASSIGN(dictionary, archiveDict(cipherTypeAes256Cbc, STRDEF("badsubpassphrase")), "get dictionary");
+        TEST_RESULT_BOOL(dictionary != NULL, true, "    dictionary is cached");
+
+        const String *dictFile = strNewFmt(ARCHIVE_DICT_FILE_PREFIX "%u", zstDictId(dictionary));
+
+        TEST_RESULT_STR(
+            strLstJoin(storageListP(storageTest, STRDEF("repo/archive/test"), .expression = ARCHIVE_DICT_FILE_REGEXP_STR), "|"),
+            dictFile, "dictionary stored by id");
+
+        String *walSegmentFile = walSegmentFind(storageRepo(), STRDEF("11-1"), STRDEF("000000010000000100000004"), 0);
+
+        StorageRead *read = storageNewReadP(
+            storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/11-1/%s", strPtr(walSegmentFile)));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("badsubpassphrase"), NULL));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), decompressFilter(compressTypeZst));
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(read), walBuffer4), true, "decompress WAL segment with dictionary");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("load dictionary with the archive cipher pass from archive.info");
+
+        archiveDictLocal = (struct ArchiveDictLocal){0};
+        TEST_RESULT_VOID(archiveDictInit(cipherTypeAes256Cbc, NULL), "init without cipher pass");
+
+        read = storageNewReadP(storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/11-1/%s", strPtr(walSegmentFile)));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("badsubpassphrase"), NULL));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), decompressFilter(compressTypeZst));
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(read), walBuffer4), true, "decompress WAL segment with dictionary");
+        TEST_RESULT_STR_Z(archiveDictLocal.cipherPass, "badsubpassphrase", "    archive cipher pass loaded");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("dictionary with the lowest id is used when there is more than one");
+
+        storagePutP(
+            storageNewWriteP(storageTest, strNewFmt("repo/archive/test/" ARCHIVE_DICT_FILE_PREFIX "%u", zstDictId(dictionary) + 1)),
+            BUFSTRDEF("NOTADICTIONARY"));
+
+        archiveDictLocal = (struct ArchiveDictLocal){0};
+        TEST_RESULT_BOOL(
+            bufEq(archiveDict(cipherTypeAes256Cbc, STRDEF("badsubpassphrase")), dictionary), true, "lowest id dictionary");
+
+        StringList *walSourceList = strLstNew();
+        strLstAddZ(walSourceList, BOGUS_STR);
+
+        TEST_RESULT_BOOL(
+            bufEq(archiveDictTrain(walSourceList, cipherTypeAes256Cbc, STRDEF("badsubpassphrase")), dictionary), true,
+            "dictionary is not trained when it exists");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error when dictionary is missing");
+
+        storageRemoveP(storageTest, strNewFmt("repo/archive/test/%s", strPtr(dictFile)), .errorOnMissing = true);
+        archiveDictLocal = (struct ArchiveDictLocal){0};
+        archiveDictInit(cipherTypeAes256Cbc, STRDEF("badsubpassphrase"));
+
+        read = storageNewReadP(storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/11-1/%s", strPtr(walSegmentFile)));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("badsubpassphrase"), NULL));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), decompressFilter(compressTypeZst));
+
+        TEST_ERROR_FMT(
+            storageGetP(read), FormatError, "compression dictionary %u is not available", zstDictId(dictionary));
+
+        // Reset the dictionary so it will be loaded again
+        storageRemoveP(
+            storageTest, strNewFmt("repo/archive/test/" ARCHIVE_DICT_FILE_PREFIX "%u", zstDictId(dictionary) + 1),
+            .errorOnMissing = true);
+        archiveDictLocal = (struct ArchiveDictLocal){0};
+#endif // HAVE_LIBZST
     }
 
     // *****************************************************************************************************************************
@@ -566,6 +764,7 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         argListTemp = strLstDup(argList);
         strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000001", testPath()));
+        strLstAddZ(argListTemp, "--archive-timeout=3");
         harnessCfgLoad(cfgCmdArchivePush, argListTemp);
 
         storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000001.ready")), NULL);
@@ -588,6 +787,18 @@ testRun(void)
                     TEST_64BIT() ? "f81d63dd5e258cd607534f3531bbd71442797e37" : "02d228126281e8e102b35a2737e45a0527946296")),
             true, "check repo for WAL file");
 
+        // archive-get is able to launch its async process while the async process is watching archive_status
+        TEST_RESULT_BOOL(
+            lockAcquire(cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), lockTypeArchiveGet, 0, true), true,
+            "archive-get lock while watching");
+        lockRelease(true);
+
+        // Wait for the async process to stop watching archive_status and exit so it does not interfere with the tests below
+        TEST_RESULT_BOOL(
+            lockAcquire(cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgLockType(), 30000, true), true,
+            "async process exited");
+        lockRelease(true);
+
         // Direct tests of the async function
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
@@ -598,6 +809,7 @@ testRun(void)
         strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
         strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
         strLstAddZ(argList, "--log-subprocess");
+        strLstAddZ(argList, "--archive-timeout=0.1");
         harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argList);
 
         TEST_ERROR(cmdArchivePushAsync(), ParamRequiredError, "WAL path to push required");
@@ -672,7 +884,8 @@ testRun(void)
         TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
         harnessLogResult(
             "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000002\n"
-            "P01 DETAIL: pushed WAL file '000000010000000100000002' to the archive");
+            "P01 DETAIL: pushed WAL file '000000010000000100000002' to the archive\n"
+            "P00 DETAIL: stop watching archive_status for WAL files to push");
 
         TEST_RESULT_BOOL(
             storageExistsP(
@@ -700,7 +913,8 @@ testRun(void)
         harnessLogResult(
             "P00   INFO: push 2 WAL file(s) to archive: 000000010000000100000001...000000010000000100000002\n"
             "P00   WARN: dropped WAL file '000000010000000100000001' because archive queue exceeded 16MB\n"
-            "P00   WARN: dropped WAL file '000000010000000100000002' because archive queue exceeded 16MB");
+            "P00   WARN: dropped WAL file '000000010000000100000002' because archive queue exceeded 16MB\n"
+            "P00 DETAIL: stop watching archive_status for WAL files to push");
 
         TEST_RESULT_STR_Z(
             strNewBuf(
@@ -715,6 +929,58 @@ testRun(void)
         TEST_RESULT_STR_Z(
             strLstJoin(strLstSort(storageListP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc), "|"),
             "000000010000000100000001.ok|000000010000000100000002.ok", "check status files");
+
+#ifdef HAVE_LIBZST
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("train compression dictionary from the WAL segments to push");
+
+        storagePathRemoveP(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_OUT_STR, .recurse = true);
+        storagePathCreateP(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_OUT_STR);
+
+        storagePathRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status"), .recurse = true);
+        storagePathCreateP(storagePgWrite(), strNew("pg_xlog/archive_status"));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/00000001.history")), BUFSTRDEF("FAKEHISTORY"));
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/00000001.history.ready")), NULL);
+
+        storagePutP(
+            storageNewWriteP(storagePgWrite(), strNew("pg_xlog/000000010000000100000003")),
+            testWalDict((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}));
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000003.ready")), NULL);
+        storagePutP(
+            storageNewWriteP(storagePgWrite(), strNew("pg_xlog/000000010000000100000004")),
+            testWalDict((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}));
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000004.ready")), NULL);
+
+        argListTemp = strLstNew();
+        strLstAddZ(argListTemp, "--stanza=test");
+        strLstAddZ(argListTemp, "--compress-type=zst");
+        strLstAddZ(argListTemp, "--" CFGOPT_ARCHIVE_COMPRESS_DICT);
+        strLstAdd(argListTemp, strNewFmt("--spool-path=%s/spool", testPath()));
+        strLstAddZ(argListTemp, "--" CFGOPT_ARCHIVE_ASYNC);
+        strLstAdd(argListTemp, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAdd(argListTemp, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAddZ(argListTemp, "--log-subprocess");
+        strLstAddZ(argListTemp, "--archive-timeout=0.1");
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog", testPath()));
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argListTemp);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+
+        StringList *dictList = storageListP(storageTest, STRDEF("repo/archive/test"), .expression = ARCHIVE_DICT_FILE_REGEXP_STR);
+        TEST_RESULT_UINT(strLstSize(dictList), 1, "dictionary stored");
+
+        harnessLogResult(
+            strPtr(
+                strNewFmt(
+                    "P00   INFO: push 3 WAL file(s) to archive: 00000001.history...000000010000000100000004\n"
+                    "P00 DETAIL: trained WAL compression dictionary %s from 2 WAL segment(s)\n"
+                    "P01 DETAIL: pushed WAL file '00000001.history' to the archive\n"
+                    "P01 DETAIL: pushed WAL file '000000010000000100000003' to the archive\n"
+                    "P01 DETAIL: pushed WAL file '000000010000000100000004' to the archive\n"
+                    "P00 DETAIL: stop watching archive_status for WAL files to push",
+                    strPtr(strLstGet(dictList, 0)) + sizeof(ARCHIVE_DICT_FILE_PREFIX) - 1)));
+#endif // HAVE_LIBZST
         }
 
     FUNCTION_HARNESS_RESULT_VOID();
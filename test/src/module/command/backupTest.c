@@ -3,8 +3,10 @@ Test Backup Command
 ***********************************************************************************************************************************/
 #include <utime.h>
 
+#include "command/archive/common.h"
 #include "command/stanza/create.h"
 #include "command/stanza/upgrade.h"
+#include "common/compress/zst/common.h"
 #include "common/crypto/hash.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
@@ -15,6 +17,7 @@ Test Backup Command
 
 #include "common/harnessConfig.h"
 #include "common/harnessPq.h"
+#include "common/harnessProtocol.h"
 
 /***********************************************************************************************************************************
 Get a list of all files in the backup and a redacted version of the manifest that can be tested against a static string
@@ -525,7 +528,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - skip");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":[3,0,0,null,null]}\n", "    check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":[3,0,0,null,null]}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
         // Pg file missing - ignoreMissing=false
@@ -610,7 +613,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - pageChecksum");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             "{\"out\":[1,12,12,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",{\"align\":false,\"valid\":false}]}\n",
             "    check result");
         bufUsedSet(serverWrite, 0);
@@ -653,7 +656,9 @@ testRun(void)
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - noop");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[4,12,0,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",null]}\n", "    check result");
+            hrnProtocolRender(serverWrite),
+            "{\"out\":[4,12,0,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -795,7 +800,9 @@ testRun(void)
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - copy, compress");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n", "    check result");
+            hrnProtocolRender(serverWrite),
+            "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -817,6 +824,130 @@ testRun(void)
                 result.pageChecksumResult == NULL),
             true, "    copy zero file to repo success");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy WAL segment from the archive into the backup");
+
+        const String *archiveFile = STRDEF("000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.gz");
+        StorageWrite *write = storageNewWriteP(
+            storageRepoWrite(), strNewFmt(STORAGE_REPO_ARCHIVE "/9.4-1/%s", strPtr(archiveFile)));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressTypeGz, 3));
+        storagePutP(write, BUFSTRDEF("WALDATA"));
+
+        TEST_RESULT_UINT(
+            backupArchiveFile(
+                STRDEF("9.4-1"), archiveFile, NULL, STRDEF("pg_data/pg_xlog/000000010000000100000001"), compressTypeNone, 1,
+                backupLabel, cipherTypeNone, NULL),
+            7, "copy and decompress WAL segment");
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                storageGetP(
+                    storageNewReadP(
+                        storageRepo(),
+                        strNewFmt(STORAGE_REPO_BACKUP "/%s/pg_data/pg_xlog/000000010000000100000001", strPtr(backupLabel))))),
+            "WALDATA", "    check WAL segment in backup");
+
+        // Same compression so the WAL segment is copied as is
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStrZ("9.4-1"));          // archiveId
+        varLstAdd(paramList, varNewStr(archiveFile));       // archiveFile
+        varLstAdd(paramList, NULL);                         // archiveCipherPass
+        varLstAdd(paramList, varNewStrZ("pg_data/pg_xlog/000000010000000100000001"));   // repoFile
+        varLstAdd(paramList, varNewUInt(compressTypeGz));   // repoFileCompress
+        varLstAdd(paramList, varNewInt(3));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
+        varLstAdd(paramList, NULL);                         // cipherSubPass
+
+        TEST_RESULT_BOOL(
+            backupProtocol(PROTOCOL_COMMAND_BACKUP_ARCHIVE_FILE_STR, paramList, server), true, "protocol backup archive file");
+        TEST_RESULT_STR(
+            hrnProtocolRender(serverWrite),
+            strNewFmt(
+                "{\"out\":%" PRIu64 "}\n",
+                storageInfoP(storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/9.4-1/%s", strPtr(archiveFile))).size),
+            "    check result");
+        bufUsedSet(serverWrite, 0);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(storageNewReadP(storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/9.4-1/%s", strPtr(archiveFile)))),
+                storageGetP(
+                    storageNewReadP(
+                        storageRepo(),
+                        strNewFmt(STORAGE_REPO_BACKUP "/%s/pg_data/pg_xlog/000000010000000100000001.gz", strPtr(backupLabel))))),
+            true, "    check WAL segment copied as is");
+
+#ifdef HAVE_LIBZST
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("zst WAL segment compressed without a dictionary is copied as is when the repository has a dictionary");
+
+        Buffer *sample = bufNew(256 * 1024);
+
+        while (bufUsed(sample) < bufSize(sample))
+        {
+            bufCat(
+                sample,
+                BUFSTR(
+                    strNewFmt(
+                        "rmgr: Heap len: %zu, tx: %zu, lsn: 0/%08zX, desc: INSERT off %zu, blkref #0: blk %zu\n",
+                        bufUsed(sample) % 113, bufUsed(sample) / 7, bufUsed(sample), bufUsed(sample) % 17,
+                        bufUsed(sample) / 8192)));
+        }
+
+        bufUsedSet(sample, bufSize(sample));
+
+        Buffer *dictionary = zstDictTrain(sample, 1024, 8192);
+        storagePutP(
+            storageNewWriteP(
+                storageRepoWrite(), strNewFmt(STORAGE_REPO_ARCHIVE "/" ARCHIVE_DICT_FILE_PREFIX "%u", zstDictId(dictionary))),
+            dictionary);
+
+        archiveFile = STRDEF("000000010000000100000002-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.zst");
+        write = storageNewWriteP(storageRepoWrite(), strNewFmt(STORAGE_REPO_ARCHIVE "/9.4-1/%s", strPtr(archiveFile)));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressTypeZst, 3));
+        storagePutP(write, BUFSTRDEF("WALDATA"));
+
+        TEST_RESULT_UINT(
+            backupArchiveFile(
+                STRDEF("9.4-1"), archiveFile, NULL, STRDEF("pg_data/pg_xlog/000000010000000100000002"), compressTypeZst, 3,
+                backupLabel, cipherTypeNone, NULL),
+            storageInfoP(storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/9.4-1/%s", strPtr(archiveFile))).size,
+            "copy WAL segment");
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(storageNewReadP(storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/9.4-1/%s", strPtr(archiveFile)))),
+                storageGetP(
+                    storageNewReadP(
+                        storageRepo(),
+                        strNewFmt(STORAGE_REPO_BACKUP "/%s/pg_data/pg_xlog/000000010000000100000002.zst", strPtr(backupLabel))))),
+            true, "    check WAL segment copied as is");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("zst WAL segment compressed with a dictionary is recompressed without it");
+
+        archiveFile = STRDEF("000000010000000100000003-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.zst");
+        write = storageNewWriteP(storageRepoWrite(), strNewFmt(STORAGE_REPO_ARCHIVE "/9.4-1/%s", strPtr(archiveFile)));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilterDict(compressTypeZst, 3, dictionary));
+        storagePutP(write, BUFSTRDEF("WALDATA"));
+
+        TEST_RESULT_VOID(
+            backupArchiveFile(
+                STRDEF("9.4-1"), archiveFile, NULL, STRDEF("pg_data/pg_xlog/000000010000000100000003"), compressTypeZst, 3,
+                backupLabel, cipherTypeNone, NULL),
+            "recompress WAL segment");
+
+        const String *backupWalFile = strNewFmt(
+            STORAGE_REPO_BACKUP "/%s/pg_data/pg_xlog/000000010000000100000003.zst", strPtr(backupLabel));
+
+        TEST_RESULT_UINT(
+            compressDictIdFromFrame(compressTypeZst, storageGetP(storageNewReadP(storageRepo(), backupWalFile))), 0,
+            "    check WAL segment in backup has no dictionary");
+
+        StorageRead *read = storageNewReadP(storageRepo(), backupWalFile);
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), decompressFilter(compressTypeZst));
+
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(read)), "WALDATA", "    check WAL segment in backup");
+#endif // HAVE_LIBZST
+
         // Check invalid protocol function
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_BOOL(backupProtocol(strNew(BOGUS_STR), paramList, server), false, "invalid function");
@@ -914,7 +1045,9 @@ testRun(void)
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - recopy, encrypt");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n", "    check result");
+            hrnProtocolRender(serverWrite),
+            "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
     }
 
@@ -1404,6 +1537,68 @@ testRun(void)
         TEST_RESULT_LOG("P00 DETAIL: match file from prior backup host:log-test (0B, 100%)");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("backupArchiveFindNext()"))
+    {
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        harnessCfgLoad(cfgCmdBackup, argList);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("archive is not checked");
+
+        BackupArchiveFind archiveFind = {.archiveId = NULL};
+
+        TEST_RESULT_VOID(backupArchiveFindNext(&archiveFind), "no search");
+        TEST_RESULT_UINT(archiveFind.timeLast, 0, "    search time not set");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("find the last segment in a path and move to the next path");
+
+        archiveFind = (BackupArchiveFind)
+        {
+            .archiveId = STRDEF("9.4-1"),
+            .pgVersion = PG_VERSION_94,
+            .timeline = 1,
+            .walSegmentSize = 16 * 1024 * 1024,
+            .lsnNext = 0x1FF000000,
+            .archiveFileList = strLstNew(),
+        };
+
+        storagePutP(
+            storageNewWriteP(
+                storageRepoWrite(),
+                STRDEF(STORAGE_REPO_ARCHIVE "/9.4-1/0000000100000001000000FF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa")),
+            NULL);
+
+        TEST_RESULT_VOID(backupArchiveFindNext(&archiveFind), "search");
+        TEST_RESULT_STR_Z(
+            strLstJoin(archiveFind.archiveFileList, "|"), "0000000100000001000000FF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+            "    segment found");
+        TEST_RESULT_UINT(archiveFind.lsnNext, 0x200000000, "    next path");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("search is skipped until the interval has passed");
+
+        storagePutP(
+            storageNewWriteP(
+                storageRepoWrite(),
+                STRDEF(STORAGE_REPO_ARCHIVE "/9.4-1/000000010000000200000000-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb")),
+            NULL);
+
+        TEST_RESULT_VOID(backupArchiveFindNext(&archiveFind), "no search");
+        TEST_RESULT_UINT(strLstSize(archiveFind.archiveFileList), 1, "    no segment found");
+
+        archiveFind.timeLast = 0;
+
+        TEST_RESULT_VOID(backupArchiveFindNext(&archiveFind), "search");
+        TEST_RESULT_UINT(strLstSize(archiveFind.archiveFileList), 2, "    segment found");
+        TEST_RESULT_UINT(archiveFind.lsnNext, 0x201000000, "    next segment");
+    }
+
     // Offline tests should only be used to test offline functionality and errors easily tested in offline mode
     // *****************************************************************************************************************************
     if (testBegin("cmdBackup() offline"))
@@ -4,6 +4,8 @@ Test Common Command Routines
 #include <fcntl.h>
 #include <unistd.h>
 
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
 #include "storage/storage.h"
 #include "version.h"
 
@@ -121,7 +123,8 @@ testRun(void)
 
         cfgOptionSet(cfgOptLogTimestamp, cfgSourceParam, varNewBool(true));
 
-        httpClientNew(strNew("BOGUS"), 443, 1000, true, NULL, NULL);
+        httpClientNew(
+            tlsClientIoClient(tlsClientNew(sckClientNew(strNew("BOGUS"), 443, 1000), 1000, true, NULL, NULL, NULL, NULL)), 1000);
 
         harnessLogLevelSet(logLevelDetail);
 
@@ -129,7 +132,7 @@ testRun(void)
         hrnLogReplaceAdd("\\([0-9]+ms\\)", "[0-9]+", "TIME", false);
         TEST_RESULT_LOG(
             "P00 DETAIL: socket statistics: objects 1, sessions 0, retries 0\n"
-            "P00 DETAIL: tls statistics: objects 1, sessions 0, retries 0\n"
+            "P00 DETAIL: tls statistics: objects 1, sessions 0, resumes 0, retries 0\n"
             "P00   INFO: http statistics: objects 1, sessions 0, requests 0, retries 0, closes 0\n"
             "P00   INFO: archive-get command end: completed successfully ([TIME]ms)");
 
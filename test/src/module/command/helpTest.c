@@ -33,6 +33,7 @@ testRun(void)
         "    help            Get help.\n"
         "    info            Retrieve information about backups.\n"
         "    restore         Restore a database cluster.\n"
+        "    server          Serve remote requests via TLS.\n"
         "    stanza-create   Create the required stanza data.\n"
         "    stanza-delete   Delete a stanza.\n"
         "    stanza-upgrade  Upgrade a stanza.\n"
@@ -149,7 +150,12 @@ testRun(void)
             "  --buffer-size                    buffer size for file operations\n"
             "                                   [current=32768, default=1048576]\n"
             "  --cmd-ssh                        path to ssh client executable [default=ssh]\n"
+            "  --cmd-ssh-control-path           share SSH connections using this control\n"
+            "                                   socket path\n"
+            "  --cmd-ssh-control-persist        time to keep a shared SSH connection open\n"
+            "                                   [default=30]\n"
             "  --compress-level-network         network compression level [default=3]\n"
+            "  --compress-type-network          network compression type [default=gz]\n"
             "  --config                         pgBackRest configuration file\n"
             "                                   [default=/etc/pgbackrest/pgbackrest.conf]\n"
             "  --config-include-path            path to additional pgBackRest configuration\n"
@@ -163,6 +169,8 @@ testRun(void)
             "  --neutral-umask                  use a neutral umask [default=y]\n"
             "  --process-max                    max processes to use for compress/transfer\n"
             "                                   [default=1]\n"
+            "  --process-queue-max              max jobs to queue for each process\n"
+            "                                   [default=1]\n"
             "  --protocol-timeout               protocol timeout [default=1830]\n"
             "  --sck-keep-alive                 keep-alive enable [default=y]\n"
             "  --stanza                         defines the stanza\n"
@@ -188,6 +196,10 @@ testRun(void)
             "                                   [current=aes-256-cbc, default=none]\n"
             "  --repo-host                      repository host when operating remotely via\n"
             "                                   SSH [current=backup.example.net]\n"
+            "  --repo-host-ca-file              repository host TLS CA file when\n"
+            "                                   repo-host-type=tls\n"
+            "  --repo-host-cert-file            repository host TLS client certificate file\n"
+            "                                   when repo-host-type=tls\n"
             "  --repo-host-cmd                  pgBackRest exe path on the repository host\n"
             "  --repo-host-config               pgBackRest repository host configuration\n"
             "                                   file\n"
@@ -196,7 +208,11 @@ testRun(void)
             "                                   include path [default=/etc/pgbackrest/conf.d]\n"
             "  --repo-host-config-path          pgBackRest repository host configuration\n"
             "                                   path [default=/etc/pgbackrest]\n"
+            "  --repo-host-key-file             repository host TLS client key file when\n"
+            "                                   repo-host-type=tls\n"
             "  --repo-host-port                 repository host port when repo-host is set\n"
+            "  --repo-host-type                 repository host protocol type when repo-host\n"
+            "                                   is set [default=ssh]\n"
             "  --repo-host-user                 repository host user when repo-host is set\n"
             "                                   [default=pgbackrest]\n"
             "  --repo-path                      path where backups and archive are stored\n"
@@ -204,13 +220,20 @@ testRun(void)
             "  --repo-s3-bucket                 s3 repository bucket\n"
             "  --repo-s3-ca-file                s3 SSL CA File\n"
             "  --repo-s3-ca-path                s3 SSL CA Path\n"
+            "  --repo-s3-download-max           maximum concurrent S3 range downloads per\n"
+            "                                   file [default=4]\n"
             "  --repo-s3-endpoint               s3 repository endpoint\n"
             "  --repo-s3-host                   s3 repository host\n"
             "  --repo-s3-key                    s3 repository access key\n"
             "  --repo-s3-key-secret             s3 repository secret access key\n"
+            "  --repo-s3-list-max               maximum concurrent S3 list requests\n"
+            "                                   [default=4]\n"
             "  --repo-s3-port                   s3 repository port [default=443]\n"
             "  --repo-s3-region                 s3 repository region\n"
+            "  --repo-s3-tls                    use TLS for S3 connections [default=y]\n"
             "  --repo-s3-token                  s3 repository security token\n"
+            "  --repo-s3-upload-max             maximum concurrent S3 part uploads per file\n"
+            "                                   [default=4]\n"
             "  --repo-s3-uri-style              s3 URI Style [default=host]\n"
             "  --repo-s3-verify-tls             verify S3 server certificate [default=y]\n"
             "  --repo-type                      type of storage used for the repository\n"
@@ -294,7 +317,9 @@ testRun(void)
             "\n"
             "S3 repository host.\n"
             "\n"
-            "Connect to a host other than the end point. This is typically used for testing.\n",
+            "Connect to a host other than the end point. This is typically used for testing.\n"
+            "A host that begins with / is the path to a Unix socket, in which case the port\n"
+            "is ignored.\n",
             helpVersion));
 
         argList = strLstNew();
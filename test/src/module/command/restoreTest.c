@@ -12,6 +12,7 @@ Test Restore Command
 
 #include "common/harnessConfig.h"
 #include "common/harnessInfo.h"
+#include "common/harnessProtocol.h"
 #include "common/harnessStorage.h"
 
 /***********************************************************************************************************************************
@@ -343,7 +344,7 @@ testRun(void)
         varLstAdd(paramList, NULL);
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":true}\n", "    check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":true}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
         info = storageInfoP(storagePg(), strNew("protocol"));
@@ -374,7 +375,7 @@ testRun(void)
         varLstAdd(paramList, NULL);
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":false}\n", "    check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":false}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
         // Check invalid protocol function
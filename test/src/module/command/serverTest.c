@@ -0,0 +1,258 @@
+/***********************************************************************************************************************************
+Test Server Command
+***********************************************************************************************************************************/
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
+#include "common/type/json.h"
+#include "protocol/client.h"
+#include "protocol/helper.h"
+#include "storage/helper.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessConfig.h"
+#include "common/harnessFork.h"
+#include "common/harnessTls.h"
+
+/***********************************************************************************************************************************
+Open a session to the server and send the remote parameters
+***********************************************************************************************************************************/
+static TlsSession *
+testServerSession(const String *caFile, const String *certFile, const String *keyFile, const StringList *paramList)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(STRING, caFile);
+        FUNCTION_HARNESS_PARAM(STRING, certFile);
+        FUNCTION_HARNESS_PARAM(STRING, keyFile);
+        FUNCTION_HARNESS_PARAM(STRING_LIST, paramList);
+    FUNCTION_HARNESS_END();
+
+    TlsSession *result = tlsClientOpen(
+        tlsClientNew(sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 5000, true, caFile, NULL, certFile, keyFile));
+
+    ioWriteStrLine(tlsSessionIoWrite(result), jsonFromVar(varNewVarLst(varLstNewStrLst(paramList))));
+    ioWriteFlush(tlsSessionIoWrite(result));
+
+    FUNCTION_HARNESS_RESULT(TLS_SESSION, result);
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    Storage *storageTest = storagePosixNewP(strNew(testPath()), .write = true);
+
+    const String *caFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath());
+    const String *certFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-localhost.crt", testRepoPath());
+    const String *certOtherFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath());
+    const String *keyFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath());
+
+    // *****************************************************************************************************************************
+    if (testBegin("cmdServer()"))
+    {
+        // The repository is only configured on the server
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("server.conf")),
+            BUFSTR(strNewFmt("[global]\nrepo1-path=%s/repo\n", testPath())));
+        storagePutP(storageNewWriteP(storageTest, strNew("repo/server.txt")), NULL);
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                StringList *argList = strLstNew();
+                strLstAdd(argList, strNewFmt("--" CFGOPT_CONFIG "=%s/server.conf", testPath()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_PORT "=%u", hrnTlsServerPort()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_CA_FILE "=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_CERT_FILE "=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_KEY_FILE "=%s", strPtr(keyFile)));
+                strLstAddZ(argList, "--" CFGOPT_TLS_SERVER_AUTH "=localhost=db, db2");
+                harnessCfgLoad(cfgCmdServer, argList);
+
+                // Errors raised in the forked sessions are returned to the client so they do not need to be logged here
+                harnessLogLevelSet(logLevelOff);
+
+                TEST_RESULT_VOID(cmdServer(7), "server");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remote over tls uses the server configuration");
+
+                StringList *argList = strLstNew();
+                strLstAddZ(argList, "--stanza=db");
+                strLstAddZ(argList, "--protocol-timeout=10");
+                strLstAddZ(argList, "--repo1-host=localhost");
+                strLstAddZ(argList, "--" CFGOPT_REPO1_HOST_TYPE "=" PROTOCOL_REMOTE_HOST_TYPE_TLS);
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_PORT "=%u", hrnTlsServerPort()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_CA_FILE "=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_CERT_FILE "=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_KEY_FILE "=%s", strPtr(keyFile)));
+                strLstAddZ(argList, "--repo1-path=/bogus");
+                harnessCfgLoad(cfgCmdInfo, argList);
+
+                ProtocolClient *client = NULL;
+
+                TEST_ASSIGN(client, protocolRemoteGet(protocolStorageTypeRepo, 1), "get remote protocol");
+                TEST_RESULT_VOID(protocolClientNoOp(client), "noop");
+                TEST_RESULT_STR_Z(strLstJoin(storageListP(storageRepo(), NULL), ", "), "server.txt", "list server repo");
+                TEST_RESULT_VOID(protocolRemoteFree(1), "free remote");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("only the remote role is accepted");
+
+                StringList *paramList = strLstNew();
+                strLstAddZ(paramList, "--stanza=db");
+                strLstAddZ(paramList, CFGCMD_INFO);
+
+                TlsSession *session = testServerSession(caFile, certFile, keyFile, paramList);
+
+                TEST_ERROR(
+                    protocolClientNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)),
+                    CommandInvalidError, "raised from test: server only accepts the 'remote' role");
+
+                tlsSessionFree(session);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client cannot override the repository path");
+
+                paramList = strLstNew();
+                strLstAddZ(paramList, "--stanza=db");
+                strLstAddZ(paramList, "--repo1-path=/");
+                strLstAddZ(paramList, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+                session = testServerSession(caFile, certFile, keyFile, paramList);
+
+                TEST_ERROR(
+                    protocolClientNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)),
+                    OptionInvalidError, "raised from test: option 'repo1-path' is not allowed from the client");
+
+                tlsSessionFree(session);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client cannot override the configuration");
+
+                paramList = strLstNew();
+                strLstAddZ(paramList, "--stanza=db");
+                strLstAddZ(paramList, "--config=/bogus.conf");
+                strLstAddZ(paramList, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+                session = testServerSession(caFile, certFile, keyFile, paramList);
+
+                TEST_ERROR(
+                    protocolClientNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)),
+                    OptionInvalidError, "raised from test: option 'config' is not allowed from the client");
+
+                tlsSessionFree(session);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client is not authorized for the stanza");
+
+                paramList = strLstNew();
+                strLstAddZ(paramList, "--stanza=other");
+                strLstAddZ(paramList, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+                session = testServerSession(caFile, certFile, keyFile, paramList);
+
+                TEST_ERROR(
+                    protocolClientNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)),
+                    HostInvalidError, "raised from test: client 'localhost' is not authorized for stanza 'other'");
+
+                tlsSessionFree(session);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client is not authorized for all stanzas");
+
+                paramList = strLstNew();
+                strLstAddZ(paramList, CFGCMD_REPO_LS ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+                session = testServerSession(caFile, certFile, keyFile, paramList);
+
+                TEST_ERROR(
+                    protocolClientNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)),
+                    HostInvalidError, "raised from test: client 'localhost' is not authorized for all stanzas");
+
+                tlsSessionFree(session);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client is not authorized");
+
+                paramList = strLstNew();
+                strLstAddZ(paramList, "--stanza=db");
+                strLstAddZ(paramList, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+                session = testServerSession(caFile, certOtherFile, keyFile, paramList);
+
+                TEST_ERROR(
+                    protocolClientNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)),
+                    HostInvalidError, "raised from test: client '*.test.pgbackrest.org' is not authorized");
+
+                tlsSessionFree(session);
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                StringList *argList = strLstNew();
+                strLstAdd(argList, strNewFmt("--" CFGOPT_CONFIG "=%s/server.conf", testPath()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_PORT "=%u", hrnTlsServerPort()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_CA_FILE "=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_CERT_FILE "=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_KEY_FILE "=%s", strPtr(keyFile)));
+                strLstAddZ(argList, "--" CFGOPT_TLS_SERVER_AUTH "=localhost=db");
+                strLstAddZ(argList, "--" CFGOPT_TLS_SERVER_PROCESS_MAX "=1");
+                strLstAddZ(argList, "--" CFGOPT_IO_TIMEOUT "=1");
+                harnessCfgLoad(cfgCmdServer, argList);
+
+                harnessLogLevelSet(logLevelOff);
+
+                TEST_RESULT_VOID(cmdServer(2), "server");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("connection waits while the maximum processes are running and the idle connection times out");
+
+                SocketSession *sessionIdle = sckClientOpen(sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000));
+                TimeMSec timeBegin = timeMSec();
+
+                StringList *paramList = strLstNew();
+                strLstAddZ(paramList, "--stanza=other");
+                strLstAddZ(paramList, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+                TlsSession *session = testServerSession(caFile, certFile, keyFile, paramList);
+
+                TEST_ERROR(
+                    protocolClientNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)),
+                    HostInvalidError, "raised from test: client 'localhost' is not authorized for stanza 'other'");
+                TEST_RESULT_BOOL(timeMSec() - timeBegin >= 900, true, "waited for idle connection to time out");
+
+                tlsSessionFree(session);
+                sckSessionFree(sessionIdle);
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
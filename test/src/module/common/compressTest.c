@@ -2,6 +2,7 @@
 Test Compression
 ***********************************************************************************************************************************/
 #include "common/io/filter/group.h"
+#include "common/io/filter/size.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
 #include "common/io/io.h"
@@ -41,6 +42,22 @@ testCompress(IoFilter *compress, Buffer *decompressed, size_t inputSize, size_t
     return compressed;
 }
 
+#ifdef HAVE_LIBZST
+
+/***********************************************************************************************************************************
+Dictionary returned by testDictLoad()
+***********************************************************************************************************************************/
+static const Buffer *testDictLocal = NULL;
+
+static const Buffer *
+testDictLoad(unsigned int dictId)
+{
+    (void)dictId;
+    return testDictLocal;
+}
+
+#endif // HAVE_LIBZST
+
 /***********************************************************************************************************************************
 Decompress data
 ***********************************************************************************************************************************/
@@ -313,7 +330,8 @@ testRun(void)
         compress->flushing = true;
 
         TEST_RESULT_STR_Z(
-            zstCompressToLog(compress), "{level: 14, inputSame: true, inputOffset: 49, flushing: true}", "format object");
+            zstCompressToLog(compress), "{level: 14, dictId: 0, inputSame: true, inputOffset: 49, flushing: true}",
+            "format object");
 
         ZstDecompress *decompress = (ZstDecompress *)ioFilterDriver(zstDecompressNew());
 
@@ -324,6 +342,127 @@ testRun(void)
         TEST_RESULT_STR_Z(
             zstDecompressToLog(decompress), "{inputSame: true, inputOffset: 999, frameDone false, done: true}",
             "format object");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("zstDictTrain()");
+
+        TEST_RESULT_PTR(zstDictTrain(BUFSTRDEF("too small"), 4, 4096), NULL, "buffer too small to train");
+
+        // Build samples that have repeated content like WAL pages
+        Buffer *sample = bufNew(256 * 1024);
+
+        while (bufUsed(sample) < bufSize(sample))
+        {
+            bufCat(
+                sample,
+                BUFSTR(
+                    strNewFmt(
+                        "rmgr: Heap len (rec/tot): %zu/%zu, tx: %zu, lsn: 0/%08zX, desc: INSERT off %zu flags 0x00, blkref #0: "
+                            "rel 1663/13580/16384 blk %zu\n",
+                        bufUsed(sample) % 113, bufUsed(sample) % 127, bufUsed(sample) / 7, bufUsed(sample), bufUsed(sample) % 17,
+                        bufUsed(sample) / 8192)));
+        }
+
+        bufUsedSet(sample, bufSize(sample));
+
+        Buffer *dictionary = NULL;
+        TEST_ASSIGN(dictionary, zstDictTrain(sample, 1024, 8192), "train dictionary");
+        TEST_RESULT_BOOL(dictionary != NULL, true, "    dictionary trained");
+        TEST_RESULT_BOOL(zstDictId(dictionary) != 0, true, "    dictionary has id");
+
+        Buffer *dictionaryOther = NULL;
+        TEST_ASSIGN(dictionaryOther, zstDictTrain(sample, 1024, 4096), "train other dictionary");
+        TEST_RESULT_BOOL(zstDictId(dictionaryOther) != zstDictId(dictionary), true, "    dictionary ids differ");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress/decompress with dictionary");
+
+        Buffer *compressedDict = NULL;
+        TEST_ASSIGN(
+            compressedDict, testCompress(compressFilterDict(compressTypeZst, 1, dictionary), sample, 1024, 1024),
+            "compress with dictionary");
+
+        Buffer *samplePage = bufNewC(bufPtr(sample), 1024);
+
+        TEST_RESULT_BOOL(
+            bufUsed(testCompress(compressFilterDict(compressTypeZst, 1, dictionary), samplePage, 1024, 1024)) <
+                bufUsed(testCompress(compressFilterDict(compressTypeZst, 1, NULL), samplePage, 1024, 1024)),
+            true, "    page is smaller than without dictionary");
+
+        TEST_ERROR_FMT(
+            testDecompress(decompressFilter(compressTypeZst), compressedDict, 1024, 1024), FormatError,
+            "compression dictionary %u is not available", zstDictId(dictionary));
+
+        compressDictLoadSet(testDictLoad);
+        testDictLocal = dictionaryOther;
+
+        TEST_ERROR_FMT(
+            testDecompress(decompressFilter(compressTypeZst), compressedDict, 1024, 1024), FormatError,
+            "zst dictionary %u does not match dictionary %u required by frame", zstDictId(dictionaryOther),
+            zstDictId(dictionary));
+
+        testDictLocal = dictionary;
+
+        TEST_RESULT_BOOL(
+            bufEq(testDecompress(decompressFilter(compressTypeZst), compressedDict, 1024, 1024), sample), true,
+            "decompress with dictionary");
+        TEST_RESULT_BOOL(
+            bufEq(testDecompress(decompressFilter(compressTypeZst), compressedDict, 1, 1024), sample), true,
+            "decompress with dictionary when frame header is split across inputs");
+        TEST_RESULT_BOOL(
+            bufEq(testDecompress(decompressFilter(compressTypeZst), compressedDict, 5, 1), sample), true,
+            "decompress with dictionary when frame header is split across inputs and outputs");
+        TEST_RESULT_BOOL(
+            bufEq(
+                testDecompress(
+                    decompressFilter(compressTypeZst),
+                    testCompress(compressFilterDict(compressTypeZst, 1, NULL), sample, 1024, 1024), 1024, 1024),
+                sample),
+            true, "dictionary is not used to decompress data compressed without it");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("get dictionary id from frame");
+
+        TEST_RESULT_UINT(
+            compressDictIdFromFrame(compressTypeZst, bufNewC(bufPtr(compressedDict), COMPRESS_DICT_ID_FRAME_SIZE)),
+            zstDictId(dictionary), "compressed with dictionary");
+        TEST_RESULT_UINT(
+            compressDictIdFromFrame(
+                compressTypeZst, testCompress(compressFilterDict(compressTypeZst, 1, NULL), sample, 1024, 1024)), 0,
+            "compressed without dictionary");
+        TEST_RESULT_UINT(compressDictIdFromFrame(compressTypeZst, bufNew(0)), 0, "no data");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("decompress data smaller than the maximum frame header");
+
+        Buffer *small = bufNewC("X", 1);
+        Buffer *compressedSmall = testCompress(compressFilter(compressTypeZst, 1), small, 1024, 1024);
+
+        TEST_RESULT_BOOL(bufUsed(compressedSmall) < ZST_DECOMPRESS_HEADER_SIZE_MAX, true, "    compressed is smaller than header");
+        TEST_RESULT_BOOL(
+            bufEq(testDecompress(decompressFilter(compressTypeZst), compressedSmall, 1024, 1), small), true,
+            "decompress with small output buffer");
+        TEST_ERROR(
+            testDecompress(decompressFilter(compressTypeZst), bufNewC(bufPtr(compressedSmall), 4), 1024, 1024), FormatError,
+            "unexpected eof in compressed data");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress/decompress with dictionary id passed as filter parameter");
+
+        IoFilter *filter = compressFilterDict(compressTypeZst, 1, dictionary);
+        TEST_RESULT_UINT(varUIntForce(varLstGet(ioFilterParamList(filter), 1)), zstDictId(dictionary), "    dictionary id param");
+
+        TEST_ASSIGN(
+            compressedDict,
+            testCompress(compressFilterVar(ZST_COMPRESS_FILTER_TYPE_STR, ioFilterParamList(filter)), sample, 1024, 1024),
+            "compress with dictionary");
+
+        TEST_RESULT_BOOL(
+            bufEq(testDecompress(compressFilterVar(ZST_DECOMPRESS_FILTER_TYPE_STR, NULL), compressedDict, 1024, 1024), sample),
+            true, "decompress with dictionary");
+
+        compressDictLoadSet(NULL);
+        testDictLocal = NULL;
 #else
         TEST_ERROR(compressTypePresent(compressTypeZst), OptionInvalidValueError, "pgBackRest not compiled with zst support");
 #endif // HAVE_LIBZST
@@ -345,6 +484,14 @@ testRun(void)
         TEST_RESULT_VOID(compressTypePresent(compressTypeNone), "type none always present");
         TEST_ERROR(compressTypePresent(compressTypeXz), OptionInvalidValueError, "pgBackRest not compiled with xz support");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressTypeDict()");
+
+        TEST_RESULT_BOOL(compressTypeDict(compressTypeGz), false, "gz does not support dictionaries");
+#ifdef HAVE_LIBZST
+        TEST_RESULT_BOOL(compressTypeDict(compressTypeZst), true, "zst supports dictionaries");
+#endif
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("compressTypeFromName()");
 
@@ -356,6 +503,21 @@ testRun(void)
 
         TEST_RESULT_PTR(compressFilterVar(STRDEF("BOGUS"), 0), NULL, "no filter match");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressDictLoad()");
+
+        TEST_ERROR(compressDictLoad(1), FormatError, "compression dictionary 1 is not available");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressFilterIs() and decompressFilterIs()");
+
+        TEST_RESULT_BOOL(compressFilterIs(compressFilter(compressTypeGz, 1)), true, "gz compress is compress");
+        TEST_RESULT_BOOL(compressFilterIs(decompressFilter(compressTypeGz)), false, "gz decompress is not compress");
+        TEST_RESULT_BOOL(compressFilterIs(ioSizeNew()), false, "size is not compress");
+        TEST_RESULT_BOOL(decompressFilterIs(decompressFilter(compressTypeGz)), true, "gz decompress is decompress");
+        TEST_RESULT_BOOL(decompressFilterIs(compressFilter(compressTypeGz, 1)), false, "gz compress is not decompress");
+        TEST_RESULT_BOOL(decompressFilterIs(ioSizeNew()), false, "size is not decompress");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("compressExtStr()");
 
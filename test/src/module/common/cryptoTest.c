@@ -369,6 +369,14 @@ testRun(void)
         TEST_ASSIGN(hash, cryptoHashNew(strNew(HASH_TYPE_SHA256)), "create sha256 hash");
         TEST_RESULT_STR_Z(varStr(ioFilterResult(hash)), HASH_TYPE_SHA256_ZERO, "    check empty hash");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("binary hash from filter");
+
+        TEST_ASSIGN(hash, cryptoHashNew(HASH_TYPE_SHA1_STR), "create sha1 hash");
+        TEST_RESULT_VOID(ioFilterProcessIn(hash, BUFSTRDEF("123")), "add 123");
+        TEST_RESULT_VOID(ioFilterProcessIn(hash, BUFSTRDEF("45")), "add 45");
+        TEST_RESULT_STR_Z(bufHex(cryptoHashBuf(hash)), "8cb2237d0679ca88db6464eac60da96345513964", "    check hash");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_STR_Z(
             bufHex(cryptoHashOne(strNew(HASH_TYPE_SHA1), BUFSTRDEF("12345"))), "8cb2237d0679ca88db6464eac60da96345513964",
@@ -1,10 +1,13 @@
 /***********************************************************************************************************************************
 Test Http
 ***********************************************************************************************************************************/
+#include <sys/socket.h>
 #include <unistd.h>
 
 #include "common/io/handleRead.h"
 #include "common/io/handleWrite.h"
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
 
 #include "common/harnessFork.h"
 #include "common/harnessTls.h"
@@ -135,7 +138,12 @@ testRun(void)
         TEST_RESULT_PTR(httpClientStatStr(), NULL, "no stats yet");
 
         TEST_ASSIGN(
-            client, httpClientNew(strNew("localhost"), hrnTlsServerPort(), 500, testContainer(), NULL, NULL),
+            client,
+            httpClientNew(
+                tlsClientIoClient(
+                    tlsClientNew(
+                        sckClientNew(strNew("localhost"), hrnTlsServerPort(), 500), 500, testContainer(), NULL, NULL, NULL, NULL)),
+                500),
             "new client");
 
         TEST_ERROR_FMT(
@@ -163,7 +171,13 @@ testRun(void)
                 ioBufferSizeSet(35);
 
                 TEST_ASSIGN(
-                    client, httpClientNew(hrnTlsServerHost(), hrnTlsServerPort(), 5000, testContainer(), NULL, NULL),
+                    client,
+                    httpClientNew(
+                        tlsClientIoClient(
+                            tlsClientNew(
+                                sckClientNew(hrnTlsServerHost(), hrnTlsServerPort(), 5000), 5000, testContainer(), NULL, NULL, NULL,
+                                NULL)),
+                        5000),
                     "new client");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -384,6 +398,7 @@ testRun(void)
                 TEST_RESULT_STR_Z(httpClientResponseMessage(client), "OK", "check response message");
                 TEST_RESULT_BOOL(httpClientEof(client), true, "io is eof");
                 TEST_RESULT_BOOL(httpClientBusy(client), false, "client is not busy");
+                TEST_RESULT_UINT(httpClientRequestRetry(client), 0, "no request retries");
                 TEST_RESULT_STR_Z(
                     httpHeaderToLog(httpClientResponseHeader(client)),  "{connection: 'close'}", "check response headers");
 
@@ -409,6 +424,7 @@ testRun(void)
 
                 TEST_RESULT_VOID(httpClientRequest(client, strNew("GET"), strNew("/"), NULL, NULL, NULL, false), "request");
                 TEST_RESULT_UINT(httpClientResponseCode(client), 404, "check response code");
+                TEST_RESULT_UINT(httpClientRequestRetry(client), 2, "check request retries");
                 TEST_RESULT_STR_Z(httpClientResponseMessage(client), "Not Found", "check response message");
                 TEST_RESULT_STR_Z(
                     httpHeaderToLog(httpClientResponseHeader(client)),  "{content-length: '0'}", "check response headers");
@@ -506,6 +522,48 @@ testRun(void)
                 TEST_RESULT_VOID(ioRead(httpClientIoRead(client), buffer),  "read response");
                 TEST_RESULT_STR_Z(strNewBuf(buffer),  "01234567890123456789012345678901012", "check response");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("request without waiting for the response and retry when the connection is closed");
+
+                hrnTlsServerClose();
+                hrnTlsServerAccept();
+
+                hrnTlsServerExpectZ("PUT /file.txt HTTP/1.1\r\ncontent-length:4\r\n\r\nDATA");
+                hrnTlsServerClose();
+
+                hrnTlsServerAccept();
+
+                hrnTlsServerExpectZ("PUT /file.txt HTTP/1.1\r\ncontent-length:4\r\n\r\nDATA");
+                hrnTlsServerReplyZ("HTTP/1.1 200 OK\r\ncontent-length:0\r\n\r\n");
+
+                headerRequest = httpHeaderAdd(httpHeaderNew(NULL), strNew("content-length"), strNew("4"));
+
+                TEST_RESULT_VOID(
+                    httpClientRequestAsync(client, strNew("PUT"), strNew("/file.txt"), NULL, headerRequest, BUFSTRDEF("DATA")),
+                    "request");
+                TEST_RESULT_BOOL(httpClientBusy(client), true, "client is busy");
+                TEST_RESULT_PTR(httpClientResponse(client, true), NULL, "response");
+                TEST_RESULT_UINT(httpClientResponseCode(client), 200, "check response code");
+                TEST_RESULT_BOOL(httpClientBusy(client), false, "client is not busy");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("session closed by the server while idle is not used");
+
+                hrnTlsServerClose();
+                hrnTlsServerAccept();
+
+                hrnTlsServerExpectZ("GET / HTTP/1.1\r\n\r\n");
+                hrnTlsServerReplyZ("HTTP/1.1 200 OK\r\ncontent-length:0\r\n\r\n");
+
+                uint64_t closeTotal = httpClientStatLocal.close;
+
+                TEST_RESULT_BOOL(httpClientSessionOpen(client), true, "session is open");
+                TEST_RESULT_BOOL(sckReadyRead(ioSessionFd(client->ioSession), 5000), true, "wait for server close");
+                TEST_RESULT_VOID(httpClientRequest(client, strNew("GET"), strNew("/"), NULL, NULL, NULL, false), "request");
+                TEST_RESULT_UINT(httpClientResponseCode(client), 200, "check response code");
+                TEST_RESULT_UINT(httpClientRequestRetry(client), 0, "no request retries");
+                TEST_RESULT_UINT(httpClientStatLocal.close, closeTotal + 1, "check closes");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("close connection");
 
@@ -513,6 +571,25 @@ testRun(void)
 
                 TEST_RESULT_VOID(httpClientFree(client), "free client");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("request without tls");
+
+                TEST_ASSIGN(
+                    client, httpClientNew(sckClientIoClient(sckClientNew(hrnTlsServerHost(), hrnTlsServerPort(), 5000)), 5000),
+                    "new plain client");
+
+                hrnTlsServerAcceptPlain();
+
+                hrnTlsServerExpectZ("GET / HTTP/1.1\r\n\r\n");
+                hrnTlsServerReplyZ("HTTP/1.1 200 OK\r\ncontent-length:7\r\n\r\nCONTENT");
+
+                TEST_ASSIGN(buffer, httpClientRequest(client, strNew("GET"), strNew("/"), NULL, NULL, NULL, true), "request");
+                TEST_RESULT_STR_Z(strNewBuf(buffer),  "CONTENT", "check response");
+
+                hrnTlsServerClose();
+
+                TEST_RESULT_VOID(httpClientFree(client), "free client");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 hrnTlsClientEnd();
             }
@@ -524,6 +601,7 @@ testRun(void)
         TEST_TITLE("statistics exist");
 
         TEST_RESULT_BOOL(httpClientStatStr() != NULL, true, "check");
+        TEST_RESULT_BOOL(strstr(strPtr(tlsClientStatStr()), "resumes 0,") == NULL, true, "tls sessions resumed");
     }
 
     // *****************************************************************************************************************************
@@ -534,7 +612,13 @@ testRun(void)
         HttpClient *client2 = NULL;
 
         TEST_ASSIGN(
-            cache, httpClientCacheNew(strNew("localhost"), hrnTlsServerPort(), 5000, true, NULL, NULL), "new http client cache");
+            cache,
+            httpClientCacheNew(
+                tlsClientIoClient(
+                    tlsClientNew(
+                        sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 5000, true, NULL, NULL, NULL, NULL)),
+                5000, 1, 1000),
+            "new http client cache");
         TEST_ASSIGN(client1, httpClientCacheGet(cache), "get http client");
         TEST_RESULT_PTR(client1, *(HttpClient **)lstGet(cache->clientList, 0), "    check http client");
         TEST_RESULT_PTR(httpClientCacheGet(cache), *(HttpClient **)lstGet(cache->clientList, 0), "    get same http client");
@@ -549,6 +633,60 @@ testRun(void)
         // Set back to NULL so bad things don't happen during free
         client1->ioRead = NULL;
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("close sessions over the maximum or idle too long");
+
+        int fd1[2], fd2[2];
+        THROW_ON_SYS_ERROR(socketpair(AF_UNIX, SOCK_STREAM, 0, fd1) == -1, AssertError, "unable to create socket pair");
+        THROW_ON_SYS_ERROR(socketpair(AF_UNIX, SOCK_STREAM, 0, fd2) == -1, AssertError, "unable to create socket pair");
+
+        MEM_CONTEXT_BEGIN(client1->memContext)
+        {
+            client1->ioSession = sckSessionIoSession(sckSessionNew(sckSessionTypeClient, fd1[0], STRDEF("fake1"), 0, 100));
+            client1->sessionTime = timeMSec();
+        }
+        MEM_CONTEXT_END();
+
+        MEM_CONTEXT_BEGIN(client2->memContext)
+        {
+            client2->ioSession = sckSessionIoSession(sckSessionNew(sckSessionTypeClient, fd2[0], STRDEF("fake2"), 0, 100));
+            client2->sessionTime = timeMSec();
+        }
+        MEM_CONTEXT_END();
+
+        TEST_RESULT_PTR(httpClientCacheGet(cache), client2, "get last http client");
+        TEST_RESULT_BOOL(httpClientSessionOpen(client2), true, "    session is open");
+        TEST_RESULT_BOOL(httpClientSessionOpen(client1), false, "    session over maximum is closed");
+
+        client2->sessionTime = timeMSec() - 1001;
+
+        TEST_RESULT_PTR(httpClientCacheGet(cache), client2, "get last http client");
+        TEST_RESULT_BOOL(httpClientSessionOpen(client2), false, "    idle session is closed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("prefer a client with an open session");
+
+        int fd3[2];
+        THROW_ON_SYS_ERROR(socketpair(AF_UNIX, SOCK_STREAM, 0, fd3) == -1, AssertError, "unable to create socket pair");
+
+        MEM_CONTEXT_BEGIN(client1->memContext)
+        {
+            client1->ioSession = sckSessionIoSession(sckSessionNew(sckSessionTypeClient, fd3[0], STRDEF("fake3"), 0, 100));
+            client1->sessionTime = timeMSec();
+        }
+        MEM_CONTEXT_END();
+
+        TEST_RESULT_PTR(httpClientCacheGet(cache), client1, "get http client with open session");
+        TEST_RESULT_BOOL(httpClientSessionOpen(client1), true, "    session is open");
+
+        httpClientClose(client1);
+
+        TEST_RESULT_PTR(httpClientCacheGet(cache), client2, "get last http client when no session is open");
+
+        close(fd1[1]);
+        close(fd2[1]);
+        close(fd3[1]);
+
         TEST_RESULT_VOID(httpClientCacheFree(cache), "free http client cache");
     }
 
@@ -309,6 +309,13 @@ testRun(void)
         TEST_RESULT_VOID(ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioSizeNew()), "    add filter to be cleared");
         TEST_RESULT_VOID(ioFilterGroupClear(ioReadFilterGroup(bufferRead)), "    clear size filter");
 
+        TEST_RESULT_VOID(ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioSizeNew()), "    add filter to be removed");
+        TEST_RESULT_STR_Z(
+            ioFilterType(ioFilterGroupFilter(ioReadFilterGroup(bufferRead), 0)), "size", "    check filter type");
+        TEST_RESULT_STR_Z(
+            ioFilterType(ioFilterGroupRemove(ioReadFilterGroup(bufferRead), 0)), "size", "    remove size filter");
+        TEST_RESULT_UINT(ioFilterGroupSize(ioReadFilterGroup(bufferRead)), 0, "    no filters");
+
         IoFilter *sizeFilter = ioSizeNew();
         TEST_RESULT_VOID(
             ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioTestFilterMultiplyNew("double", 2, 3, 'X')),
@@ -393,6 +400,35 @@ testRun(void)
         TEST_RESULT_UINT(ioRead(bufferRead, buffer), 5, "    read 5 chars");
         TEST_RESULT_STR_Z(strNewBuf(buffer), "YYYYY", "    check buffer");
 
+        // Peek at data without consuming it
+        // -------------------------------------------------------------------------------------------------------------------------
+        ioBufferSizeSet(5);
+        read = ioBufferReadNew(BUFSTRDEF("ABCDEFG"));
+        ioReadOpen(read);
+        buffer = bufNew(2);
+
+        // Make the peek buffer smaller than the input buffer so input is left over after the first peek
+        ioBufferSizeSet(2);
+
+        TEST_RESULT_UINT(bufUsed(ioReadPeek(read, 1, false)), 0, "nothing to peek without blocking");
+        TEST_RESULT_STR_Z(strNewBuf(ioReadPeek(read, 2, true)), "AB", "peek");
+        TEST_RESULT_STR_Z(strNewBuf(ioReadPeek(read, 1, true)), "AB", "peek again without reading");
+        TEST_RESULT_UINT(ioRead(read, buffer), 2, "read peeked data");
+        TEST_RESULT_STR_Z(strNewBuf(buffer), "AB", "    check buffer");
+        TEST_RESULT_STR_Z(strNewBuf(ioReadPeek(read, 2, false)), "CD", "peek left over input without blocking");
+
+        bufUsedZero(buffer);
+        TEST_RESULT_UINT(ioRead(read, buffer), 2, "read peeked data");
+        TEST_RESULT_STR_Z(strNewBuf(ioReadPeek(read, 2, true)), "EF", "peek");
+
+        bufUsedZero(buffer);
+        TEST_RESULT_UINT(ioRead(read, buffer), 2, "read peeked data");
+        TEST_RESULT_STR_Z(strNewBuf(ioReadPeek(read, 2, true)), "G", "peek remaining data at eof");
+
+        bufUsedZero(buffer);
+        TEST_RESULT_UINT(ioRead(read, buffer), 1, "read peeked data");
+        TEST_RESULT_UINT(bufUsed(ioReadPeek(read, 1, true)), 0, "nothing to peek at eof");
+
         // Mixed line and buffer read
         // -------------------------------------------------------------------------------------------------------------------------
         ioBufferSizeSet(5);
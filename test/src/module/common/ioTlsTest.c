@@ -2,6 +2,8 @@
 Test Tls Client
 ***********************************************************************************************************************************/
 #include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 #include "common/io/handleRead.h"
@@ -66,7 +68,7 @@ testRun(void)
             TEST_TITLE("enable options");
 
             sckInit(false, true, 32, 3113, 818);
-            sckOptionSet(fd);
+            sckOptionSet(fd, true);
 
             TEST_RESULT_INT(fcntl(fd, F_GETFD), FD_CLOEXEC, "check FD_CLOEXEC");
 
@@ -115,7 +117,7 @@ testRun(void)
             TEST_TITLE("disable keep-alive");
 
             sckInit(false, false, 0, 0, 0);
-            sckOptionSet(fd);
+            sckOptionSet(fd, true);
 
             TEST_RESULT_INT(keepAliveValue, 1, "check SO_KEEPALIVE");
             TEST_RESULT_INT(keepAliveCountValue, 32, "check TCP_KEEPCNT");
@@ -126,7 +128,7 @@ testRun(void)
             TEST_TITLE("enable keep-alive but disable options");
 
             sckInit(false, true, 0, 0, 0);
-            sckOptionSet(fd);
+            sckOptionSet(fd, true);
 
             TEST_RESULT_INT(keepAliveValue, 1, "check SO_KEEPALIVE");
             TEST_RESULT_INT(keepAliveCountValue, 32, "check TCP_KEEPCNT");
@@ -146,6 +148,10 @@ testRun(void)
             TEST_ERROR(
                 sckSessionReadyWrite(session), ProtocolError, "timeout after 100ms waiting for write to '172.31.255.255:7777'");
 
+            TEST_RESULT_VOID(sckSessionTimeoutSet(session, 50), "set timeout");
+            TEST_ERROR(
+                sckSessionReadyWrite(session), ProtocolError, "timeout after 50ms waiting for write to '172.31.255.255:7777'");
+
             TEST_RESULT_VOID(sckSessionFree(session), "free socket session");
 
             // ---------------------------------------------------------------------------------------------------------------------
@@ -189,6 +195,65 @@ testRun(void)
         // This address should not be in use in a test environment -- if it is the test will fail
         TEST_ASSIGN(client, sckClientNew(strNew("172.31.255.255"), hrnTlsServerPort(), 100), "new client");
         TEST_ERROR_FMT(sckClientOpen(client), HostConnectError, "timeout connecting to '172.31.255.255:%u'", hrnTlsServerPort());
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("unix socket path too long");
+
+        TEST_ASSIGN(client, sckClientNew(strNewFmt("/%0108d", 0), 0, 100), "new client");
+        TEST_ERROR_FMT(sckClientOpen(client), HostConnectError, "socket path '/%0108d' is too long", 0);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("unable to connect to unix socket");
+
+        const String *socketPath = strNewFmt("%s/test.sock", testPath());
+
+        TEST_ASSIGN(client, sckClientNew(socketPath, 0, 100), "new client");
+        TEST_ERROR_FMT(
+            sckClientOpen(client), HostConnectError, "unable to connect to '%s:0': [2] No such file or directory",
+            strPtr(socketPath));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read/write on unix socket");
+
+        struct sockaddr_un address = {.sun_family = AF_UNIX};
+        strcpy(address.sun_path, strPtr(socketPath));
+
+        int serverSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        THROW_ON_SYS_ERROR(serverSocket == -1, AssertError, "unable to create socket");
+        THROW_ON_SYS_ERROR(bind(serverSocket, (struct sockaddr *)&address, sizeof(address)) == -1, AssertError, "unable to bind");
+        THROW_ON_SYS_ERROR(listen(serverSocket, 1) == -1, AssertError, "unable to listen");
+
+        SocketSession *clientSession = NULL;
+        TEST_ASSIGN(clientSession, sckClientOpen(client), "open client session");
+
+        int serverFd = accept(serverSocket, NULL, NULL);
+        THROW_ON_SYS_ERROR(serverFd == -1, AssertError, "unable to accept");
+
+        SocketSession *serverSession = NULL;
+        TEST_ASSIGN(
+            serverSession, sckSessionNew(sckSessionTypeServer, serverFd, STRDEF("client"), 0, 100), "new server session");
+
+        TEST_RESULT_VOID(ioWriteStrLine(ioSessionIoWrite(sckSessionIoSession(clientSession)), STRDEF("PING")), "client write");
+        TEST_RESULT_VOID(ioWriteFlush(sckSessionIoWrite(clientSession)), "client flush");
+        TEST_RESULT_STR_Z(ioReadLine(sckSessionIoRead(serverSession)), "PING", "server read");
+
+        TEST_RESULT_VOID(ioWriteStrLine(sckSessionIoWrite(serverSession), STRDEF("PONG")), "server write");
+        TEST_RESULT_VOID(ioWriteFlush(sckSessionIoWrite(serverSession)), "server flush");
+        TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(sckSessionIoSession(clientSession))), "PONG", "client read");
+
+        TEST_RESULT_VOID(ioSessionClose(sckSessionIoSession(serverSession)), "server close");
+        TEST_RESULT_VOID(sckSessionClose(serverSession), "server close again");
+        TEST_RESULT_INT(sckSessionFd(serverSession), -1, "check server fd");
+
+        Buffer *buffer = bufNew(1);
+        TEST_RESULT_UINT(ioRead(sckSessionIoRead(clientSession), buffer), 0, "client read eof");
+        TEST_RESULT_BOOL(ioReadEof(sckSessionIoRead(clientSession)), true, "check eof");
+
+        TEST_RESULT_VOID(ioSessionFree(sckSessionIoSession(clientSession)), "free client session");
+        TEST_RESULT_VOID(sckSessionFree(serverSession), "free server session");
+
+        close(serverSocket);
+        unlink(strPtr(socketPath));
     }
 
     // Additional coverage not provided by testing with actual certificates
@@ -216,13 +281,13 @@ testRun(void)
         // Connection errors
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ASSIGN(
-            client, tlsClientNew(sckClientNew(strNew("99.99.99.99.99"), hrnTlsServerPort(), 0), 0, true, NULL, NULL),
+            client, tlsClientNew(sckClientNew(strNew("99.99.99.99.99"), hrnTlsServerPort(), 0), 0, true, NULL, NULL, NULL, NULL),
             "new client");
         TEST_ERROR(
             tlsClientOpen(client), HostConnectError, "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
 
         TEST_ASSIGN(
-            client, tlsClientNew(sckClientNew(strNew("localhost"), hrnTlsServerPort(), 100), 100, true, NULL, NULL),
+            client, tlsClientNew(sckClientNew(strNew("localhost"), hrnTlsServerPort(), 100), 100, true, NULL, NULL, NULL, NULL),
             "new client");
         TEST_ERROR_FMT(
             tlsClientOpen(client), HostConnectError, "unable to connect to 'localhost:%u': [111] Connection refused",
@@ -234,7 +299,8 @@ testRun(void)
         TEST_ERROR(
             tlsClientOpen(
                 tlsClientNew(
-                    sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 0, true, strNew("bogus.crt"), strNew("/bogus"))),
+                    sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 0, true, strNew("bogus.crt"), strNew("/bogus"),
+                    NULL, NULL)),
             CryptoError, "unable to set user-defined CA certificate location: [33558530] No such file or directory");
 
         // Certificate location and validation errors
@@ -275,7 +341,8 @@ testRun(void)
                 TEST_ERROR_FMT(
                     tlsClientOpen(
                         tlsClientNew(
-                            sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 0, true, NULL, strNew("/bogus"))),
+                            sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 0, true, NULL, strNew("/bogus"), NULL,
+                            NULL)),
                     CryptoError,
                     "unable to verify certificate presented by 'localhost:%u': [20] unable to get local issuer certificate",
                     hrnTlsServerPort());
@@ -290,7 +357,7 @@ testRun(void)
                     tlsClientOpen(
                         tlsClientNew(
                             sckClientNew(strNew("test.pgbackrest.org"), hrnTlsServerPort(), 5000), 0, true,
-                            strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                            strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
                     "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -303,7 +370,7 @@ testRun(void)
                     tlsClientOpen(
                         tlsClientNew(
                             sckClientNew(strNew("host.test2.pgbackrest.org"), hrnTlsServerPort(), 5000), 0, true,
-                            strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                            strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
                     "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -316,7 +383,7 @@ testRun(void)
                     tlsClientOpen(
                         tlsClientNew(
                             sckClientNew(strNew("test3.pgbackrest.org"), hrnTlsServerPort(), 5000), 0, true,
-                            strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                            strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
                     CryptoError,
                     "unable to find hostname 'test3.pgbackrest.org' in certificate common name or subject alternative names");
 
@@ -331,7 +398,7 @@ testRun(void)
                         tlsClientNew(
                             sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 0, true,
                             strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath()),
-                        NULL)),
+                        NULL, NULL, NULL)),
                     CryptoError,
                     "unable to verify certificate presented by 'localhost:%u': [20] unable to get local issuer certificate",
                     hrnTlsServerPort());
@@ -344,7 +411,8 @@ testRun(void)
 
                 TEST_RESULT_VOID(
                     tlsClientOpen(
-                        tlsClientNew(sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 0, false, NULL, NULL)),
+                        tlsClientNew(
+                            sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 0, false, NULL, NULL, NULL, NULL)),
                         "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -385,7 +453,8 @@ testRun(void)
 
                 TEST_ASSIGN(
                     client,
-                    tlsClientNew(sckClientNew(hrnTlsServerHost(), hrnTlsServerPort(), 5000), 0, testContainer(), NULL, NULL),
+                    tlsClientNew(
+                        sckClientNew(hrnTlsServerHost(), hrnTlsServerPort(), 5000), 0, testContainer(), NULL, NULL, NULL, NULL),
                     "new client");
 
                 hrnTlsServerAccept();
@@ -515,5 +584,194 @@ testRun(void)
         TEST_RESULT_BOOL(tlsClientStatStr() != NULL, true, "check tls");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("SocketServer and TlsServer"))
+    {
+        const String *caFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath());
+        const String *certFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-localhost.crt", testRepoPath());
+        const String *keyFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath());
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("socket server");
+
+        TEST_ERROR(
+            sckServerNew(strNew("99.99.99.99.99"), hrnTlsServerPort(), 5000), HostConnectError,
+            "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
+
+        SocketServer *socketServer = NULL;
+
+        TEST_ASSIGN(socketServer, sckServerNew(strNew("localhost"), hrnTlsServerPort(), 5000), "new server");
+        TEST_RESULT_STR_Z(sckServerAddress(socketServer), "localhost", "check address");
+        TEST_RESULT_UINT(sckServerPort(socketServer), hrnTlsServerPort(), "check port");
+        TEST_RESULT_BOOL(sckServerFd(socketServer) != -1, true, "check fd");
+        TEST_RESULT_STR(
+            sckServerToLog(socketServer), strNewFmt("{address: localhost, port: %u, timeout: 5000}", hrnTlsServerPort()),
+            "server to log");
+
+        TEST_ERROR_FMT(
+            sckServerNew(strNew("localhost"), hrnTlsServerPort(), 5000), HostConnectError,
+            "unable to bind 'localhost:%u': [98] Address already in use", hrnTlsServerPort());
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("tls server errors");
+
+        TEST_ERROR(
+            tlsServerNew(caFile, strNew("/bogus.crt"), keyFile, 5000), CryptoError,
+            "unable to load server certificate: [33558530] No such file or directory");
+        TEST_ERROR(
+            tlsServerNew(caFile, certFile, strNew("/bogus.key"), 5000), CryptoError,
+            "unable to load server key: [33558530] No such file or directory");
+        TEST_ERROR(
+            tlsServerNew(strNew("/bogus.crt"), certFile, keyFile, 5000), CryptoError,
+            "unable to load CA certificate: [33558530] No such file or directory");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("client certificate errors");
+
+        TEST_ERROR(
+            tlsClientNew(
+                sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 5000, true, caFile, NULL, strNew("/bogus.crt"),
+                keyFile),
+            CryptoError, "unable to load client certificate: [33558530] No such file or directory");
+        TEST_ERROR(
+            tlsClientNew(
+                sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 5000, true, caFile, NULL, certFile,
+                strNew("/bogus.key")),
+            CryptoError, "unable to load client key: [33558530] No such file or directory");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                TEST_TITLE("client with certificate");
+
+                TlsSession *session = NULL;
+
+                TEST_ASSIGN(
+                    session,
+                    tlsClientOpen(
+                        tlsClientNew(
+                            sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 5000, true, caFile, NULL, certFile,
+                            keyFile)),
+                    "open session");
+                TEST_RESULT_VOID(ioWriteStrLine(tlsSessionIoWrite(session), STRDEF("ping")), "write");
+                TEST_RESULT_VOID(ioWriteFlush(tlsSessionIoWrite(session)), "flush");
+                TEST_RESULT_STR_Z(ioReadLine(tlsSessionIoRead(session)), "pong", "read");
+                TEST_RESULT_VOID(tlsSessionFree(session), "free session");
+
+                TEST_TITLE("client without certificate");
+
+                TRY_BEGIN()
+                {
+                    session = tlsClientOpen(
+                        tlsClientNew(
+                            sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000), 5000, true, caFile, NULL, NULL, NULL));
+
+                    // With TLS 1.3 the handshake completes on the client before the server rejects the certificate
+                    ioReadLine(tlsSessionIoRead(session));
+                }
+                CATCH_ANY()
+                {
+                }
+                TRY_END();
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TlsServer *tlsServer = NULL;
+                TlsSession *session = NULL;
+
+                TEST_ASSIGN(tlsServer, tlsServerNew(caFile, certFile, keyFile, 5000), "new tls server");
+
+                TEST_ASSIGN(session, tlsServerAccept(tlsServer, sckServerAccept(socketServer, 5000)), "accept session");
+                TEST_RESULT_STR_Z(tlsSessionPeerName(session), "localhost", "client certificate name");
+                TEST_RESULT_STR_Z(ioReadLine(tlsSessionIoRead(session)), "ping", "read");
+                TEST_RESULT_VOID(ioWriteStrLine(tlsSessionIoWrite(session), STRDEF("pong")), "write");
+                TEST_RESULT_VOID(ioWriteFlush(tlsSessionIoWrite(session)), "flush");
+                TEST_RESULT_VOID(tlsSessionFree(session), "free session");
+
+                TEST_ERROR(tlsServerAccept(tlsServer, sckServerAccept(socketServer, 5000)), ServiceError, "TLS error [1]");
+
+                TEST_RESULT_VOID(tlsServerFree(tlsServer), "free tls server");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("accept timeout");
+
+        TEST_RESULT_PTR(sckServerAccept(socketServer, 0), NULL, "no connection");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                SocketSession *session = NULL;
+
+                TEST_ASSIGN(
+                    session, sckClientOpen(sckClientNew(strNew("localhost"), hrnTlsServerPort(), 5000)), "open session");
+                TEST_RESULT_STR_Z(ioReadLine(sckSessionIoRead(session)), "ping", "read");
+                TEST_RESULT_VOID(sckSessionFree(session), "free session");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TEST_TITLE("accept with no file descriptors available");
+
+                // Limit open files to the lowest free descriptor so accept() fails
+                struct rlimit limit;
+                THROW_ON_SYS_ERROR(getrlimit(RLIMIT_NOFILE, &limit) == -1, AssertError, "unable to get file limit");
+
+                struct rlimit limitLow = limit;
+                int fdFree = dup(0);
+                close(fdFree);
+                limitLow.rlim_cur = (rlim_t)fdFree;
+
+                THROW_ON_SYS_ERROR(setrlimit(RLIMIT_NOFILE, &limitLow) == -1, AssertError, "unable to set file limit");
+
+                SocketSession *session = sckServerAccept(socketServer, 5000);
+
+                THROW_ON_SYS_ERROR(setrlimit(RLIMIT_NOFILE, &limit) == -1, AssertError, "unable to reset file limit");
+
+                TEST_RESULT_PTR(session, NULL, "no session");
+                harnessLogResult(
+                    strPtr(
+                        strNewFmt(
+                            "P00   WARN: unable to accept connection on 'localhost:%u': [24] Too many open files",
+                            hrnTlsServerPort())));
+
+                TEST_TITLE("accept when file descriptors are available again");
+
+                TEST_ASSIGN(session, sckServerAccept(socketServer, 5000), "accept session");
+                TEST_RESULT_VOID(ioWriteStrLine(sckSessionIoWrite(session), STRDEF("ping")), "write");
+                TEST_RESULT_VOID(ioWriteFlush(sckSessionIoWrite(session)), "flush");
+                TEST_RESULT_VOID(sckSessionFree(session), "free session");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("accept error");
+
+        // Swap in a descriptor that is always read ready but is not a socket
+        int fdServer = socketServer->fd;
+        socketServer->fd = open(strPtr(certFile), O_RDONLY);
+
+        TEST_ERROR_FMT(
+            sckServerAccept(socketServer, 5000), HostConnectError,
+            "unable to accept connection on 'localhost:%u': [88] Socket operation on non-socket", hrnTlsServerPort());
+
+        close(socketServer->fd);
+        socketServer->fd = fdServer;
+
+        TEST_RESULT_VOID(sckServerFree(socketServer), "free server");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -112,6 +112,7 @@ testRun(void)
         String *lockPath = strNew(testPath());
         String *archiveLockFile = strNewFmt("%s/%s-archive" LOCK_FILE_EXT, testPath(), strPtr(stanza));
         String *backupLockFile = strNewFmt("%s/%s-backup" LOCK_FILE_EXT, testPath(), strPtr(stanza));
+        String *archiveGetLockFile = strNewFmt("%s/%s-archive-get" LOCK_FILE_EXT, testPath(), strPtr(stanza));
         int lockHandleTest = -1;
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -134,6 +135,8 @@ testRun(void)
             strPtr(strNewFmt(
                 "unable to acquire lock on file '%s': Resource temporarily unavailable\n"
                 "HINT: is another pgBackRest process running?", strPtr(archiveLockFile))));
+        TEST_RESULT_BOOL(lockAcquire(lockPath, stanza, lockTypeArchiveGet, 0, true), true, "archive-get lock while archive locked");
+        TEST_RESULT_VOID(lockRelease(true), "release archive-get lock");
         TEST_RESULT_VOID(lockReleaseFile(lockHandleTest, archiveLockFile), "release lock");
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -161,6 +164,7 @@ testRun(void)
         TEST_RESULT_BOOL(lockAcquire(lockPath, stanza, lockTypeAll, 0, true), true, "all lock");
         TEST_RESULT_BOOL(storageExistsP(storageTest, archiveLockFile), true, "archive lock file was created");
         TEST_RESULT_BOOL(storageExistsP(storageTest, backupLockFile), true, "backup lock file was created");
+        TEST_RESULT_BOOL(storageExistsP(storageTest, archiveGetLockFile), true, "archive-get lock file was created");
         TEST_ERROR(
             lockAcquire(lockPath, stanza, lockTypeAll, 0, false), AssertError,
             "assertion 'failOnNoLock || lockType != lockTypeAll' failed");
@@ -212,7 +212,7 @@ testRun(void)
     // *****************************************************************************************************************************
     if (testBegin("jsonFromVar()"))
     {
-        TEST_ERROR(jsonFromVar(varNewInt(1)), JsonFormatError, "variant type is invalid");
+        TEST_ERROR(jsonFromVar(varNewDbl(1.5)), JsonFormatError, "variant type is invalid");
 
         String *json = NULL;
         Variant *keyValue = NULL;
@@ -302,6 +302,8 @@ testRun(void)
         //--------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_STR_Z(jsonFromVar(NULL), "null", "null variant");
         TEST_RESULT_STR_Z(jsonFromVar(varNewBool(true)), "true", "bool variant");
+        TEST_RESULT_STR_Z(jsonFromVar(varNewInt(-66)), "-66", "int variant");
+        TEST_RESULT_STR_Z(jsonFromVar(varNewInt64(-10000000001)), "-10000000001", "int64 variant");
         TEST_RESULT_STR_Z(jsonFromVar(varNewUInt(66)), "66", "uint variant");
         TEST_RESULT_STR_Z(jsonFromVar(varNewUInt64(10000000001)), "10000000001", "uint64 variant");
         TEST_RESULT_STR_Z(jsonFromVar(varNewStrZ("test \" string")), "\"test \\\" string\"", "string variant");
@@ -46,6 +46,9 @@ testRun(void)
 
         TEST_RESULT_VOID(lstClear(list), "clear list");
         TEST_RESULT_STR_Z(lstToLog(list), "{size: 0}", "check log after clear");
+        TEST_RESULT_VOID(lstClear(list), "clear list again");
+        TEST_RESULT_VOID(lstAdd(list, &ptr), "add item after clear");
+        TEST_RESULT_STR_Z(lstToLog(list), "{size: 1}", "check log after add");
 
         TEST_RESULT_VOID(lstFree(list), "free list");
         TEST_RESULT_VOID(lstFree(lstNew(1)), "free empty list");
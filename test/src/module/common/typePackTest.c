@@ -0,0 +1,117 @@
+/***********************************************************************************************************************************
+Test Convert Variants to/from Pack Format
+***********************************************************************************************************************************/
+#include <limits.h>
+
+#include "common/type/json.h"
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    if (testBegin("packFromVar() and packCatVar()"))
+    {
+        TEST_RESULT_STR_Z(bufHex(packFromVar(NULL)), "00", "null");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARSTR(NULL))), "00", "null string");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARBOOL(false))), "01", "false");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARBOOL(true))), "02", "true");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARINT(-1))), "0301", "int");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARINT64(INT64_MIN))), "04ffffffffffffffffff01", "int64");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARUINT(300))), "05ac02", "unsigned int");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARUINT64(UINT64_MAX))), "06ffffffffffffffffff01", "unsigned int64");
+        TEST_RESULT_STR_Z(bufHex(packFromVar(VARSTRDEF("abc"))), "0703616263", "string");
+
+        VariantList *list = varLstNew();
+        varLstAdd(list, varNewBool(true));
+        varLstAdd(list, NULL);
+
+        TEST_RESULT_STR_Z(bufHex(packFromVar(varNewVarLst(list))), "08020200", "list");
+
+        KeyValue *kv = kvNew();
+        kvPut(kv, VARSTRDEF("a"), VARUINT(1));
+
+        TEST_RESULT_STR_Z(bufHex(packFromVar(varNewKv(kv))), "09010701610501", "key/value");
+
+        TEST_ERROR(packFromVar(VARDBL(1.1)), FormatError, "variant type is invalid");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("append to existing pack");
+
+        Buffer *pack = bufNew(0);
+
+        TEST_RESULT_VOID(packCatVar(pack, VARSTRDEF("cmd")), "append string");
+        TEST_RESULT_VOID(packCatVar(pack, NULL), "append null");
+        TEST_RESULT_STR_Z(bufHex(pack), "0703636d6400", "check pack");
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    if (testBegin("packToVar() and packReadVar()"))
+    {
+        TEST_TITLE("round trip preserves types");
+
+        VariantList *list = varLstNew();
+        varLstAdd(list, varNewBool(false));
+        varLstAdd(list, varNewInt(INT_MIN));
+        varLstAdd(list, varNewInt(INT_MAX));
+        varLstAdd(list, varNewInt64(INT64_MIN));
+        varLstAdd(list, varNewInt64(INT64_MAX));
+        varLstAdd(list, varNewUInt(UINT_MAX));
+        varLstAdd(list, varNewUInt64(UINT64_MAX));
+        varLstAdd(list, varNewStrZ(""));
+        varLstAdd(list, NULL);
+
+        KeyValue *kv = kvNew();
+        kvPut(kv, VARSTRDEF("list"), varNewVarLst(varLstNew()));
+        kvPut(kv, VARSTRDEF("kv"), varNewKv(kvNew()));
+        varLstAdd(list, varNewKv(kv));
+
+        const VariantList *result = NULL;
+        TEST_ASSIGN(result, varVarLst(packToVar(packFromVar(varNewVarLst(list)))), "round trip");
+
+        TEST_RESULT_UINT(varLstSize(result), varLstSize(list), "check size");
+
+        for (unsigned int listIdx = 0; listIdx < varLstSize(list) - 2; listIdx++)
+        {
+            TEST_RESULT_BOOL(varEq(varLstGet(result, listIdx), varLstGet(list, listIdx)), true, "check value");
+            TEST_RESULT_UINT(varType(varLstGet(result, listIdx)), varType(varLstGet(list, listIdx)), "check type");
+        }
+
+        TEST_RESULT_PTR(varLstGet(result, 8), NULL, "check null");
+        TEST_RESULT_STR_Z(jsonFromVar(varLstGet(result, 9)), "{\"kv\":{},\"list\":[]}", "check key/value");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read values in sequence");
+
+        size_t packPos = 0;
+        const Buffer *pack = BUFSTRDEF("\x07\x03" "cmd" "\x00");
+
+        TEST_RESULT_STR_Z(varStr(packReadVar(pack, &packPos)), "cmd", "read string");
+        TEST_RESULT_UINT(packPos, 5, "check position");
+        TEST_RESULT_PTR(packReadVar(pack, &packPos), NULL, "read null");
+        TEST_RESULT_UINT(packPos, 6, "check position");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("invalid pack");
+
+        TEST_ERROR(packToVar(BUFSTRDEF("")), FormatError, "unexpected end of pack while reading type");
+        TEST_ERROR(packToVar(BUFSTRDEF("\x01\x01")), FormatError, "unexpected 1 byte(s) after value in pack");
+        TEST_ERROR(packToVar(BUFSTRDEF("\x0A")), FormatError, "invalid type 10 in pack");
+        TEST_ERROR(packToVar(BUFSTRDEF("\x05")), FormatError, "unexpected end of pack while reading integer");
+        TEST_ERROR(
+            packToVar(BUFSTRDEF("\x06\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01")), FormatError, "integer in pack is too large");
+        TEST_ERROR(
+            packToVar(BUFSTRDEF("\x03\x80\x80\x80\x80\x10")), FormatError, "int 2147483648 in pack is out of range");
+        TEST_ERROR(
+            packToVar(BUFSTRDEF("\x05\x80\x80\x80\x80\x10")), FormatError, "unsigned int 4294967296 in pack is out of range");
+        TEST_ERROR(packToVar(BUFSTRDEF("\x07\x02" "a")), FormatError, "unexpected end of pack while reading string");
+        TEST_ERROR(packToVar(BUFSTRDEF("\x08\x02\x01")), FormatError, "unexpected end of pack while reading list");
+        TEST_ERROR(packToVar(BUFSTRDEF("\x09\x01\x01")), FormatError, "unexpected end of pack while reading key/value");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
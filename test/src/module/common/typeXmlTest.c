@@ -2,6 +2,30 @@
 Test Xml Types
 ***********************************************************************************************************************************/
 
+/***********************************************************************************************************************************
+Render stream elements to a string so they can be checked
+***********************************************************************************************************************************/
+static void
+testXmlStreamCallback(void *callbackData, const XmlStreamElement *element)
+{
+    String *result = callbackData;
+
+    strCatFmt(result, "%s", strPtr(xmlStreamElementName(element)));
+
+    const String *key = xmlStreamElementChild(element, strNew("Key"), false);
+
+    if (key != NULL)
+        strCatFmt(result, " {key: %s, size: %s}", strPtr(key), strPtr(xmlStreamElementChild(element, strNew("Size"), true)));
+    else
+        strCatFmt(result, " '%s'", strPtr(xmlStreamElementContent(element)));
+
+    strCat(result, "\n");
+
+    // Error on a specific element to test that errors are thrown from the callback
+    if (strEqZ(xmlStreamElementContent(element), "error"))
+        THROW(FormatError, "callback error");
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -107,5 +131,76 @@ testRun(void)
             "get xml");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("XmlStream"))
+    {
+        TEST_TITLE("parse document in parts");
+
+        const char *document =
+            "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">\n"
+            "    <Name id=\"test\">bucket</Name>\n"
+            "    <Prefix/>\n"
+            "    <Contents>\n"
+            "        <Key>test1.txt</Key>\n"
+            "        <ETag>&quot;fba9dede5f27731c9771645a39863328&quot;</ETag>\n"
+            "        <Size>1234</Size>\n"
+            "        <Owner><ID>ignored</ID></Owner>\n"
+            "    </Contents>\n"
+            "    <Contents>\n"
+            "        <Key>test&amp;2.txt</Key>\n"
+            "        <Size>4321</Size>\n"
+            "    </Contents>\n"
+            "    <NextContinuationToken>1ueGcxLPRx1Tr/XYExHnhbYLgveDs2J/wm36Hy4vbOwM=</NextContinuationToken>\n"
+            "</ListBucketResult>";
+
+        String *result = strNew("");
+        XmlStream *xmlStream = NULL;
+        TEST_ASSIGN(xmlStream, xmlStreamNew(testXmlStreamCallback, result), "new stream");
+
+        // Push the document a few bytes at a time so elements and content are split between parts
+        for (size_t documentIdx = 0; documentIdx < strlen(document); documentIdx += 7)
+        {
+            size_t size = strlen(document) - documentIdx < 7 ? strlen(document) - documentIdx : 7;
+            xmlStreamPush(xmlStream, BUF(document + documentIdx, size));
+        }
+
+        TEST_RESULT_VOID(xmlStreamEnd(xmlStream), "end stream");
+        TEST_RESULT_STR_Z(
+            result,
+            "Name 'bucket'\n"
+            "Prefix ''\n"
+            "Contents {key: test1.txt, size: 1234}\n"
+            "Contents {key: test&2.txt, size: 4321}\n"
+            "NextContinuationToken '1ueGcxLPRx1Tr/XYExHnhbYLgveDs2J/wm36Hy4vbOwM='\n",
+            "check elements");
+
+        TEST_RESULT_VOID(xmlStreamFree(xmlStream), "free stream");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("missing child");
+
+        TEST_ASSIGN(xmlStream, xmlStreamNew(testXmlStreamCallback, strNew("")), "new stream");
+        TEST_ERROR(
+            xmlStreamPush(xmlStream, BUFSTRDEF("<Root><Contents><Key>x</Key></Contents></Root>")), FormatError,
+            "unable to find child 'Size' in element 'Contents'");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error in callback");
+
+        TEST_ASSIGN(xmlStream, xmlStreamNew(testXmlStreamCallback, strNew("")), "new stream");
+        TEST_ERROR(xmlStreamPush(xmlStream, BUFSTRDEF("<Root><Code>error</Code>")), FormatError, "callback error");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("invalid and incomplete documents");
+
+        TEST_ASSIGN(xmlStream, xmlStreamNew(testXmlStreamCallback, strNew("")), "new stream");
+        TEST_ERROR(xmlStreamPush(xmlStream, BUFSTRDEF("<Root><Code></Root>")), FormatError, "invalid xml");
+
+        TEST_ASSIGN(xmlStream, xmlStreamNew(testXmlStreamCallback, strNew("")), "new stream");
+        TEST_RESULT_VOID(xmlStreamPush(xmlStream, BUFSTRDEF("<Root><Code>")), "push partial document");
+        TEST_ERROR(xmlStreamEnd(xmlStream), FormatError, "invalid xml");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -320,6 +320,18 @@ testRun(void)
         harnessLogResult(
             "P00   WARN: 'compress' and 'compress-type' options should not both be set\n"
             "            HINT: 'compress-type' is preferred and 'compress' is deprecated.");
+
+#ifdef HAVE_LIBLZ4
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress-type-network=lz4");
+
+        argList = strLstNew();
+        strLstAddZ(argList, "--" CFGOPT_STANZA "=db");
+        strLstAddZ(argList, "--" CFGOPT_COMPRESS_TYPE_NETWORK "=lz4");
+
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argList), "load config");
+        TEST_RESULT_STR_Z(cfgOptionStr(cfgOptCompressTypeNetwork), "lz4", "    compress-type-network=lz4");
+#endif // HAVE_LIBLZ4
     }
 
     // *****************************************************************************************************************************
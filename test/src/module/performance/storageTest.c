@@ -245,7 +245,7 @@ testRun(void)
 
                 // Create remote storage
                 Storage *storageRemote = storageRemoteNew(
-                    STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, false, NULL, client, 1);
+                    STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, false, NULL, client, compressTypeGz, 1);
 
                 // Storage info list
                 TEST_RESULT_VOID(
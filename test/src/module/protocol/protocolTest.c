@@ -1,10 +1,12 @@
 /***********************************************************************************************************************************
 Test Protocol
 ***********************************************************************************************************************************/
+#include "command/server/server.h"
 #include "common/io/handleRead.h"
 #include "common/io/handleWrite.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/io/io.h"
 #include "common/regExp.h"
 #include "storage/storage.h"
 #include "storage/posix/storage.h"
@@ -12,6 +14,8 @@ Test Protocol
 
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
+#include "common/harnessProtocol.h"
+#include "common/harnessTls.h"
 
 /***********************************************************************************************************************************
 Test protocol request handler
@@ -296,6 +300,72 @@ testRun(void)
                 " --pg1-path=/path/to/1 --process=1 --remote-type=pg --stanza=test1 backup:remote",
             "remote protocol params for db backup");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAddZ(argList, "--pg1-path=/path/to/1");
+        strLstAddZ(argList, "--pg1-host=pg1-host");
+        strLstAddZ(argList, "--" CFGOPT_CMD_SSH_CONTROL_PATH "=/tmp/ssh-%C");
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        strLstAddZ(argList, "backup");
+        harnessCfgLoadRaw(strLstSize(argList), strLstPtr(argList));
+
+        TEST_RESULT_STR_Z(
+            strLstJoin(protocolRemoteParam(protocolStorageTypePg, 1, 0), "|"),
+            "-o|LogLevel=error|-o|Compression=no|-o|PasswordAuthentication=no|-o|ControlMaster=no|-o|ControlPath=/tmp/ssh-%C"
+                "|postgres@pg1-host"
+                "|pgbackrest --log-level-console=off --log-level-file=off --log-level-stderr=error --pg1-local"
+                " --pg1-path=/path/to/1 --process=1 --remote-type=pg --stanza=test1 backup:remote",
+            "remote protocol params with ssh control path");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("open ssh master connection");
+
+        // Fake ssh that records the parameters it was called with
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("ssh.sh"), .modeFile = 0755),
+            BUFSTR(strNewFmt("#!/bin/sh\necho \"$@\" >> %s/ssh.log\n", testPath())));
+
+        argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAddZ(argList, "--pg1-path=/path/to/1");
+        strLstAddZ(argList, "--pg1-host=pg1-host");
+        strLstAddZ(argList, "--pg2-path=/path/to/2");
+        strLstAddZ(argList, "--pg2-host=pg2-host");
+        strLstAddZ(argList, "--pg2-host-type=tls");
+        strLstAdd(argList, strNewFmt("--" CFGOPT_CMD_SSH "=%s/ssh.sh", testPath()));
+        strLstAddZ(argList, "--" CFGOPT_CMD_SSH_CONTROL_PATH "=/tmp/ssh-%C");
+        strLstAddZ(argList, "--" CFGOPT_CMD_SSH_CONTROL_PERSIST "=300");
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        strLstAddZ(argList, "backup");
+        harnessCfgLoadRaw(strLstSize(argList), strLstPtr(argList));
+
+        TEST_RESULT_VOID(protocolRemoteSshMaster(protocolStorageTypePg, 0), "open master");
+        TEST_RESULT_VOID(protocolRemoteSshMaster(protocolStorageTypePg, 0), "master already open");
+        TEST_RESULT_VOID(protocolRemoteSshMaster(protocolStorageTypePg, 1), "no master for tls host");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, strNew("ssh.log")))),
+            "-o ControlPersist=300 -o LogLevel=error -o Compression=no -o PasswordAuthentication=no -o ControlMaster=auto"
+                " -o ControlPath=/tmp/ssh-%C postgres@pg1-host true\n",
+            "check ssh parameters");
+
+        argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAddZ(argList, "--pg1-path=/path/to/1");
+        strLstAddZ(argList, "--host-id=1");
+        strLstAddZ(argList, "--process=1");
+        strLstAddZ(argList, "--" CFGOPT_REMOTE_TYPE "=" PROTOCOL_REMOTE_TYPE_REPO);
+        strLstAddZ(argList, "--repo1-host=repo-host");
+        strLstAdd(argList, strNewFmt("--" CFGOPT_CMD_SSH "=%s/ssh.sh", testPath()));
+        strLstAddZ(argList, "--" CFGOPT_CMD_SSH_CONTROL_PATH "=/tmp/ssh-%C");
+        harnessCfgLoadRole(cfgCmdBackup, cfgCmdRoleLocal, argList);
+
+        TEST_RESULT_VOID(protocolRemoteSshMaster(protocolStorageTypeRepo, 0), "no master from local");
+        TEST_RESULT_UINT(strLstSize(protocolHelper.sshMasterList), 1, "check master list");
+
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
         strLstAddZ(argList, "pgbackrest");
@@ -360,17 +430,119 @@ testRun(void)
         MEM_CONTEXT_TEMP_END();
 
         TEST_RESULT_STR_Z(protocolCommandToLog(command), "{command: command1}", "check log");
-        TEST_RESULT_STR_Z(protocolCommandJson(command), "{\"cmd\":\"command1\",\"param\":[\"param1\",\"param2\"]}", "check json");
+
+        size_t packPos = 0;
+        const Buffer *pack = NULL;
+
+        TEST_ASSIGN(pack, protocolCommandPack(command), "pack command");
+        TEST_RESULT_STR_Z(varStr(packReadVar(pack, &packPos)), "command1", "    check command");
+        TEST_RESULT_STR_Z(jsonFromVar(packReadVar(pack, &packPos)), "[\"param1\",\"param2\"]", "    check parameters");
+        TEST_RESULT_UINT(packPos, bufUsed(pack), "    check pack end");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ASSIGN(command, protocolCommandNew(strNew("command2")), "create command");
         TEST_RESULT_STR_Z(protocolCommandToLog(command), "{command: command2}", "check log");
-        TEST_RESULT_STR_Z(protocolCommandJson(command), "{\"cmd\":\"command2\"}", "check json");
+        TEST_RESULT_STR_Z(bufHex(protocolCommandPack(command)), "0708636f6d6d616e643200", "check pack");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_VOID(protocolCommandFree(command), "free command");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("ProtocolFrame"))
+    {
+        Buffer *buffer = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(buffer);
+        ioWriteOpen(write);
+
+        TEST_RESULT_VOID(protocolFrameWrite(write, protocolFrameTypeCommand, BUFSTRDEF("ABC")), "write command frame");
+        TEST_RESULT_VOID(protocolFrameWrite(write, protocolFrameTypeResponse, BUFSTRDEF("")), "write empty response frame");
+        TEST_RESULT_VOID(protocolFrameWrite(write, protocolFrameTypeError, BUFSTRDEF("ERR")), "write error frame");
+        TEST_RESULT_VOID(ioWriteFlush(write), "flush frames");
+        TEST_RESULT_STR_Z(bufHex(buffer), "0100000003414243" "0200000000" "0300000003455252", "check frames");
+
+        TEST_RESULT_BOOL(protocolFrameTypeValid(0), false, "type 0 is invalid");
+        TEST_RESULT_BOOL(protocolFrameTypeValid('.'), false, "line prefix is invalid");
+        TEST_RESULT_BOOL(protocolFrameTypeValid(protocolFrameTypeError), true, "error type is valid");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read frames");
+
+        IoRead *read = ioBufferReadNew(buffer);
+        ioReadOpen(read);
+
+        ProtocolFrame frame = {0};
+
+        TEST_RESULT_BOOL(protocolFrameReady(read), false, "nothing buffered");
+        TEST_RESULT_BOOL(protocolFrameNext(read), true, "frame is next");
+        TEST_ASSIGN(frame, protocolFrameRead(read), "read command frame");
+        TEST_RESULT_UINT(frame.type, protocolFrameTypeCommand, "    check type");
+        TEST_RESULT_STR_Z(strNewBuf(frame.data), "ABC", "    check data");
+
+        TEST_RESULT_BOOL(protocolFrameReady(read), true, "response frame buffered");
+        TEST_ASSIGN(frame, protocolFrameRead(read), "read response frame");
+        TEST_RESULT_UINT(frame.type, protocolFrameTypeResponse, "    check type");
+        TEST_RESULT_UINT(bufUsed(frame.data), 0, "    check data");
+
+        TEST_RESULT_BOOL(protocolFrameReady(read), true, "error frame buffered");
+        TEST_ASSIGN(frame, protocolFrameRead(read), "read error frame");
+        TEST_RESULT_UINT(frame.type, protocolFrameTypeError, "    check type");
+        TEST_RESULT_STR_Z(strNewBuf(frame.data), "ERR", "    check data");
+
+        TEST_RESULT_BOOL(protocolFrameReady(read), false, "nothing buffered");
+        TEST_RESULT_BOOL(protocolFrameNext(read), false, "no frame at eof");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("frame larger than the read buffer is ready when the header is buffered");
+
+        ioBufferSizeSet(8);
+
+        bufUsedZero(buffer);
+        protocolFrameWrite(write, protocolFrameTypeResponse, BUFSTRDEF("0123456789"));
+        ioWriteFlush(write);
+
+        read = ioBufferReadNew(buffer);
+        ioReadOpen(read);
+
+        TEST_RESULT_UINT(bufUsed(ioReadPeek(read, 1, true)), 8, "buffer part of the frame");
+        TEST_RESULT_BOOL(protocolFrameReady(read), true, "frame ready");
+        TEST_ASSIGN(frame, protocolFrameRead(read), "read frame");
+        TEST_RESULT_STR_Z(strNewBuf(frame.data), "0123456789", "    check data");
+
+        ioBufferSizeSet(8192);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("incomplete and invalid frames");
+
+        read = ioBufferReadNew(BUFSTRDEF("\x01\x00\x00\x00\x02" "A"));
+        ioReadOpen(read);
+
+        TEST_RESULT_UINT(bufUsed(ioReadPeek(read, 1, true)), 6, "buffer partial frame");
+        TEST_RESULT_BOOL(protocolFrameReady(read), false, "partial frame not ready");
+        TEST_ERROR(protocolFrameRead(read), ProtocolError, "unexpected eof while reading 2 byte frame");
+
+        read = ioBufferReadNew(BUFSTRDEF(".line\n"));
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(protocolFrameNext(read), false, "line is next");
+
+        read = ioBufferReadNew(BUFSTRDEF("\x01\x00"));
+        ioReadOpen(read);
+
+        TEST_ERROR(protocolFrameRead(read), ProtocolError, "unexpected eof while reading frame header");
+
+        read = ioBufferReadNew(BUFSTRDEF("\x09\x00\x00\x00\x00"));
+        ioReadOpen(read);
+
+        TEST_ERROR(protocolFrameRead(read), ProtocolError, "invalid frame type 9");
+
+        // The data is not allocated when the size exceeds the maximum
+        read = ioBufferReadNew(BUFSTRDEF("\x02\x04\x00\x00\x01"));
+        ioReadOpen(read);
+
+        TEST_ERROR(protocolFrameRead(read), ProtocolError, "frame size 67108865 exceeds maximum of 67108864");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("ProtocolClient"))
     {
@@ -401,52 +573,50 @@ testRun(void)
                 ioWriteStrLine(write, strNew("{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}"));
                 ioWriteFlush(write);
 
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop");
-                ioWriteStrLine(write, strNew("{}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop");
+                hrnProtocolWrite(write, "{}");
 
                 // Throw errors
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop with error text");
-                ioWriteStrLine(write, strNew("{\"err\":25,\"out\":\"sample error message\",\"errStack\":\"stack data\"}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop with error text");
+                hrnProtocolWrite(write, "{\"err\":25,\"out\":\"sample error message\",\"errStack\":\"stack data\"}");
 
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop with no error text");
-                ioWriteStrLine(write, strNew("{\"err\":255}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop with no error text");
+                hrnProtocolWrite(write, "{\"err\":255}");
 
                 // No output expected
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop with parameters returned");
-                ioWriteStrLine(write, strNew("{\"out\":[\"bogus\"]}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop with parameters returned");
+                hrnProtocolWrite(write, "{\"out\":[\"bogus\"]}");
+
+                // Command frame instead of response
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop with command returned");
+                hrnProtocolWrite(write, "{\"cmd\":\"noop\"}");
 
                 // Send output
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"test\"}", "test command");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"test\"}", "test command");
                 ioWriteStrLine(write, strNew(".OUTPUT"));
-                ioWriteStrLine(write, strNew("{\"out\":[\"value1\",\"value2\"]}"));
-                ioWriteFlush(write);
+                hrnProtocolWrite(write, "{\"out\":[\"value1\",\"value2\"]}");
 
                 // invalid line
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"invalid-line\"}", "invalid line command");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"invalid-line\"}", "invalid line command");
                 ioWrite(write, LF_BUF);
                 ioWriteFlush(write);
 
                 // error instead of output
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"error-instead-of-output\"}", "error instead of output command");
-                ioWriteStrLine(write, strNew("{\"err\":255}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(
+                    hrnProtocolRead(read), "{\"cmd\":\"error-instead-of-output\"}", "error instead of output command");
+                hrnProtocolWrite(write, "{\"err\":255}");
 
                 // unexpected output
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"unexpected-output\"}", "unexpected output");
-                ioWriteStrLine(write, strNew("{}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"unexpected-output\"}", "unexpected output");
+                hrnProtocolWrite(write, "{}");
 
                 // invalid prefix
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"invalid-prefix\"}", "invalid prefix");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"invalid-prefix\"}", "invalid prefix");
                 ioWriteStrLine(write, strNew("~line"));
                 ioWriteFlush(write);
 
                 // Wait for exit
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"exit\"}", "exit command");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"exit\"}", "exit command");
             }
             HARNESS_FORK_CHILD_END();
 
@@ -508,6 +678,9 @@ testRun(void)
                 // No output expected
                 TEST_ERROR(protocolClientNoOp(client), AssertError, "no output required by command");
 
+                // Command frame instead of response
+                TEST_ERROR(protocolClientNoOp(client), ProtocolError, "expected response frame but got frame type 1");
+
                 // Get command output
                 const VariantList *output = NULL;
 
@@ -569,43 +742,50 @@ testRun(void)
                     "check greeting");
 
                 // Noop
-                TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"noop\"}")), "write noop");
-                TEST_RESULT_VOID(ioWriteFlush(write), "flush noop");
-                TEST_RESULT_STR_Z(ioReadLine(read), "{}", "noop result");
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{\"cmd\":\"noop\"}"), "write noop");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{}", "noop result");
 
                 // Invalid command
                 KeyValue *result = NULL;
 
-                TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"bogus\"}")), "write bogus");
-                TEST_RESULT_VOID(ioWriteFlush(write), "flush bogus");
-                TEST_ASSIGN(result, varKv(jsonToVar(ioReadLine(read))), "parse error result");
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{\"cmd\":\"bogus\"}"), "write bogus");
+                TEST_ASSIGN(result, varKv(jsonToVar(hrnProtocolRead(read))), "parse error result");
                 TEST_RESULT_INT(varIntForce(kvGet(result, VARSTRDEF("err"))), 39, "    check code");
                 TEST_RESULT_STR_Z(varStr(kvGet(result, VARSTRDEF("out"))), "invalid command 'bogus'", "    check message");
                 TEST_RESULT_BOOL(kvGet(result, VARSTRDEF("errStack")) != NULL, true, "    check stack exists");
 
+                // Response frame instead of command
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{}"), "write response");
+                TEST_ASSIGN(result, varKv(jsonToVar(hrnProtocolRead(read))), "parse error result");
+                TEST_RESULT_INT(varIntForce(kvGet(result, VARSTRDEF("err"))), 39, "    check code");
+                TEST_RESULT_STR_Z(
+                    varStr(kvGet(result, VARSTRDEF("out"))), "expected command frame but got frame type 2", "    check message");
+
+                // Command that is not a string
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{\"cmd\":1}"), "write invalid command");
+                TEST_ASSIGN(result, varKv(jsonToVar(hrnProtocolRead(read))), "parse error result");
+                TEST_RESULT_INT(varIntForce(kvGet(result, VARSTRDEF("err"))), 39, "    check code");
+                TEST_RESULT_STR_Z(varStr(kvGet(result, VARSTRDEF("out"))), "invalid command frame", "    check message");
+
                 // Simple request
-                TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"request-simple\"}")), "write simple request");
-                TEST_RESULT_VOID(ioWriteFlush(write), "flush simple request");
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"out\":true}", "simple request result");
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{\"cmd\":\"request-simple\"}"), "write simple request");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"out\":true}", "simple request result");
 
                 // Throw an assert error which will include a stack trace
-                TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"assert\"}")), "write assert");
-                TEST_RESULT_VOID(ioWriteFlush(write), "flush assert error");
-                TEST_ASSIGN(result, varKv(jsonToVar(ioReadLine(read))), "parse error result");
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{\"cmd\":\"assert\"}"), "write assert");
+                TEST_ASSIGN(result, varKv(jsonToVar(hrnProtocolRead(read))), "parse error result");
                 TEST_RESULT_INT(varIntForce(kvGet(result, VARSTRDEF("err"))), 25, "    check code");
                 TEST_RESULT_STR_Z(varStr(kvGet(result, VARSTRDEF("out"))), "test assert", "    check message");
                 TEST_RESULT_BOOL(kvGet(result, VARSTRDEF("errStack")) != NULL, true, "    check stack exists");
 
                 // Complex request -- after process loop has been restarted
-                TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"request-complex\"}")), "write complex request");
-                TEST_RESULT_VOID(ioWriteFlush(write), "flush complex request");
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"out\":false}", "complex request result");
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{\"cmd\":\"request-complex\"}"), "write complex request");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"out\":false}", "complex request result");
                 TEST_RESULT_STR_Z(ioReadLine(read), ".LINEOFTEXT", "complex request result");
                 TEST_RESULT_STR_Z(ioReadLine(read), ".", "complex request result");
 
                 // Exit
-                TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"exit\"}")), "write exit");
-                TEST_RESULT_VOID(ioWriteFlush(write), "flush exit");
+                TEST_RESULT_VOID(hrnProtocolWrite(write, "{\"cmd\":\"exit\"}"), "write exit");
             }
             HARNESS_FORK_CHILD_END();
 
@@ -683,17 +863,15 @@ testRun(void)
                 ioWriteStrLine(write, strNew("{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}"));
                 ioWriteFlush(write);
 
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop");
-                ioWriteStrLine(write, strNew("{}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop");
+                hrnProtocolWrite(write, "{}");
 
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"command1\",\"param\":[\"param1\",\"param2\"]}", "command1");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"command1\",\"param\":[\"param1\",\"param2\"]}", "command1");
                 sleepMSec(4000);
-                ioWriteStrLine(write, strNew("{\"out\":1}"));
-                ioWriteFlush(write);
+                hrnProtocolWrite(write, "{\"out\":1}");
 
                 // Wait for exit
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"exit\"}", "exit command");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"exit\"}", "exit command");
             }
             HARNESS_FORK_CHILD_END();
 
@@ -709,22 +887,19 @@ testRun(void)
                 ioWriteStrLine(write, strNew("{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}"));
                 ioWriteFlush(write);
 
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop");
-                ioWriteStrLine(write, strNew("{}"));
-                ioWriteFlush(write);
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop");
+                hrnProtocolWrite(write, "{}");
 
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"command2\",\"param\":[\"param1\"]}", "command2");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"command2\",\"param\":[\"param1\"]}", "command2");
                 sleepMSec(1000);
-                ioWriteStrLine(write, strNew("{\"out\":2}"));
-                ioWriteFlush(write);
+                hrnProtocolWrite(write, "{\"out\":2}");
 
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"command3\",\"param\":[\"param1\"]}", "command3");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"command3\",\"param\":[\"param1\"]}", "command3");
 
-                ioWriteStrLine(write, strNew("{\"err\":39,\"out\":\"very serious error\"}"));
-                ioWriteFlush(write);
+                hrnProtocolWrite(write, "{\"err\":39,\"out\":\"very serious error\"}");
 
                 // Wait for exit
-                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"exit\"}", "exit command");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"exit\"}", "exit command");
             }
             HARNESS_FORK_CHILD_END();
 
@@ -733,7 +908,7 @@ testRun(void)
                 // -----------------------------------------------------------------------------------------------------------------
                 TestParallelJobCallback data = {.jobList = lstNew(sizeof(ProtocolParallelJob *))};
                 ProtocolParallel *parallel = NULL;
-                TEST_ASSIGN(parallel, protocolParallelNew(2000, testParallelJobCallback, &data), "create parallel");
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 1, testParallelJobCallback, &data), "create parallel");
                 TEST_RESULT_STR_Z(protocolParallelToLog(parallel), "{state: pending, clientTotal: 0, jobTotal: 0}", "check log");
 
                 // Add client
@@ -757,11 +932,10 @@ testRun(void)
                 }
 
                 // Attempt to add client without handle io
-                String *protocolString = strNew(
-                    "{\"name\":\"pgBackRest\",\"service\":\"error\",\"version\":\"" PROJECT_VERSION "\"}\n"
-                    "{}\n");
-
-                IoRead *read = ioBufferReadNew(BUFSTR(protocolString));
+                IoRead *read = ioBufferReadNew(
+                    BUFSTRDEF(
+                        "{\"name\":\"pgBackRest\",\"service\":\"error\",\"version\":\"" PROJECT_VERSION "\"}\n"
+                        "\x02\x00\x00\x00\x01\x00"));
                 ioReadOpen(read);
                 IoWrite *write = ioBufferWriteNew(bufNew(1024));
                 ioWriteOpen(write);
@@ -841,6 +1015,104 @@ testRun(void)
             HARNESS_FORK_PARENT_END();
         }
         HARNESS_FORK_END();
+
+        // Queue more than one job per client
+        // -------------------------------------------------------------------------------------------------------------------------
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, true)
+            {
+                IoRead *read = ioHandleReadNew(strNew("server read"), HARNESS_FORK_CHILD_READ(), 10000);
+                ioReadOpen(read);
+                IoWrite *write = ioHandleWriteNew(strNew("server write"), HARNESS_FORK_CHILD_WRITE());
+                ioWriteOpen(write);
+
+                // Greeting with noop
+                ioWriteStrLine(write, strNew("{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}"));
+                ioWriteFlush(write);
+
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"noop\"}", "noop");
+                hrnProtocolWrite(write, "{}");
+
+                // Both commands are sent before a response is required
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"command1\"}", "command1");
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"command2\"}", "command2");
+
+                // Send both responses at once
+                hrnProtocolFrameWrite(write, "{\"out\":1}");
+                hrnProtocolFrameWrite(write, "{\"err\":39,\"out\":\"error on queued job\"}");
+                ioWriteFlush(write);
+
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"command3\"}", "command3");
+                hrnProtocolWrite(write, "{\"out\":3}");
+
+                // Wait for exit
+                TEST_RESULT_STR_Z(hrnProtocolRead(read), "{\"cmd\":\"exit\"}", "exit command");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TestParallelJobCallback data = {.jobList = lstNew(sizeof(ProtocolParallelJob *))};
+                ProtocolParallel *parallel = NULL;
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 2, testParallelJobCallback, &data), "create parallel");
+
+                IoRead *read = ioHandleReadNew(strNew("client read"), HARNESS_FORK_PARENT_READ_PROCESS(0), 2000);
+                ioReadOpen(read);
+                IoWrite *write = ioHandleWriteNew(strNew("client write"), HARNESS_FORK_PARENT_WRITE_PROCESS(0));
+                ioWriteOpen(write);
+
+                ProtocolClient *client = NULL;
+                TEST_ASSIGN(client, protocolClientNew(strNew("test client"), strNew("test"), read, write), "create client");
+                TEST_RESULT_VOID(protocolParallelClientAdd(parallel, client), "add client");
+
+                // Add jobs
+                for (unsigned int jobIdx = 1; jobIdx <= 3; jobIdx++)
+                {
+                    ProtocolParallelJob *job = protocolParallelJobNew(
+                        varNewStr(strNewFmt("job%u", jobIdx)), protocolCommandNew(strNewFmt("command%u", jobIdx)));
+                    lstAdd(data.jobList, &job);
+                }
+
+                // Process jobs
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 0, "send two jobs");
+                TEST_RESULT_STR_Z(protocolParallelToLog(parallel), "{state: running, clientTotal: 1, jobTotal: 2}", "check log");
+
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 2, "both jobs complete");
+
+                ProtocolParallelJob *job = NULL;
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_STR_Z(varStr(protocolParallelJobKey(job)), "job1", "check key is job1");
+                TEST_RESULT_INT(varIntForce(protocolParallelJobResult(job)), 1, "check result is 1");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_STR_Z(varStr(protocolParallelJobKey(job)), "job2", "check key is job2");
+                TEST_RESULT_STR_Z(
+                    protocolParallelJobErrorMessage(job), "raised from test client: error on queued job", "check error message");
+
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 1, "last job complete");
+
+                harnessLogLevelSet(logLevelDebug);
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_STR_Z(varStr(protocolParallelJobKey(job)), "job3", "check key is job3");
+
+                harnessLogResultRegExp(
+                    "P01  DEBUG\\: +protocol\\/parallel\\:\\:protocolParallelResult\\: "
+                        "parallel jobs 3, busy [0-9]+ms, idle [0-9]+ms\n"
+                    "P00  DEBUG\\: +protocol\\/parallel\\:\\:protocolParallelResult\\: "
+                        "parallel wait [0-9]+ms, total [0-9]+ms");
+                harnessLogLevelReset();
+                TEST_RESULT_INT(varIntForce(protocolParallelJobResult(job)), 3, "check result is 3");
+
+                TEST_RESULT_BOOL(protocolParallelDone(parallel), true, "check done");
+
+                TEST_RESULT_VOID(protocolClientFree(client), "free client");
+                TEST_RESULT_VOID(protocolParallelFree(parallel), "free parallel");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
     }
 
     // *****************************************************************************************************************************
@@ -940,6 +1212,94 @@ testRun(void)
 
         TEST_ASSIGN(client, protocolRemoteGet(protocolStorageTypePg, 1), "get remote protocol");
 
+        TEST_RESULT_VOID(protocolFree(), "free remote protocol objects");
+
+        // Start remote protocols over tls
+        // -------------------------------------------------------------------------------------------------------------------------
+        const String *caFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath());
+        const String *certFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-localhost.crt", testRepoPath());
+        const String *keyFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath());
+
+        // The remotes use the configuration of the server
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("server.conf")),
+            BUFSTR(strNewFmt("[global]\nrepo1-path=%s\n\n[db]\npg1-path=%s\n", testPath(), testPath())));
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                argList = strLstNew();
+                strLstAdd(argList, strNewFmt("--" CFGOPT_CONFIG "=%s/server.conf", testPath()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_PORT "=%u", hrnTlsServerPort()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_CA_FILE "=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_CERT_FILE "=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_TLS_SERVER_KEY_FILE "=%s", strPtr(keyFile)));
+                strLstAddZ(argList, "--" CFGOPT_TLS_SERVER_AUTH "=localhost=db");
+                harnessCfgLoad(cfgCmdServer, argList);
+                harnessLogLevelSet(logLevelOff);
+
+                TEST_RESULT_VOID(cmdServer(2), "server");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                argList = strLstNew();
+                strLstAddZ(argList, "--stanza=db");
+                strLstAddZ(argList, "--protocol-timeout=10");
+                strLstAddZ(argList, "--repo1-host=localhost");
+                strLstAddZ(argList, "--" CFGOPT_REPO1_HOST_TYPE "=" PROTOCOL_REMOTE_HOST_TYPE_TLS);
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_PORT "=%u", hrnTlsServerPort()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_CA_FILE "=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_CERT_FILE "=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_REPO1_HOST_KEY_FILE "=%s", strPtr(keyFile)));
+                strLstAdd(argList, strNewFmt("--repo1-path=%s", testPath()));
+                harnessCfgLoad(cfgCmdInfo, argList);
+
+                TEST_ASSIGN(client, protocolRemoteGet(protocolStorageTypeRepo, 1), "get remote repo protocol");
+                TEST_RESULT_PTR(protocolRemoteGet(protocolStorageTypeRepo, 1), client, "get remote cached protocol");
+                TEST_RESULT_PTR(protocolHelper.clientRemote[0].exec, NULL, "    check no process");
+                TEST_RESULT_VOID(protocolFree(), "free remote protocol objects");
+
+                argList = strLstNew();
+                strLstAddZ(argList, "--stanza=db");
+                strLstAddZ(argList, "--protocol-timeout=10");
+                strLstAddZ(argList, "--repo1-retention-full=1");
+                strLstAddZ(argList, "--pg1-host=localhost");
+                strLstAddZ(argList, "--" CFGOPT_PG1_HOST_TYPE "=" PROTOCOL_REMOTE_HOST_TYPE_TLS);
+                strLstAdd(argList, strNewFmt("--" CFGOPT_PG1_HOST_PORT "=%u", hrnTlsServerPort()));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_PG1_HOST_CA_FILE "=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_PG1_HOST_CERT_FILE "=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_PG1_HOST_KEY_FILE "=%s", strPtr(keyFile)));
+                strLstAdd(argList, strNewFmt("--pg1-path=%s", testPath()));
+                harnessCfgLoad(cfgCmdBackup, argList);
+
+                TEST_ASSIGN(client, protocolRemoteGet(protocolStorageTypePg, 1), "get remote pg protocol");
+                TEST_RESULT_VOID(protocolClientNoOp(client), "    noop");
+                TEST_RESULT_VOID(protocolFree(), "free remote protocol objects");
+
+                argList = strLstNew();
+                strLstAddZ(argList, "--stanza=db");
+                strLstAddZ(argList, "--protocol-timeout=0.5");
+                strLstAddZ(argList, "--repo1-retention-full=1");
+                strLstAddZ(argList, "--pg1-host=localhost");
+                strLstAddZ(argList, "--" CFGOPT_PG1_HOST_TYPE "=" PROTOCOL_REMOTE_HOST_TYPE_TLS);
+                strLstAdd(argList, strNewFmt("--" CFGOPT_PG1_HOST_CA_FILE "=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_PG1_HOST_CERT_FILE "=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--" CFGOPT_PG1_HOST_KEY_FILE "=%s", strPtr(keyFile)));
+                strLstAdd(argList, strNewFmt("--pg1-path=%s", testPath()));
+                harnessCfgLoad(cfgCmdBackup, argList);
+
+                TEST_ERROR(
+                    protocolRemoteGet(protocolStorageTypePg, 1), HostConnectError,
+                    "unable to connect to 'localhost:8432': [111] Connection refused");
+                TEST_RESULT_VOID(protocolFree(), "free remote protocol objects");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
         // Start local protocol
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
@@ -952,7 +1312,56 @@ testRun(void)
         TEST_RESULT_PTR(protocolLocalGet(protocolStorageTypeRepo, 1, 1), client, "get local cached protocol");
         TEST_RESULT_PTR(protocolHelper.clientLocal[0].client, client, "check location in cache");
 
+        TEST_RESULT_VOID(protocolLocalStart(protocolStorageTypeRepo, 1, 2), "start local without protocol");
+        TEST_RESULT_BOOL(protocolHelper.clientLocal[1].exec != NULL, true, "    check process started");
+        TEST_RESULT_PTR(protocolHelper.clientLocal[1].client, NULL, "    check protocol not created");
+        TEST_RESULT_BOOL(protocolLocalGet(protocolStorageTypeRepo, 1, 2) != NULL, true, "get started local protocol");
+
         TEST_RESULT_VOID(protocolFree(), "free local and remote protocol objects");
+
+        // Free a local that was started but never used
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(protocolLocalStart(protocolStorageTypeRepo, 1, 1), "start local without protocol");
+        TEST_RESULT_VOID(protocolFree(), "free local");
+        TEST_RESULT_PTR(protocolHelper.clientLocal[0].exec, NULL, "    check process freed");
+
+        // Open ssh master connections before starting a local
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("ssh.sh"), .modeFile = 0755),
+            BUFSTR(strNewFmt("#!/bin/sh\necho \"$@\" >> %s/ssh.log\n", testPath())));
+
+        argList = strLstNew();
+        strLstAddZ(argList, "--stanza=db");
+        strLstAddZ(argList, "--protocol-timeout=10");
+        strLstAddZ(argList, "--repo1-host=repo-host");
+        strLstAdd(argList, strNewFmt("--" CFGOPT_CMD_SSH "=%s/ssh.sh", testPath()));
+        strLstAddZ(argList, "--" CFGOPT_CMD_SSH_CONTROL_PATH "=/tmp/ssh-local-%C");
+        harnessCfgLoad(cfgCmdArchiveGet, argList);
+
+        TEST_RESULT_VOID(protocolLocalStart(protocolStorageTypeRepo, 1, 1), "start repo local");
+        TEST_RESULT_VOID(protocolFree(), "free local");
+
+        argList = strLstNew();
+        strLstAddZ(argList, "--stanza=db");
+        strLstAddZ(argList, "--protocol-timeout=10");
+        strLstAddZ(argList, "--pg1-path=/path/to/1");
+        strLstAddZ(argList, "--pg1-host=pg1-host");
+        strLstAdd(argList, strNewFmt("--" CFGOPT_CMD_SSH "=%s/ssh.sh", testPath()));
+        strLstAddZ(argList, "--" CFGOPT_CMD_SSH_CONTROL_PATH "=/tmp/ssh-local-%C");
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        harnessCfgLoad(cfgCmdBackup, argList);
+
+        TEST_RESULT_VOID(protocolLocalStart(protocolStorageTypePg, 1, 1), "start pg local");
+        TEST_RESULT_VOID(protocolFree(), "free local");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, strNew("ssh.log")))),
+            "-o ControlPersist=30 -o LogLevel=error -o Compression=no -o PasswordAuthentication=no -o ControlMaster=auto"
+                " -o ControlPath=/tmp/ssh-local-%C pgbackrest@repo-host true\n"
+            "-o ControlPersist=30 -o LogLevel=error -o Compression=no -o PasswordAuthentication=no -o ControlMaster=auto"
+                " -o ControlPath=/tmp/ssh-local-%C postgres@pg1-host true\n",
+            "check ssh master connections");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -4,6 +4,7 @@ Test Posix Storage
 #include <unistd.h>
 #include <utime.h>
 
+#include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/time.h"
 #include "storage/read.h"
@@ -413,6 +414,30 @@ testRun(void)
             callbackData.content,
             "path {path, m=0700}\n",
             "    check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("list multiple paths");
+
+        StringList *pathList = strLstNew();
+        strLstAddZ(pathList, "pg/path");
+        strLstAddZ(pathList, BOGUS_STR);
+        strLstAddZ(pathList, "pg");
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListMultiP(storageTest, pathList, hrnStorageInfoListMultiCallback, &callbackData, .sortOrder = sortOrderAsc),
+            "info list multi");
+        TEST_RESULT_STR_Z(
+            callbackData.content,
+            "0:. {path, m=0700}\n"
+            "0:file {file, s=8}\n"
+            "2:. {path}\n"
+            "2:file {file, s=8, m=0660}\n"
+            "2:link {link, d=../file}\n"
+            "2:path {path, m=0700}\n"
+            "2:pipe {special}\n",
+            "    check content");
     }
 
     // *****************************************************************************************************************************
@@ -459,7 +484,7 @@ testRun(void)
     }
 
     // *****************************************************************************************************************************
-    if (testBegin("storageCopy()"))
+    if (testBegin("storageCopy() and storageCopyServer()"))
     {
         String *sourceFile = strNewFmt("%s/source.txt", testPath());
         String *destinationFile = strNewFmt("%s/destination.txt", testPath());
@@ -483,6 +508,73 @@ testRun(void)
         TEST_RESULT_BOOL(storageCopyP(source, destination), true, "copy file");
         TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetP(storageNewReadP(storageTest, destinationFile))), true, "check file");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy missing file on the storage");
+
+        String *missingFile = strNewFmt("%s/missing.txt", testPath());
+
+        TEST_ERROR_FMT(
+            storageCopyServerP(
+                storageTest, storageNewReadP(storageTest, missingFile), storageNewWriteP(storageTest, destinationFile)),
+            FileMissingError, STORAGE_ERROR_READ_MISSING, strPtr(missingFile));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy file on the storage");
+
+        TEST_RESULT_VOID(
+            storageCopyServerP(
+                storageTest, storageNewReadP(storageTest, sourceFile), storageNewWriteP(storageTest, destinationFile)),
+            "copy file");
+        TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetP(storageNewReadP(storageTest, destinationFile))), true, "check file");
+
+        TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageTest, sourceFile), NULL), "write zero-length source file");
+        TEST_RESULT_VOID(
+            storageCopyServerP(
+                storageTest, storageNewReadP(storageTest, sourceFile), storageNewWriteP(storageTest, destinationFile)),
+            "copy zero-length file");
+        TEST_RESULT_UINT(storageInfoP(storageTest, destinationFile).size, 0, "check file");
+
+        TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageTest, sourceFile), expectedBuffer), "write source file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy through this process when there are filters or a limit");
+
+        source = storageNewReadP(storageTest, sourceFile);
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), ioSizeNew());
+
+        TEST_RESULT_VOID(
+            storageCopyServerP(storageTest, source, storageNewWriteP(storageTest, destinationFile)), "copy file with read filter");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(source)), SIZE_FILTER_TYPE_STR)), 9, "check size");
+
+        destination = storageNewWriteP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), ioSizeNew());
+
+        TEST_RESULT_VOID(
+            storageCopyServerP(storageTest, storageNewReadP(storageTest, sourceFile), destination), "copy file with write filter");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioWriteFilterGroup(storageWriteIo(destination)), SIZE_FILTER_TYPE_STR)), 9,
+            "check size");
+
+        TEST_RESULT_VOID(
+            storageCopyServerP(
+                storageTest, storageNewReadP(storageTest, sourceFile, .limit = VARUINT64(4)),
+                storageNewWriteP(storageTest, destinationFile)),
+            "copy file with limit");
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(storageTest, destinationFile))), "TEST", "check file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy through this process when the driver does not support copy");
+
+        Storage *storageNoCopy = storagePosixNewP(strNew(testPath()), .write = true);
+        storageNoCopy->interface.copy = NULL;
+
+        TEST_RESULT_VOID(
+            storageCopyServerP(
+                storageNoCopy, storageNewReadP(storageNoCopy, sourceFile), storageNewWriteP(storageNoCopy, destinationFile)),
+            "copy file");
+        TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetP(storageNewReadP(storageTest, destinationFile))), true, "check file");
+
         storageRemoveP(storageTest, sourceFile, .errorOnMissing = true);
         storageRemoveP(storageTest, destinationFile, .errorOnMissing = true);
     }
@@ -867,6 +959,20 @@ testRun(void)
             buffer, storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .limit = VARUINT64(7))), "get");
         TEST_RESULT_UINT(bufSize(buffer), 7, "check size");
         TEST_RESULT_BOOL(memcmp(bufPtrConst(buffer), "TESTFIL", bufSize(buffer)) == 0, true, "check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of bytes");
+
+        TEST_ASSIGN(
+            buffer,
+            storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = 4, .limit = VARUINT64(3))),
+            "get");
+        TEST_RESULT_UINT(bufSize(buffer), 3, "check size");
+        TEST_RESULT_BOOL(memcmp(bufPtrConst(buffer), "FIL", bufSize(buffer)) == 0, true, "check content");
+
+        TEST_ERROR_FMT(
+            storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = UINT64_MAX)), FileOpenError,
+            "unable to seek to 18446744073709551615 in file '%s/test.txt': [22] Invalid argument", testPath());
     }
 
     // *****************************************************************************************************************************
@@ -1,15 +1,18 @@
 /***********************************************************************************************************************************
 Test Remote Storage
 ***********************************************************************************************************************************/
+#include <fcntl.h>
 #include <utime.h>
 
 #include "command/backup/pageChecksum.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/io/handleWrite.h"
 #include "postgres/interface.h"
 
 #include "common/harnessConfig.h"
+#include "common/harnessProtocol.h"
 #include "common/harnessStorage.h"
 #include "common/harnessTest.h"
 
@@ -71,7 +74,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_FEATURE_STR, varLstNew(), server), true, "protocol feature");
         TEST_RESULT_STR(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             strNewFmt(".\"%s/repo\"\n.%" PRIu64 "\n{}\n", testPath(), storageInterface(storageTest).feature),
             "check result");
 
@@ -198,7 +201,7 @@ testRun(void)
         TEST_RESULT_VOID(storageRemoteInfoWriteType(server, storageTypeSpecial), "write special type");
 
         ioWriteFlush(serverWriteIo);
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), ".p\n.s\n", "check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), ".p\n.s\n", "check result");
 
         bufUsedSet(serverWrite, 0);
 
@@ -209,7 +212,7 @@ testRun(void)
         TEST_RESULT_VOID(storageRemoteInfoWrite(server, &info), "write link info");
 
         ioWriteFlush(serverWriteIo);
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), ".l\n.0\n.0\n.null\n.0\n.null\n.0\n.\"../\"\n", "check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), ".l\n.0\n.0\n.null\n.0\n.null\n.0\n.\"../\"\n", "check result");
 
         bufUsedSet(serverWrite, 0);
 
@@ -222,7 +225,7 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));
 
         TEST_RESULT_BOOL(storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_INFO_STR, paramList, server), true, "protocol list");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":false}\n", "check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":false}\n", "check result");
 
         bufUsedSet(serverWrite, 0);
 
@@ -241,7 +244,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_INFO_STR, paramList, server), true, "protocol list");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             hrnReplaceKey(
                 "{\"out\":true}\n"
                 ".f\n.1555160001\n.6\n"
@@ -260,7 +263,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_INFO_STR, paramList, server), true, "protocol list");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             hrnReplaceKey(
                 "{\"out\":true}\n"
                 ".f\n.1555160001\n.6\n.{[user-id]}\n.\"{[user]}\"\n.{[group-id]}\n.\"{[group]}\"\n.416\n"
@@ -320,7 +323,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_INFO_LIST_STR, paramList, server), true, "call protocol");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             hrnReplaceKey(
                 ".\".\"\n.p\n.1555160000\n.{[user-id]}\n.\"{[user]}\"\n.{[group-id]}\n.\"{[group]}\"\n.488\n"
                 ".\"test\"\n.f\n.1555160001\n.6\n.{[user-id]}\n.\"{[user]}\"\n.{[group-id]}\n.\"{[group]}\"\n.416\n"
@@ -329,6 +332,75 @@ testRun(void)
             "check result");
 
         bufUsedSet(serverWrite, 0);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("list multiple paths");
+
+        storagePathCreateP(storageRemote, STRDEF("sub"));
+        utimeTest.modtime = 1555160002;
+        THROW_ON_SYS_ERROR(
+            utime(strPtr(storagePathP(storageRemote, STRDEF("sub"))), &utimeTest) != 0, FileWriteError, "unable to set time");
+
+        StringList *pathList = strLstNew();
+        strLstAddZ(pathList, BOGUS_STR);
+        strLstAddZ(pathList, "sub");
+        strLstAddZ(pathList, "");
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListMultiP(
+                storageRemote, pathList, hrnStorageInfoListMultiCallback, &callbackData, .sortOrder = sortOrderAsc),
+            "info list multi");
+        TEST_RESULT_STR_Z(
+            callbackData.content,
+            hrnReplaceKey(
+                "1:. {path, m=0750, u={[user]}, g={[group]}}\n"
+                "2:. {path, m=0750, u={[user]}, g={[group]}}\n"
+                "2:sub {path, m=0750, u={[user]}, g={[group]}}\n"
+                "2:test {file, s=6, m=0640, t=1555160001, u={[user]}, g={[group]}}\n"),
+            "check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("list multiple paths unsorted");
+
+        pathList = strLstNew();
+        strLstAddZ(pathList, "sub");
+        strLstAddZ(pathList, BOGUS_STR);
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListMultiP(
+                storageRemote, pathList, hrnStorageInfoListMultiCallback, &callbackData, .level = storageInfoLevelExists),
+            "info list multi");
+        TEST_RESULT_STR_Z(callbackData.content, "0:. {}\n", "check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("check multi protocol function directly");
+
+        // Use a separate server since the path list is read from the server input
+        IoRead *multiReadIo = ioBufferReadNew(
+            BUFSTR(strNewFmt("\"%s/repo/sub\"\n\"%s/repo/BOGUS\"\n\n", testPath(), testPath())));
+        ioReadOpen(multiReadIo);
+
+        ProtocolServer *multiServer = protocolServerNew(strNew("test"), strNew("test"), multiReadIo, serverWriteIo);
+        bufUsedSet(serverWrite, 0);
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewUInt(storageInfoLevelBasic));
+
+        TEST_RESULT_BOOL(
+            storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_INFO_LIST_MULTI_STR, paramList, multiServer), true, "call protocol");
+        TEST_RESULT_STR_Z(
+            hrnProtocolRender(serverWrite),
+            ".\".\"\n.p\n.1555160002\n"
+            ".\n"
+            ".\n"
+            "{}\n",
+            "check result");
+
+        bufUsedSet(serverWrite, 0);
     }
 
     // *****************************************************************************************************************************
@@ -383,21 +455,60 @@ testRun(void)
             ((StorageReadRemote *)fileRead->driver)->protocolReadBytes < bufSize(contentBuf), true,
             "    check compressed read size");
 
+#ifdef HAVE_LIBLZ4
+        // Use lz4 for protocol compression
+        ((StorageRemote *)storageRemote->driver)->compressType = compressTypeLz4;
+
+        TEST_ASSIGN(
+            fileRead, storageNewReadP(storageRemote, strNew("test.txt"), .compressible = true), "get file (protocol lz4)");
+        TEST_RESULT_BOOL(bufEq(storageGetP(fileRead), contentBuf), true, "    check contents");
+        TEST_RESULT_BOOL(
+            ((StorageReadRemote *)fileRead->driver)->protocolReadBytes < bufSize(contentBuf), true,
+            "    check compressed read size");
+
+        ((StorageRemote *)storageRemote->driver)->compressType = compressTypeGz;
+#endif // HAVE_LIBLZ4
+
+        // Read a compressed file with decompression as the last filter so the stored bytes are sent unchanged
+        // -------------------------------------------------------------------------------------------------------------------------
+        StorageWrite *fileWriteGz = storageNewWriteP(storageTest, strNew("repo/test.txt.gz"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(fileWriteGz)), compressFilter(compressTypeGz, 3));
+        storagePutP(fileWriteGz, contentBuf);
+
+        TEST_ASSIGN(fileRead, storageNewReadP(storageRemote, strNew("test.txt.gz"), .compressible = true), "get file (gz)");
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(fileRead)), decompressFilter(compressTypeGz));
+        TEST_RESULT_BOOL(bufEq(storageGetP(fileRead), contentBuf), true, "    check contents");
+        TEST_RESULT_UINT(
+            ((StorageReadRemote *)fileRead->driver)->protocolReadBytes,
+            storageInfoP(storageTest, strNew("repo/test.txt.gz")).size, "    check stored bytes were read");
+
         TEST_ERROR(
             storageRemoteProtocolBlockSize(strNew("bogus")), ProtocolError, "'bogus' is not a valid block size message");
+        TEST_ERROR(
+            storageRemoteProtocolBlockSize(strNew(PROTOCOL_BLOCK_HEADER)), ProtocolError,
+            "'" PROTOCOL_BLOCK_HEADER "' is not a valid block size message");
+        TEST_ERROR(
+            storageRemoteProtocolBlockSize(strNew(PROTOCOL_BLOCK_HEADER "1x")), ProtocolError,
+            "'" PROTOCOL_BLOCK_HEADER "1x' is not a valid block size message");
+        TEST_RESULT_INT(storageRemoteProtocolBlockSize(strNew(PROTOCOL_BLOCK_HEADER "-1")), -1, "end of file");
+        TEST_RESULT_INT(storageRemoteProtocolBlockSize(strNew(PROTOCOL_BLOCK_HEADER "8192")), 8192, "block size");
+        TEST_ERROR(
+            storageRemoteProtocolBlockSize(strNew(PROTOCOL_BLOCK_HEADER "18446744073709551615")), ProtocolError,
+            "block size in 'BRBLOCK18446744073709551615' is too large");
 
         // Check protocol function directly (file missing)
         // -------------------------------------------------------------------------------------------------------------------------
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNew("missing.txt")));
         varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, NULL);
         varLstAdd(paramList, varNewVarLst(varLstNew()));
 
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, server), true,
             "protocol open read (missing)");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":false}\n", "check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":false}\n", "check result");
 
         bufUsedSet(serverWrite, 0);
 
@@ -409,6 +520,7 @@ testRun(void)
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/test.txt", testPath())));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, varNewUInt64(8));
 
         // Create filters to test filter logic
@@ -425,12 +537,12 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, server), true, "protocol open read");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             "{\"out\":true}\n"
                 "BRBLOCK4\n"
                 "TESTBRBLOCK4\n"
                 "DATABRBLOCK0\n"
-                "{\"out\":{\"buffer\":null,\"cipherBlock\":null,\"gzCompress\":null,\"gzDecompress\":null"
+                "{\"out\":{\"cipherBlock\":null,\"gzCompress\":null,\"gzDecompress\":null"
                     ",\"hash\":\"bbbcf2c59433f68f22376cd2439d6cd309378df6\",\"pageChecksum\":{\"align\":false,\"valid\":false}"
                     ",\"size\":8}}\n",
             "check result");
@@ -445,6 +557,7 @@ testRun(void)
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/test.txt", testPath())));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, NULL);
 
         // Create filters to test filter logic
@@ -457,7 +570,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, server), true, "protocol open read (sink)");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             "{\"out\":true}\n"
                 "BRBLOCK0\n"
                 "{\"out\":{\"buffer\":null,\"hash\":\"bbbcf2c59433f68f22376cd2439d6cd309378df6\",\"sink\":null,\"size\":8}}\n",
@@ -470,12 +583,111 @@ testRun(void)
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/test.txt", testPath())));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, NULL);
         varLstAdd(paramList, varNewVarLst(varLstAdd(varLstNew(), varNewKv(kvAdd(kvNew(), varNewStrZ("bogus"), NULL)))));
 
         TEST_ERROR(
             storageRemoteProtocol(
                 PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, server), AssertError, "unable to add filter 'bogus'");
+
+        // Check protocol function directly (file sent from handle when there are no filters)
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Use local pg storage so the file has a handle
+        cfgOptionSet(cfgOptRemoteType, cfgSourceParam, VARSTRDEF("pg"));
+        cfgOptionSet(cfgOptPgHost, cfgSourceParam, NULL);
+        storageHelperFree();
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/test.txt")), BUFSTRDEF("TESTDATA!"));
+
+        int sendHandle = open(strPtr(strNewFmt("%s/send.out", testPath())), O_WRONLY | O_CREAT | O_TRUNC, 0640);
+        IoWrite *sendWrite = ioHandleWriteNew(strNew("send"), sendHandle);
+        ioWriteOpen(sendWrite);
+
+        ProtocolServer *serverSend = protocolServerNew(strNew("test"), strNew("test"), serverReadIo, sendWrite);
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(strNewFmt("%s/pg/test.txt", testPath())));
+        varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(1));
+        varLstAdd(paramList, varNewUInt64(7));
+        varLstAdd(paramList, ioFilterGroupParamAll(ioFilterGroupNew()));
+
+        TEST_RESULT_BOOL(
+            storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, serverSend), true,
+            "protocol open read (send file with offset and limit)");
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(strNewFmt("%s/pg/test.txt", testPath())));
+        varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(9));
+        varLstAdd(paramList, NULL);
+        varLstAdd(paramList, ioFilterGroupParamAll(ioFilterGroupNew()));
+
+        TEST_RESULT_BOOL(
+            storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, serverSend), true,
+            "protocol open read (send file with no bytes remaining)");
+
+        // Files larger than the buffer are sent in buffer size blocks
+        ioBufferSizeSet(4);
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(strNewFmt("%s/pg/test.txt", testPath())));
+        varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(0));
+        varLstAdd(paramList, NULL);
+        varLstAdd(paramList, ioFilterGroupParamAll(ioFilterGroupNew()));
+
+        TEST_RESULT_BOOL(
+            storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, serverSend), true,
+            "protocol open read (send file in blocks)");
+
+        ioBufferSizeSet(8192);
+
+        close(sendHandle);
+
+        TEST_RESULT_STR_Z(
+            hrnProtocolRender(storageGetP(storageNewReadP(storageTest, strNew("send.out")))),
+            "{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}\n"
+                "{\"out\":true}\n"
+                "BRBLOCK7\n"
+                "ESTDATABRBLOCK0\n"
+                "{\"out\":{\"buffer\":null}}\n"
+                "{\"out\":true}\n"
+                "BRBLOCK0\n"
+                "{\"out\":{\"buffer\":null}}\n"
+                "{\"out\":true}\n"
+                "BRBLOCK4\n"
+                "TESTBRBLOCK4\n"
+                "DATABRBLOCK1\n"
+                "!BRBLOCK0\n"
+                "{\"out\":{\"buffer\":null}}\n",
+            "check result");
+
+        // If sendfile() fails then the rest of the block is filled so the error is sent where the client expects a block header.
+        // sendfile() does not support writing to a file opened for append.
+        // -------------------------------------------------------------------------------------------------------------------------
+        sendHandle = open(strPtr(strNewFmt("%s/send.out", testPath())), O_WRONLY | O_TRUNC | O_APPEND, 0640);
+        sendWrite = ioHandleWriteNew(strNew("send"), sendHandle);
+        ioWriteOpen(sendWrite);
+
+        serverSend = protocolServerNew(strNew("test"), strNew("test"), serverReadIo, sendWrite);
+
+        TEST_ERROR_FMT(
+            storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, serverSend), FileReadError,
+            "unable to send file '%s/pg/test.txt': [22] Invalid argument", testPath());
+
+        close(sendHandle);
+
+        Buffer *sendOut = storageGetP(storageNewReadP(storageTest, strNew("send.out")));
+
+        TEST_RESULT_STR_Z(
+            bufHex(bufNewC(bufPtr(sendOut) + bufUsed(sendOut) - 18, 18)), "4252424c4f434b390a" "000000000000000000",
+            "check filled block");
+
+        cfgOptionSet(cfgOptRemoteType, cfgSourceParam, VARSTRDEF("repo"));
+        cfgOptionSet(cfgOptPgHost, cfgSourceParam, VARSTRDEF("localhost"));
+        storageHelperFree();
     }
 
     // *****************************************************************************************************************************
@@ -544,6 +756,31 @@ testRun(void)
             ((StorageWriteRemote *)write->driver)->protocolWriteBytes < bufSize(contentBuf), true,
             "    check compressed write size");
 
+#ifdef HAVE_LIBZST
+        // Write the file again with zst protocol compression
+        // -------------------------------------------------------------------------------------------------------------------------
+        ((StorageRemote *)storageRemote->driver)->compressType = compressTypeZst;
+
+        TEST_ASSIGN(write, storageNewWriteP(storageRemote, strNew("test2.txt"), .compressible = true), "new write file (zst)");
+        TEST_RESULT_VOID(storagePutP(write, contentBuf), "write file");
+        TEST_RESULT_BOOL(
+            ((StorageWriteRemote *)write->driver)->protocolWriteBytes < bufSize(contentBuf), true,
+            "    check compressed write size");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storageRemote, strNew("test2.txt"))), contentBuf), true, "check file");
+
+        ((StorageRemote *)storageRemote->driver)->compressType = compressTypeGz;
+#endif // HAVE_LIBZST
+
+        // Write the file with compression as the first filter so the compressed bytes are sent unchanged
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ASSIGN(write, storageNewWriteP(storageRemote, strNew("test2.txt.gz"), .compressible = true), "new write file (gz)");
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressTypeGz, 3));
+        TEST_RESULT_VOID(storagePutP(write, contentBuf), "write file");
+        TEST_RESULT_UINT(
+            ((StorageWriteRemote *)write->driver)->protocolWriteBytes,
+            storageInfoP(storageTest, strNew("repo/test2.txt.gz")).size, "    check compressed bytes were written");
+
         // Check protocol function directly (complete write)
         // -------------------------------------------------------------------------------------------------------------------------
         ioBufferSizeSet(10);
@@ -574,7 +811,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_WRITE_STR, paramList, server), true, "protocol open write");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             "{}\n"
             "{\"out\":{\"buffer\":null,\"size\":18}}\n",
             "check result");
@@ -605,7 +842,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_WRITE_STR, paramList, server), true, "protocol open write");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite),
+            hrnProtocolRender(serverWrite),
             "{}\n"
             "{}\n",
             "check result");
@@ -671,7 +908,7 @@ testRun(void)
         TEST_ASSIGN(info, storageInfoP(storageTest, strNewFmt("repo/%s", strPtr(path))), "  get path info");
         TEST_RESULT_BOOL(info.exists, true, "  path exists");
         TEST_RESULT_INT(info.mode, 0777, "  mode is set");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{}\n", "  check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{}\n", "  check result");
         bufUsedSet(serverWrite, 0);
     }
 
@@ -699,7 +936,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_PATH_REMOVE_STR, paramList, server), true,
             "  protocol path remove missing");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":false}\n", "  check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":false}\n", "  check result");
 
         bufUsedSet(serverWrite, 0);
 
@@ -711,7 +948,7 @@ testRun(void)
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_PATH_REMOVE_STR, paramList, server), true,
             "  protocol path recurse remove");
         TEST_RESULT_BOOL(storagePathExistsP(storageTest, strNewFmt("repo/%s", strPtr(path))), false, "  recurse path removed");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":true}\n", "  check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{\"out\":true}\n", "  check result");
 
         bufUsedSet(serverWrite, 0);
     }
@@ -751,7 +988,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_REMOVE_STR, paramList, server), true,
             "protocol file remove - no error on missing");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{}\n", "  check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{}\n", "  check result");
         bufUsedSet(serverWrite, 0);
 
         // Write the file to the repo via the remote and test the protocol
@@ -760,7 +997,7 @@ testRun(void)
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_REMOVE_STR, paramList, server), true,
             "protocol file remove");
         TEST_RESULT_BOOL(storageExistsP(storageTest, strNewFmt("repo/%s", strPtr(file))), false, "  confirm file removed");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{}\n", "  check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{}\n", "  check result");
         bufUsedSet(serverWrite, 0);
     }
 
@@ -784,7 +1021,7 @@ testRun(void)
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_PATH_SYNC_STR, paramList, server), true,
             "protocol path sync");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{}\n", "  check result");
+        TEST_RESULT_STR_Z(hrnProtocolRender(serverWrite), "{}\n", "  check result");
         bufUsedSet(serverWrite, 0);
 
         paramList = varLstNew();
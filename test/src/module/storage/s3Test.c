@@ -23,6 +23,10 @@ typedef struct TestRequestParam
 {
     VAR_PARAM_HEADER;
     const char *content;
+    const char *copySource;
+    const char *copySourceRange;
+    const char *ifMatch;
+    const char *range;
 } TestRequestParam;
 
 #define testRequestP(s3, verb, uri, ...)                                                                                           \
@@ -41,9 +45,25 @@ testRequest(Storage *s3, const char *verb, const char *uri, TestRequestParam par
     if (param.content != NULL)
         strCat(request, "content-md5;");
 
+    strCat(request, "host;");
+
+    if (param.ifMatch != NULL)
+        strCat(request, "if-match;");
+
+    if (param.range != NULL)
+        strCat(request, "range;");
+
+    strCat(request, "x-amz-content-sha256;");
+
+    if (param.copySource != NULL)
+        strCat(request, "x-amz-copy-source;");
+
+    if (param.copySourceRange != NULL)
+        strCat(request, "x-amz-copy-source-range;");
+
     strCatFmt(
         request,
-        "host;x-amz-content-sha256;x-amz-date,Signature=????????????????????????????????????????????????????????????????\r\n"
+        "x-amz-date,Signature=????????????????????????????????????????????????????????????????\r\n"
         "content-length:%zu\r\n",
         param.content == NULL ? 0 : strlen(param.content));
 
@@ -61,14 +81,33 @@ testRequest(Storage *s3, const char *verb, const char *uri, TestRequestParam par
     else
         strCatFmt(request, "host:" S3_TEST_HOST "\r\n");
 
-    // Add content sha256 and date
+    // Add if-match and range
+    if (param.ifMatch != NULL)
+        strCatFmt(request, "if-match:%s\r\n", param.ifMatch);
+
+    if (param.range != NULL)
+        strCatFmt(request, "range:%s\r\n", param.range);
+
+    // Add content sha256 (content is only signed when tls is disabled)
     strCatFmt(
+        request, "x-amz-content-sha256:%s\r\n",
+        param.content == NULL || strlen(param.content) == 0 ?
+            HASH_TYPE_SHA256_ZERO :
+            ((StorageS3 *)storageDriver(s3))->tls ?
+                "UNSIGNED-PAYLOAD" : strPtr(bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR, BUFSTRZ(param.content)))));
+
+    // Add copy source and range
+    if (param.copySource != NULL)
+        strCatFmt(request, "x-amz-copy-source:%s\r\n", param.copySource);
+
+    if (param.copySourceRange != NULL)
+        strCatFmt(request, "x-amz-copy-source-range:%s\r\n", param.copySourceRange);
+
+    // Add date
+    strCat(
         request,
-        "x-amz-content-sha256:%s\r\n"
         "x-amz-date:????????T??????Z" "\r\n"
-        "\r\n",
-        param.content == NULL ? HASH_TYPE_SHA256_ZERO : strPtr(bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR,
-        BUFSTRZ(param.content)))));
+        "\r\n");
 
     // Add content
     if (param.content != NULL)
@@ -114,6 +153,12 @@ testResponse(TestResponseParam param)
             strCat(response, "Forbidden");
             break;
         }
+
+        case 503:
+        {
+            strCat(response, "Slow Down");
+            break;
+        }
     }
 
     // End header
@@ -307,8 +352,8 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         StorageS3 *driver = (StorageS3 *)storageDriver(
             storageS3New(
-                path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 2, NULL, 0,
-                0, testContainer(), NULL, NULL));
+                path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 1, 1, 1,
+                2, NULL, 0, 0, true, testContainer(), NULL, NULL));
 
         HttpHeader *header = httpHeaderNew(NULL);
 
@@ -355,8 +400,8 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         driver = (StorageS3 *)storageDriver(
             storageS3New(
-                path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, securityToken, 16, 2,
-                NULL, 0, 0, testContainer(), NULL, NULL));
+                path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, securityToken, 16, 1,
+                1, 1, 2, NULL, 0, 0, true, testContainer(), NULL, NULL));
 
         TEST_RESULT_VOID(
             storageS3Auth(driver, strNew("GET"), strNew("/"), query, strNew("20170606T121212Z"), header, HASH_TYPE_SHA256_ZERO_STR),
@@ -387,8 +432,8 @@ testRun(void)
                 hrnTlsClientBegin(ioHandleWriteNew(strNew("test client write"), HARNESS_FORK_PARENT_WRITE_PROCESS(0)));
 
                 Storage *s3 = storageS3New(
-                    path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 2,
-                    host, port, 5000, testContainer(), NULL, NULL);
+                    path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 1, 1,
+                    1, 2, host, port, 5000, true, testContainer(), NULL, NULL);
 
                 // Coverage for noop functions
                 // -----------------------------------------------------------------------------------------------------------------
@@ -430,6 +475,28 @@ testRun(void)
 
                 TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3, strNew("file0.txt")))), "", "get zero-length file");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get range of file");
+
+                testRequestP(s3, HTTP_VERB_GET, "/file.txt", .range = "bytes=5-11");
+                testResponseP(.code = 206, .content = "is a sa");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, strNew("file.txt"), .offset = 5, .limit = VARUINT64(7)))), "is a sa",
+                    "get range");
+
+                testRequestP(s3, HTTP_VERB_GET, "/file.txt", .range = "bytes=15-");
+                testResponseP(.code = 206, .content = "e file");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, strNew("file.txt"), .offset = 15))), "e file", "get from offset");
+
+                testRequestP(s3, HTTP_VERB_GET, "/file.txt", .range = "bytes=21-");
+                testResponseP(.code = 416);
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, strNew("file.txt"), .offset = 21))), "", "get from offset past end");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("non-404 error");
 
@@ -566,6 +633,363 @@ testRun(void)
                 TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt")), "new write");
                 TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("12345678901234567890")), "write");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks with parts uploaded concurrently");
+
+                Storage *s3Concurrent = storageS3New(
+                    path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 2, 1,
+                    1, 2, host, port, 5000, true, testContainer(), NULL, NULL);
+
+                hrnTlsServerSession(1);
+                hrnTlsServerAccept();
+
+                testRequestP(s3Concurrent, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>CC77</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                // Part 1 is sent on the first connection and part 2 on a new connection since the first is waiting for a response
+                testRequestP(s3Concurrent, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=CC77", .content = "1234567890123456");
+
+                hrnTlsServerSession(2);
+                hrnTlsServerAccept();
+                testRequestP(s3Concurrent, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=CC77", .content = "7890123456789012");
+
+                // Part 1 must complete before part 3 is sent since only two parts may be in flight
+                hrnTlsServerSession(1);
+                testResponseP(.header = "etag:CC771");
+                testRequestP(s3Concurrent, HTTP_VERB_PUT, "/file.txt?partNumber=3&uploadId=CC77", .content = "3456789012345678");
+
+                hrnTlsServerSession(2);
+                testResponseP(.header = "etag:CC772");
+                testRequestP(s3Concurrent, HTTP_VERB_PUT, "/file.txt?partNumber=4&uploadId=CC77", .content = "ABCD");
+
+                hrnTlsServerSession(1);
+                testResponseP(.header = "etag:CC773");
+
+                hrnTlsServerSession(2);
+                testResponseP(.header = "etag:CC774");
+
+                testRequestP(
+                    s3Concurrent, HTTP_VERB_POST, "/file.txt?uploadId=CC77",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>CC771</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>CC772</ETag></Part>"
+                        "<Part><PartNumber>3</PartNumber><ETag>CC773</ETag></Part>"
+                        "<Part><PartNumber>4</PartNumber><ETag>CC774</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP();
+
+                hrnTlsServerClose();
+                hrnTlsServerSession(1);
+                hrnTlsServerClose();
+                hrnTlsServerSession(0);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3Concurrent, strNew("file.txt")), "new write");
+                TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(write)), "open");
+                TEST_RESULT_VOID(
+                    ioWrite(storageWriteIo(write), BUFSTRDEF("123456789012345678901234567890123456789012345678ABCD")), "write");
+                TEST_RESULT_VOID(ioWriteClose(storageWriteIo(write)), "close");
+
+                // Buffers of completed parts were reused so only three part buffers were allocated
+                TEST_RESULT_UINT(lstSize(((StorageWriteS3 *)write->driver)->partBufferPool), 2, "check part buffer pool");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file in ranges downloaded concurrently");
+
+                Storage *s3Download = storageS3New(
+                    path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 1, 3,
+                    1, 2, host, port, 5000, true, testContainer(), NULL, NULL);
+
+                hrnTlsServerSession(1);
+                hrnTlsServerAccept();
+
+                // The first range is read from the stream while the other ranges are requested on new connections
+                testRequestP(s3Download, HTTP_VERB_GET, "/file.txt", .range = "bytes=0-15");
+                testResponseP(
+                    .code = 206, .header = "etag:\"DL88\"\r\ncontent-range:bytes 0-15/52", .content = "1234567890123456");
+
+                hrnTlsServerSession(2);
+                hrnTlsServerAccept();
+                testRequestP(s3Download, HTTP_VERB_GET, "/file.txt", .ifMatch = "\"DL88\"", .range = "bytes=16-31");
+
+                hrnTlsServerSession(3);
+                hrnTlsServerAccept();
+                testRequestP(s3Download, HTTP_VERB_GET, "/file.txt", .ifMatch = "\"DL88\"", .range = "bytes=32-47");
+
+                // The last range is requested on the connection that is free after the first range completes
+                hrnTlsServerSession(2);
+                testResponseP(.code = 206, .content = "ABCDEFGHIJKLMNOP");
+                testRequestP(s3Download, HTTP_VERB_GET, "/file.txt", .ifMatch = "\"DL88\"", .range = "bytes=48-51");
+
+                hrnTlsServerSession(3);
+                testResponseP(.code = 206, .content = "abcdefghijklmnop");
+
+                hrnTlsServerSession(2);
+                testResponseP(.code = 206, .content = "QRST");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3Download, strNew("file.txt")))),
+                    "1234567890123456ABCDEFGHIJKLMNOPabcdefghijklmnopQRST", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on range size mismatch");
+
+                // The file is requested on the last connection that is not busy
+                hrnTlsServerSession(3);
+
+                testRequestP(s3Download, HTTP_VERB_GET, "/file.txt", .range = "bytes=0-15");
+                testResponseP(.code = 206, .header = "content-range:bytes 0-15/24", .content = "1234567890123456");
+
+                hrnTlsServerSession(2);
+                testRequestP(s3Download, HTTP_VERB_GET, "/file.txt", .range = "bytes=16-23");
+                testResponseP(.code = 206, .content = "ABCD");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3Download, strNew("file.txt"))), FileReadError,
+                    "expected 8 bytes in range of '/file.txt' but got 4");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file with zero limit");
+
+                // The stream was closed after the first range was read so the connection is opened again
+                hrnTlsServerSession(3);
+                hrnTlsServerClose();
+                hrnTlsServerAccept();
+
+                testRequestP(s3Download, HTTP_VERB_GET, "/file.txt");
+                testResponseP(.content = "1234567890123456ABCDEFGH");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3Download, strNew("file.txt"), .limit = VARUINT64(0)))), "",
+                    "get nothing");
+
+                hrnTlsServerClose();
+                hrnTlsServerSession(1);
+                hrnTlsServerClose();
+                hrnTlsServerSession(2);
+                hrnTlsServerClose();
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("throttled request reduces concurrency");
+
+                Storage *s3Throttle = storageS3New(
+                    path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 1, 4,
+                    1, 2, host, port, 5000, true, testContainer(), NULL, NULL);
+                StorageS3 *driverThrottle = (StorageS3 *)storageDriver(s3Throttle);
+
+                TEST_RESULT_UINT(driverThrottle->concurrencyLimit, 4, "concurrency starts at the largest maximum");
+
+                hrnTlsServerSession(1);
+                hrnTlsServerAccept();
+
+                testRequestP(s3Throttle, HTTP_VERB_HEAD, "/file.txt");
+                testResponseP(.code = 503);
+
+                hrnTlsServerClose();
+                hrnTlsServerAccept();
+
+                testRequestP(s3Throttle, HTTP_VERB_HEAD, "/file.txt");
+                testResponseP(.header = "content-length:20\r\nLast-Modified: Wed, 21 Oct 2015 07:28:00 GMT");
+
+                TEST_RESULT_UINT(storageInfoP(s3Throttle, strNew("file.txt")).size, 20, "info after retry");
+                TEST_RESULT_UINT(driverThrottle->concurrencyLimit, 2, "concurrency halved");
+                TEST_RESULT_UINT(storageS3ConcurrencyMax(driverThrottle, 4), 2, "limit is less than maximum");
+                TEST_RESULT_UINT(storageS3ConcurrencyMax(driverThrottle, 1), 1, "maximum is less than limit");
+
+                TEST_RESULT_VOID(
+                    storageS3ConcurrencyUpdate(&(StorageS3RequestAsync){.storage = driverThrottle, .requestId = 1}, true),
+                    "throttled request sent before the limit was reduced");
+                TEST_RESULT_UINT(driverThrottle->concurrencyLimit, 2, "concurrency not reduced again");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("requests that are not throttled raise concurrency");
+
+                StorageS3RequestAsync requestThrottle = {.storage = driverThrottle, .requestId = 2};
+
+                for (unsigned int requestIdx = 0; requestIdx < 2; requestIdx++)
+                    storageS3ConcurrencyUpdate(&requestThrottle, false);
+
+                TEST_RESULT_UINT(driverThrottle->concurrencyLimit, 3, "concurrency raised after two requests");
+
+                for (unsigned int requestIdx = 0; requestIdx < 4; requestIdx++)
+                    storageS3ConcurrencyUpdate(&requestThrottle, false);
+
+                TEST_RESULT_UINT(driverThrottle->concurrencyLimit, 4, "concurrency raised to the largest maximum only");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file in ranges while throttled");
+
+                storageS3ConcurrencyUpdate(&requestThrottle, true);
+                driverThrottle->requestThrottle = 0;
+                storageS3ConcurrencyUpdate(&requestThrottle, true);
+                driverThrottle->requestThrottle = 0;
+                storageS3ConcurrencyUpdate(&requestThrottle, true);
+
+                TEST_RESULT_UINT(driverThrottle->concurrencyLimit, 1, "concurrency is at least one");
+
+                // No ranges are requested while the stream is being read since only one request may be in flight
+                testRequestP(s3Throttle, HTTP_VERB_GET, "/file.txt", .range = "bytes=0-15");
+                testResponseP(
+                    .code = 206, .header = "etag:\"TH99\"\r\ncontent-range:bytes 0-15/20", .content = "1234567890123456");
+
+                hrnTlsServerClose();
+                hrnTlsServerAccept();
+
+                testRequestP(s3Throttle, HTTP_VERB_GET, "/file.txt", .ifMatch = "\"TH99\"", .range = "bytes=16-19");
+                testResponseP(.code = 206, .content = "ABCD");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3Throttle, strNew("file.txt")))), "1234567890123456ABCD", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get zero-length file when ranges may be downloaded concurrently");
+
+                Storage *s3Range = storageS3New(
+                    path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 1, 2,
+                    1, 2, host, port, 5000, true, testContainer(), NULL, NULL);
+
+                hrnTlsServerClose();
+                hrnTlsServerAccept();
+
+                testRequestP(s3Range, HTTP_VERB_GET, "/file0.txt", .range = "bytes=0-15");
+                testResponseP(.code = 416);
+
+                TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3Range, strNew("file0.txt")))), "", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file smaller than the first range");
+
+                testRequestP(s3Range, HTTP_VERB_GET, "/file.txt", .range = "bytes=0-15");
+                testResponseP(.code = 206, .header = "content-range:bytes 0-3/4", .content = "1234");
+
+                TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3Range, strNew("file.txt")))), "1234", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file when the server ignores the range");
+
+                testRequestP(s3Range, HTTP_VERB_GET, "/file.txt", .range = "bytes=0-15");
+                testResponseP(.content = "1234567890123456ABCD");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3Range, strNew("file.txt")))), "1234567890123456ABCD", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on missing content range");
+
+                testRequestP(s3Range, HTTP_VERB_GET, "/file.txt", .range = "bytes=0-15");
+                testResponseP(.code = 206, .content = "1234567890123456");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3Range, strNew("file.txt"))), FormatError,
+                    "'content-range' header is missing or invalid in response for '/file.txt'");
+
+                hrnTlsServerClose();
+                hrnTlsServerAccept();
+
+                testRequestP(s3Range, HTTP_VERB_GET, "/file.txt", .range = "bytes=0-15");
+                testResponseP(.code = 206, .header = "content-range:bytes 0-15", .content = "1234567890123456");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3Range, strNew("file.txt"))), FormatError,
+                    "'content-range' header is missing or invalid in response for '/file.txt'");
+
+                hrnTlsServerClose();
+                hrnTlsServerSession(0);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("copy missing file on the server");
+
+                testRequestP(s3, HTTP_VERB_HEAD, "/BOGUS");
+                testResponseP(.code = 404);
+
+                TEST_ERROR(
+                    storageCopyServerP(s3, storageNewReadP(s3, strNew("BOGUS")), storageNewWriteP(s3, strNew("file2.txt"))),
+                    FileMissingError, "unable to open missing file '/BOGUS' for read");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("copy file on the server");
+
+                testRequestP(s3, HTTP_VERB_HEAD, "/file.txt");
+                testResponseP(.header = "content-length:20\r\nLast-Modified: Wed, 21 Oct 2015 07:28:00 GMT");
+
+                testRequestP(s3, HTTP_VERB_PUT, "/path/file%202.txt", .copySource = "/bucket/file.txt");
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<CopyObjectResult>"
+                        "<LastModified>2009-10-12T17:50:30.000Z</LastModified>"
+                        "<ETag>CPY</ETag>"
+                        "</CopyObjectResult>");
+
+                TEST_RESULT_VOID(
+                    storageCopyServerP(
+                        s3, storageNewReadP(s3, strNew("file.txt")), storageNewWriteP(s3, strNew("path/file 2.txt"))),
+                    "copy");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("copy error reported after success code");
+
+                testRequestP(s3, HTTP_VERB_HEAD, "/file.txt");
+                testResponseP(.header = "content-length:20\r\nLast-Modified: Wed, 21 Oct 2015 07:28:00 GMT");
+
+                testRequestP(s3, HTTP_VERB_PUT, "/file2.txt", .copySource = "/bucket/file.txt");
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<Error><Code>InternalError</Code><Message>We encountered an internal error.</Message></Error>");
+
+                TEST_ERROR(
+                    storageCopyServerP(s3, storageNewReadP(s3, strNew("file.txt")), storageNewWriteP(s3, strNew("file2.txt"))),
+                    ProtocolError, "S3 copy failed with InternalError: We encountered an internal error.");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("copy file on the server in parts");
+
+                testRequestP(s3, HTTP_VERB_HEAD, "/file.txt");
+                testResponseP(.header = "content-length:5368709121\r\nLast-Modified: Wed, 21 Oct 2015 07:28:00 GMT");
+
+                testRequestP(s3, HTTP_VERB_POST, "/file2.txt?uploads=");
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file2.txt</Key>"
+                        "<UploadId>CP77</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(
+                    s3, HTTP_VERB_PUT, "/file2.txt?partNumber=1&uploadId=CP77", .copySource = "/bucket/file.txt",
+                    .copySourceRange = "bytes=0-5368709119");
+                testResponseP(.content = "<CopyPartResult><ETag>CP771</ETag></CopyPartResult>");
+
+                testRequestP(
+                    s3, HTTP_VERB_PUT, "/file2.txt?partNumber=2&uploadId=CP77", .copySource = "/bucket/file.txt",
+                    .copySourceRange = "bytes=5368709120-5368709120");
+                testResponseP(.content = "<CopyPartResult><ETag>CP772</ETag></CopyPartResult>");
+
+                testRequestP(
+                    s3, HTTP_VERB_POST, "/file2.txt?uploadId=CP77",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>CP771</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>CP772</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP();
+
+                TEST_RESULT_VOID(
+                    storageCopyServerP(s3, storageNewReadP(s3, strNew("file.txt")), storageNewWriteP(s3, strNew("file2.txt"))),
+                    "copy");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("file missing");
 
@@ -739,8 +1163,8 @@ testRun(void)
                     storageInfoListP(s3, strNew("/path/to"), hrnStorageInfoListCallback, &callbackData), "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "test_path {path}\n"
-                    "test_file {file, s=787, t=1255369830}\n",
+                    "test_file {file, s=787, t=1255369830}\n"
+                    "test_path {path}\n",
                     "check");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -766,8 +1190,8 @@ testRun(void)
                     "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "path1 {}\n"
-                    "test1.txt {}\n",
+                    "test1.txt {}\n"
+                    "path1 {}\n",
                     "check");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -839,11 +1263,11 @@ testRun(void)
                     "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "path1 {}\n"
                     "test1.txt {}\n"
                     "test2.txt {}\n"
-                    "path2 {}\n"
-                    "test3.txt {}\n",
+                    "path1 {}\n"
+                    "test3.txt {}\n"
+                    "path2 {}\n",
                     "check");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -880,19 +1304,71 @@ testRun(void)
                     "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "test1.path {}\n"
                     "test1.txt {}\n"
-                    "test3.txt {}\n",
+                    "test3.txt {}\n"
+                    "test1.path {}\n",
+                    "check");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("list read in parts");
+
+                size_t bufferSize = ioBufferSize();
+                ioBufferSizeSet(32);
+
+                testRequestP(s3, HTTP_VERB_GET, "/?delimiter=%2F&list-type=2");
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "    <Contents>"
+                        "        <Key>test1.txt</Key>"
+                        "    </Contents>"
+                        "   <CommonPrefixes>"
+                        "       <Prefix>path1/</Prefix>"
+                        "   </CommonPrefixes>"
+                        "</ListBucketResult>");
+
+                callbackData.content = strNew("");
+
+                TEST_RESULT_VOID(
+                    storageInfoListP(s3, strNew("/"), hrnStorageInfoListCallback, &callbackData, .level = storageInfoLevelExists),
+                    "list");
+                TEST_RESULT_STR_Z(
+                    callbackData.content,
+                    "test1.txt {}\n"
+                    "path1 {}\n",
                     "check");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on invalid xml before the list is read");
+
+                testRequestP(s3, HTTP_VERB_GET, "/?delimiter=%2F&list-type=2");
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "    <Contents>"
+                        "        <Key>test1.txt</Key>"
+                        "    </Bogus>"
+                        "    <Contents>"
+                        "        <Key>test2.txt</Key>"
+                        "    </Contents>"
+                        "</ListBucketResult>");
+
+                TEST_ERROR(
+                    storageInfoListP(s3, strNew("/"), hrnStorageInfoListCallback, &callbackData, .level = storageInfoLevelExists),
+                    FormatError, "invalid xml");
+
+                ioBufferSizeSet(bufferSize);
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("switch to path-style URIs");
 
                 hrnTlsServerClose();
 
                 s3 = storageS3New(
-                    path, true, NULL, bucket, endPoint, storageS3UriStylePath, region, accessKey, secretAccessKey, NULL, 16, 2,
-                    host, port, 5000, testContainer(), NULL, NULL);
+                    path, true, NULL, bucket, endPoint, storageS3UriStylePath, region, accessKey, secretAccessKey, NULL, 16, 1, 1,
+                    1, 2, host, port, 5000, true, testContainer(), NULL, NULL);
 
                 hrnTlsServerAccept();
 
@@ -1037,6 +1513,121 @@ testRun(void)
 
                 TEST_RESULT_VOID(storageRemoveP(s3, strNew("/path/to/test.txt")), "remove");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files with list sharded by prefix");
+
+                Storage *s3Shard = storageS3New(
+                    path, true, NULL, bucket, endPoint, storageS3UriStylePath, region, accessKey, secretAccessKey, NULL, 16, 1, 1,
+                    2, 10, host, port, 5000, true, testContainer(), NULL, NULL);
+
+                hrnTlsServerSession(1);
+                hrnTlsServerAccept();
+
+                // List the prefixes directly below the path
+                testRequestP(s3Shard, HTTP_VERB_GET, "/bucket/?delimiter=%2F&list-type=2&prefix=path%2F");
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "    <Contents>"
+                        "        <Key>path/file1.txt</Key>"
+                        "    </Contents>"
+                        "   <CommonPrefixes>"
+                        "       <Prefix>path/a/</Prefix>"
+                        "   </CommonPrefixes>"
+                        "   <CommonPrefixes>"
+                        "       <Prefix>path/b/</Prefix>"
+                        "   </CommonPrefixes>"
+                        "</ListBucketResult>");
+
+                // List the prefixes concurrently
+                testRequestP(s3Shard, HTTP_VERB_GET, "/bucket/?list-type=2&prefix=path%2Fa%2F");
+
+                hrnTlsServerSession(2);
+                hrnTlsServerAccept();
+                testRequestP(s3Shard, HTTP_VERB_GET, "/bucket/?list-type=2&prefix=path%2Fb%2F");
+
+                // The next page of the first prefix is requested while the second prefix is still in flight
+                hrnTlsServerSession(1);
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "    <NextContinuationToken>continue</NextContinuationToken>"
+                        "    <Contents>"
+                        "        <Key>path/a/1.txt</Key>"
+                        "    </Contents>"
+                        "</ListBucketResult>");
+                testRequestP(s3Shard, HTTP_VERB_GET, "/bucket/?continuation-token=continue&list-type=2&prefix=path%2Fa%2F");
+
+                hrnTlsServerSession(2);
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "    <Contents>"
+                        "        <Key>path/b/1.txt</Key>"
+                        "    </Contents>"
+                        "</ListBucketResult>");
+
+                hrnTlsServerSession(1);
+                testResponseP(
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "    <Contents>"
+                        "        <Key>path/a/2.txt</Key>"
+                        "    </Contents>"
+                        "</ListBucketResult>");
+
+                // The delete is sent on the most recently added connection that is not busy
+                hrnTlsServerSession(2);
+                testRequestP(
+                    s3Shard, HTTP_VERB_POST, "/bucket/?delete=",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<Delete><Quiet>true</Quiet>"
+                        "<Object><Key>path/file1.txt</Key></Object>"
+                        "<Object><Key>path/a/1.txt</Key></Object>"
+                        "<Object><Key>path/b/1.txt</Key></Object>"
+                        "<Object><Key>path/a/2.txt</Key></Object>"
+                        "</Delete>\n");
+                testResponseP();
+
+                hrnTlsServerClose();
+                hrnTlsServerSession(1);
+                hrnTlsServerClose();
+                hrnTlsServerSession(0);
+
+                TEST_RESULT_VOID(storagePathRemoveP(s3Shard, strNew("/path"), .recurse = true), "remove");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file without tls");
+
+                Storage *s3Plain = storageS3New(
+                    path, true, NULL, bucket, endPoint, storageS3UriStyleHost, region, accessKey, secretAccessKey, NULL, 16, 1, 1,
+                    1, 2, host, port, 5000, false, false, NULL, NULL);
+
+                hrnTlsServerSession(1);
+                hrnTlsServerAcceptPlain();
+
+                testRequestP(s3Plain, HTTP_VERB_GET, "/file.txt");
+                testResponseP(.content = "this is a sample file");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3Plain, strNew("file.txt")))), "this is a sample file", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("put file without tls signs the content");
+
+                testRequestP(s3Plain, HTTP_VERB_PUT, "/file.txt", .content = "ABCD");
+                testResponseP();
+
+                TEST_RESULT_VOID(storagePutP(storageNewWriteP(s3Plain, strNew("file.txt")), BUFSTRDEF("ABCD")), "put file");
+
+                hrnTlsServerClose();
+                hrnTlsServerSession(0);
+
                 // -----------------------------------------------------------------------------------------------------------------
                 hrnTlsClientEnd();
             }